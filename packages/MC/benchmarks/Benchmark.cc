@@ -0,0 +1,159 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   MC/benchmarks/Benchmark.cc
+ * \author Thomas M. Evans
+ * \date   Fri Oct 16 09:12:44 2026
+ * \brief  Benchmark member definitions.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "Benchmark.hh"
+
+#include <chrono>
+#include <sys/resource.h>
+
+#include "harness/DBC.hh"
+
+namespace
+{
+
+// Write a JSON string.
+void json_string(std::ostream &out, const std::string &s)
+{
+    out << '"';
+    for (char c : s)
+    {
+        if (c == '"' || c == '\\')
+            out << '\\';
+        out << c;
+    }
+    out << '"';
+}
+
+}
+
+namespace mc
+{
+
+//---------------------------------------------------------------------------//
+// CONSTRUCTOR
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Constructor.
+ *
+ * \param min_time minimum wall-clock time in seconds of a timed kernel call
+ */
+Benchmark::Benchmark(double min_time)
+    : d_min_time(min_time)
+{
+    VALIDATE(d_min_time > 0.0, "Minimum benchmark time must be positive, "
+             << d_min_time << " requested.");
+}
+
+//---------------------------------------------------------------------------//
+// PUBLIC FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Write the results as JSON.
+ *
+ * \param out output stream
+ * \param nodes number of domains the benchmarks were run on
+ */
+void Benchmark::write_json(std::ostream &out, int nodes) const
+{
+    auto precision = out.precision(8);
+
+    out << "{\n"
+        << "  \"nodes\": " << nodes << ",\n"
+        << "  \"min_time\": " << d_min_time << ",\n"
+        << "  \"peak_rss_kb\": " << peak_rss_kb() << ",\n"
+        << "  \"results\": [";
+
+    for (int n = 0, N = d_results.size(); n < N; ++n)
+    {
+        const Result &r = d_results[n];
+
+        out << (n ? ",\n" : "\n") << "    {\n"
+            << "      \"suite\": ";
+        json_string(out, r.suite);
+        out << ",\n      \"name\": ";
+        json_string(out, r.name);
+        out << ",\n      \"params\": {";
+        for (int p = 0, P = r.params.size(); p < P; ++p)
+        {
+            out << (p ? ", " : "");
+            json_string(out, r.params[p].first);
+            out << ": ";
+            json_string(out, r.params[p].second);
+        }
+        out << "},\n"
+            << "      \"count\": " << r.count << ",\n"
+            << "      \"seconds\": " << r.seconds << ",\n"
+            << "      \"rate\": " << r.rate() << ",\n"
+            << "      \"peak_rss_kb\": " << r.peak_rss_kb << "\n"
+            << "    }";
+    }
+
+    out << "\n  ]\n}" << std::endl;
+    out.precision(precision);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Process high-water memory mark (peak resident set size) in kB.
+ */
+long Benchmark::peak_rss_kb()
+{
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+
+#ifdef __APPLE__
+    // reported in bytes on OSX
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Record a result.
+ */
+auto Benchmark::record(const std::string &suite,
+                       const std::string &name,
+                       const Params      &params,
+                       double             count,
+                       double             seconds) -> const Result&
+{
+    Result r;
+    r.suite       = suite;
+    r.name        = name;
+    r.params      = params;
+    r.count       = count;
+    r.seconds     = seconds;
+    r.peak_rss_kb = peak_rss_kb();
+    d_results.push_back(r);
+
+    return d_results.back();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Wall-clock time in seconds.
+ */
+double Benchmark::wall_clock()
+{
+    typedef std::chrono::steady_clock Clock;
+    return std::chrono::duration<double>(
+        Clock::now().time_since_epoch()).count();
+}
+
+} // end namespace mc
+
+//---------------------------------------------------------------------------//
+//                 end of Benchmark.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,139 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   MC/benchmarks/Benchmark.hh
+ * \author Thomas M. Evans
+ * \date   Fri Oct 16 09:12:44 2026
+ * \brief  Benchmark class definition.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef MC_benchmarks_Benchmark_hh
+#define MC_benchmarks_Benchmark_hh
+
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mc
+{
+
+//===========================================================================//
+/*!
+ * \class Benchmark
+ * \brief Time benchmark kernels and write the results as JSON.
+ *
+ * A kernel is a functor called as \c kernel(reps) that executes \c reps
+ * repetitions of a fixed amount of work (\c ops_per_rep operations).  The
+ * kernel is run once to warm up, then the number of repetitions is doubled
+ * until a single timed call takes at least the minimum time.  The reported
+ * rate is the number of operations per wall-clock second of the last call.
+ *
+ * The process high-water memory mark (peak resident set size) is recorded
+ * after each kernel and for the whole run.
+ *
+ * The output has the form:
+ * \code
+   {
+     "nodes": 1,
+     "min_time": 1.0,
+     "peak_rss_kb": 123456,
+     "results": [
+       {
+         "suite": "geometry",
+         "name": "RTK_Cell::distance_to_boundary",
+         "params": {"problem": "mc_c5g7.xml"},
+         "count": 8388608,
+         "seconds": 1.27,
+         "rate": 6.6e+06,
+         "peak_rss_kb": 81234
+       }
+     ]
+   }
+ * \endcode
+ */
+//===========================================================================//
+
+class Benchmark
+{
+  public:
+    //@{
+    //! Typedefs.
+    typedef std::pair<std::string, std::string> Param;
+    typedef std::vector<Param>                  Params;
+    //@}
+
+    //! Result of a single benchmark kernel.
+    struct Result
+    {
+        std::string suite;
+        std::string name;
+        Params      params;
+        double      count;
+        double      seconds;
+        long        peak_rss_kb;
+
+        //! Operations per second.
+        double rate() const { return seconds > 0.0 ? count / seconds : 0.0; }
+    };
+
+    typedef std::vector<Result> Vec_Result;
+
+  private:
+    // >>> DATA
+
+    // Minimum time for a timed kernel call.
+    double d_min_time;
+
+    // Results.
+    Vec_Result d_results;
+
+  public:
+    // Constructor.
+    explicit Benchmark(double min_time = 1.0);
+
+    // Time a kernel.
+    template<class Kernel>
+    const Result& run(const std::string &suite, const std::string &name,
+                      const Params &params, double ops_per_rep,
+                      Kernel &&kernel);
+
+    // Write the results as JSON.
+    void write_json(std::ostream &out, int nodes) const;
+
+    // >>> ACCESSORS
+
+    //! Minimum time for a timed kernel call.
+    double min_time() const { return d_min_time; }
+
+    //! Results.
+    const Vec_Result& results() const { return d_results; }
+
+    // Process high-water memory mark in kilobytes.
+    static long peak_rss_kb();
+
+  private:
+    // >>> IMPLEMENTATION
+
+    // Record a result.
+    const Result& record(const std::string &suite, const std::string &name,
+                         const Params &params, double count, double seconds);
+
+    // Wall-clock time in seconds.
+    static double wall_clock();
+};
+
+} // end namespace mc
+
+//---------------------------------------------------------------------------//
+// TEMPLATE MEMBER DEFINITIONS
+//---------------------------------------------------------------------------//
+
+#include "Benchmark.t.hh"
+
+#endif // MC_benchmarks_Benchmark_hh
+
+//---------------------------------------------------------------------------//
+//                 end of Benchmark.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,65 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   MC/benchmarks/Benchmark.t.hh
+ * \author Thomas M. Evans
+ * \date   Fri Oct 16 09:12:44 2026
+ * \brief  Benchmark template member definitions.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef MC_benchmarks_Benchmark_t_hh
+#define MC_benchmarks_Benchmark_t_hh
+
+#include "harness/DBC.hh"
+#include "Benchmark.hh"
+
+namespace mc
+{
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Time a kernel.
+ *
+ * \param suite benchmark suite (geometry, physics, transport)
+ * \param name kernel name
+ * \param params parameters identifying the configuration
+ * \param ops_per_rep number of operations performed by one repetition
+ * \param kernel functor called as \c kernel(reps)
+ */
+template<class Kernel>
+auto Benchmark::run(const std::string &suite,
+                    const std::string &name,
+                    const Params      &params,
+                    double             ops_per_rep,
+                    Kernel           &&kernel) -> const Result&
+{
+    REQUIRE(ops_per_rep > 0.0);
+
+    // warm up caches and any lazily-built data
+    kernel(1);
+
+    // double the repetitions until a call takes at least the minimum time
+    int    reps    = 1;
+    double seconds = 0.0;
+    while (true)
+    {
+        double begin = wall_clock();
+        kernel(reps);
+        seconds = wall_clock() - begin;
+
+        if (seconds >= d_min_time || reps >= (1 << 30))
+            break;
+        reps *= 2;
+    }
+
+    return record(suite, name, params, ops_per_rep * reps, seconds);
+}
+
+} // end namespace mc
+
+#endif // MC_benchmarks_Benchmark_t_hh
+
+//---------------------------------------------------------------------------//
+//                 end of Benchmark.t.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,639 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   MC/benchmarks/mc_bench.cc
+ * \author Thomas M. Evans
+ * \date   Fri Oct 16 09:12:44 2026
+ * \brief  MC geometry, physics, and transport benchmark executable.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_DefaultComm.hpp"
+#include "Teuchos_XMLParameterListHelpers.hpp"
+
+#include "harness/DBC.hh"
+#include "comm/global.hh"
+#include "comm/P_Stream.hh"
+#include "rng/RNG_Control.hh"
+#include "utils/Constants.hh"
+#include "utils/Definitions.hh"
+#include "xs/XS_Builder.hh"
+#include "geometry/RTK_Geometry.hh"
+#include "geometry/Cartesian_Mesh.hh"
+#include "mc/Box_Shape.hh"
+#include "mc/Cell_Tally.hh"
+#include "mc/Fission_Tally.hh"
+#include "mc/Mesh_Tally.hh"
+#include "mc/Physics.hh"
+#include "mc/Source_Transporter.hh"
+#include "mc/Tallier.hh"
+#include "mc/Uniform_Source.hh"
+#include "mc_driver/Problem_Builder.hh"
+#include "Benchmark.hh"
+
+//---------------------------------------------------------------------------//
+// TYPES
+//---------------------------------------------------------------------------//
+
+typedef profugus::Core                         Geometry_t;
+typedef Geometry_t::Array_t                    Core_t;
+typedef Core_t::Object_t                       Lattice_t;
+typedef Lattice_t::Object_t                    Pin_Cell_t;
+typedef Geometry_t::Geo_State_t                Geo_State_t;
+typedef mc::Problem_Builder<Geometry_t>        Problem_Builder_t;
+typedef profugus::Physics<Geometry_t>          Physics_t;
+typedef Physics_t::Particle_t                  Particle_t;
+typedef Physics_t::Bank_t                      Bank_t;
+typedef profugus::Tallier<Geometry_t>          Tallier_t;
+typedef profugus::Source_Transporter<Geometry_t> Transporter_t;
+typedef profugus::Uniform_Source<Geometry_t>   Uniform_Source_t;
+typedef profugus::Cell_Tally<Geometry_t>       Cell_Tally_t;
+typedef profugus::Mesh_Tally<Geometry_t>       Mesh_Tally_t;
+typedef profugus::Fission_Tally<Geometry_t>    Fission_Tally_t;
+typedef Teuchos::ParameterList                 ParameterList;
+typedef Teuchos::RCP<ParameterList>            RCP_ParameterList;
+typedef def::Space_Vector                      Space_Vector;
+typedef mc::Benchmark::Params                  Params;
+
+// Parallel specs.
+int node  = 0;
+int nodes = 0;
+
+// Sink for benchmark results so that kernels are not optimized away.
+volatile double sink = 0.0;
+
+//---------------------------------------------------------------------------//
+// Benchmark options
+
+struct Options
+{
+    // Problem (geometry and transport) inputs.
+    def::Vec_String problems;
+
+    // Cross section libraries (collision physics).
+    def::Vec_String libraries;
+
+    // JSON output file (stdout if empty).
+    std::string output;
+
+    // Minimum time of a timed kernel call.
+    double min_time = 1.0;
+
+    // Number of particles per transport solve.
+    int num_particles = 10000;
+
+    // Number of points sampled for the geometry kernels.
+    int num_points = 4096;
+
+    // Number of collisions per material for the physics kernel.
+    int num_collisions = 1000;
+
+    // Random number seed.
+    int seed = 34523;
+};
+
+//---------------------------------------------------------------------------//
+// Print instructions on how to run the benchmark executable
+
+void print_usage()
+{
+    if (node == 0)
+    {
+        std::cout << "Usage: xmc_bench [-i XMLFILE]... [-xs XSFILE]... "
+                  << "[-o JSONFILE] [-t SECONDS] [-np PARTICLES]\n"
+                  << "  -i   MC problem input; runs the geometry and "
+                  << "transport benchmarks\n"
+                  << "  -xs  cross section library; runs the collision "
+                  << "physics benchmark\n"
+                  << "  -o   JSON results file (default stdout)\n"
+                  << "  -t   minimum time per timed kernel (default 1.0 s)\n"
+                  << "  -np  particles per transport solve (default 10000)"
+                  << std::endl;
+    }
+    profugus::finalize();
+    exit(1);
+}
+
+//---------------------------------------------------------------------------//
+// Parse the input arguments
+
+Options parse_input_arguments(const def::Vec_String &arguments)
+{
+    Options opts;
+
+    for (int n = 0, N = arguments.size(); n < N; ++n)
+    {
+        const std::string &arg = arguments[n];
+
+        if (arg == "-h" || arg == "--help")
+            print_usage();
+
+        // all remaining options take a value
+        if (n + 1 == N || arguments[n + 1].empty())
+        {
+            if (node == 0)
+            {
+                std::cout << std::endl << "ERROR: Missing value for "
+                          << arg << "." << std::endl << std::endl;
+            }
+            print_usage();
+        }
+        const std::string &value = arguments[++n];
+
+        if (arg == "-i")
+            opts.problems.push_back(value);
+        else if (arg == "-xs")
+            opts.libraries.push_back(value);
+        else if (arg == "-o")
+            opts.output = value;
+        else if (arg == "-t")
+            opts.min_time = std::atof(value.c_str());
+        else if (arg == "-np")
+            opts.num_particles = std::atoi(value.c_str());
+        else
+        {
+            if (node == 0)
+            {
+                std::cout << std::endl << "ERROR: Unknown option "
+                          << arg << "." << std::endl << std::endl;
+            }
+            print_usage();
+        }
+    }
+
+    if (opts.problems.empty() && opts.libraries.empty())
+    {
+        if (node == 0)
+        {
+            std::cout << std::endl << "ERROR: No problem inputs or cross "
+                      << "section libraries given." << std::endl << std::endl;
+        }
+        print_usage();
+    }
+
+    return opts;
+}
+
+//---------------------------------------------------------------------------//
+// Strip the directory from a filename
+
+std::string basename(const std::string &file)
+{
+    auto pos = file.find_last_of('/');
+    return pos == std::string::npos ? file : file.substr(pos + 1);
+}
+
+//---------------------------------------------------------------------------//
+// Sample points and isotropic directions inside a box
+
+void sample_points(const Space_Vector        &lower,
+                   const Space_Vector        &upper,
+                   profugus::RNG_Control::RNG_t rng,
+                   std::vector<Space_Vector> &r,
+                   std::vector<Space_Vector> &omega)
+{
+    using def::X; using def::Y; using def::Z;
+
+    for (int n = 0, N = r.size(); n < N; ++n)
+    {
+        for (int d = 0; d < 3; ++d)
+        {
+            r[n][d] = lower[d] + (upper[d] - lower[d]) * rng.ran();
+        }
+
+        double costheta = 1.0 - 2.0 * rng.ran();
+        double sintheta = std::sqrt(1.0 - costheta * costheta);
+        double phi      = profugus::constants::two_pi * rng.ran();
+
+        omega[n][X] = sintheta * std::cos(phi);
+        omega[n][Y] = sintheta * std::sin(phi);
+        omega[n][Z] = costheta;
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Distance-to-boundary benchmarks at the pin-cell, lattice, and core levels
+
+void bench_geometry(mc::Benchmark           &bench,
+                    const std::string       &problem,
+                    const Problem_Builder_t &builder,
+                    const Options           &opts)
+{
+    auto geometry = builder.get_geometry();
+    CHECK(geometry);
+
+    const Core_t     &core    = geometry->array();
+    const Lattice_t  &lattice = core.object(0);
+    const Pin_Cell_t &pin     = lattice.object(0);
+
+    const int N = opts.num_points;
+    profugus::RNG_Control control(opts.seed);
+
+    std::vector<Space_Vector> r(N), omega(N);
+    std::vector<Geo_State_t>  states(N);
+    Space_Vector lower, upper;
+
+    Params params = {{"problem", problem}};
+
+    // >>> RTK_Cell: the first pin cell of the first lattice (local frame)
+    pin.get_extents(lower, upper);
+    sample_points(lower, upper, control.rng(0), r, omega);
+    for (int n = 0; n < N; ++n)
+        pin.initialize(r[n], states[n]);
+
+    bench.run("geometry", "RTK_Cell::distance_to_boundary", params, N,
+              [&](int reps)
+              {
+                  double d = 0.0;
+                  for (int rep = 0; rep < reps; ++rep)
+                  {
+                      for (int n = 0; n < N; ++n)
+                      {
+                          pin.distance_to_boundary(r[n], omega[n], states[n]);
+                          d += states[n].dist_to_next_region;
+                      }
+                  }
+                  sink = d;
+              });
+
+    // >>> RTK_Array: the first lattice (local frame starts at the origin)
+    lattice.get_extents(lower, upper);
+    upper -= lower;
+    lower  = Space_Vector(0.0, 0.0, 0.0);
+    sample_points(lower, upper, control.rng(1), r, omega);
+    for (int n = 0; n < N; ++n)
+        lattice.initialize(r[n], states[n]);
+
+    bench.run("geometry", "RTK_Array::distance_to_boundary", params, N,
+              [&](int reps)
+              {
+                  double d = 0.0;
+                  for (int rep = 0; rep < reps; ++rep)
+                  {
+                      for (int n = 0; n < N; ++n)
+                      {
+                          lattice.distance_to_boundary(
+                              r[n], omega[n], states[n]);
+                          d += states[n].dist_to_next_region;
+                      }
+                  }
+                  sink = d;
+              });
+
+    // >>> Core: the full geometry
+    auto box = geometry->get_extents();
+    sample_points(box.lower(), box.upper(), control.rng(2), r, omega);
+
+    bench.run("geometry", "Core::initialize", params, N,
+              [&](int reps)
+              {
+                  int c = 0;
+                  for (int rep = 0; rep < reps; ++rep)
+                  {
+                      for (int n = 0; n < N; ++n)
+                      {
+                          geometry->initialize(r[n], omega[n], states[n]);
+                          c += geometry->cell(states[n]);
+                      }
+                  }
+                  sink = c;
+              });
+
+    bench.run("geometry", "Core::distance_to_boundary", params, N,
+              [&](int reps)
+              {
+                  double d = 0.0;
+                  for (int rep = 0; rep < reps; ++rep)
+                  {
+                      for (int n = 0; n < N; ++n)
+                      {
+                          d += geometry->distance_to_boundary(states[n]);
+                      }
+                  }
+                  sink = d;
+              });
+}
+
+//---------------------------------------------------------------------------//
+// Particles/sec through Source_Transporter::solve with each tally type
+
+void bench_transport(mc::Benchmark           &bench,
+                     const std::string       &problem,
+                     const Problem_Builder_t &builder,
+                     const Options           &opts)
+{
+    auto geometry = builder.get_geometry();
+    auto physics  = builder.get_physics();
+    auto var_red  = builder.get_var_reduction();
+    auto rcon     = builder.get_rng_control();
+    CHECK(geometry && physics && var_red && rcon);
+
+    // copy the problem database and set the number of particles
+    RCP_ParameterList db = Teuchos::rcp(new ParameterList(
+                                            *builder.problem_db()));
+    db->set("Np", opts.num_particles);
+    db->set("mc_diag_frac", 1.1);
+    db->get("problem_name", std::string("MC"));
+
+    // uniform source over the whole geometry
+    auto box = geometry->get_extents();
+    const Space_Vector &lo = box.lower(), &hi = box.upper();
+    auto shape = std::make_shared<profugus::Box_Shape>(
+        lo[def::X], hi[def::X], lo[def::Y], hi[def::Y], lo[def::Z], hi[def::Z]);
+
+    // a uniform 10x10x10 mesh over the geometry for mesh-based tallies
+    def::Vec_Dbl edges[3];
+    for (int d = 0; d < 3; ++d)
+    {
+        edges[d].resize(11);
+        for (int i = 0; i <= 10; ++i)
+            edges[d][i] = lo[d] + (hi[d] - lo[d]) * i / 10.0;
+    }
+    auto mesh = std::make_shared<profugus::Cartesian_Mesh>(
+        edges[0], edges[1], edges[2]);
+
+    // event-based transport requires batch tally statistics
+    auto statistics =
+        db->get("transport_type", std::string("history")) == "event" ?
+        profugus::tally::BATCH : profugus::tally::HISTORY;
+
+    const char *types[] = {"none", "cell", "mesh", "fission"};
+    for (const char *type : types)
+    {
+        // build the tallier
+        auto tallier = std::make_shared<Tallier_t>();
+        tallier->set(geometry, physics);
+
+        if (std::string(type) == "cell")
+        {
+            auto tally = std::make_shared<Cell_Tally_t>(db, physics);
+            tally->set_all_cells();
+            tallier->add_pathlength_tally(tally);
+        }
+        else if (std::string(type) == "mesh")
+        {
+            auto tally = std::make_shared<Mesh_Tally_t>(db, physics);
+            tally->set_mesh(mesh);
+            tallier->add_pathlength_tally(tally);
+        }
+        else if (std::string(type) == "fission")
+        {
+            auto tally = std::make_shared<Fission_Tally_t>(
+                physics, statistics);
+            tally->set_mesh(mesh);
+            tallier->add_pathlength_tally(tally);
+        }
+        tallier->build();
+
+        // build the transporter
+        Transporter_t solver(db, geometry, physics);
+        solver.set(var_red);
+        solver.set(tallier);
+
+        Params params = {
+            {"problem", problem},
+            {"tally", type},
+            {"transport_type", db->get("transport_type",
+                                       std::string("history"))}};
+
+        bench.run("transport", "Source_Transporter::solve", params,
+                  opts.num_particles,
+                  [&](int reps)
+                  {
+                      for (int rep = 0; rep < reps; ++rep)
+                      {
+                          auto source = std::make_shared<Uniform_Source_t>(
+                              db, geometry, physics, rcon);
+                          source->build_source(shape);
+                          solver.assign_source(source);
+                          solver.solve();
+                      }
+                      profugus::global_barrier();
+                  });
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Collisions/sec over all materials in a cross section library
+//
+// Materials with a zero total cross section in any group (void) are skipped
+// because particles never collide in them.
+
+void bench_physics(mc::Benchmark     &bench,
+                   const std::string &library,
+                   const Options     &opts)
+{
+    typedef profugus::XS_Builder::Matid_Map Matid_Map;
+    typedef Physics_t::XS_t                 XS_t;
+    typedef std::shared_ptr<Geometry_t>     SP_Geometry;
+
+    // build all of the materials in the library (P0 for Monte Carlo)
+    profugus::XS_Builder builder;
+    builder.open_and_broadcast(library);
+
+    const auto &materials = builder.materials();
+    const int   Ng        = builder.num_groups();
+
+    Matid_Map matids;
+    for (int m = 0, Nm = materials.size(); m < Nm; ++m)
+    {
+        matids.insert(Matid_Map::value_type(m, materials[m]));
+    }
+    matids.complete();
+    builder.build(matids, 0, 0, Ng - 1);
+
+    // libraries without group bounds (SPn libraries) get nominal ones;
+    // Physics needs bounds but collisions do not depend on their values
+    XS_t &xs = *builder.get_xs();
+    if (xs.bounds()[0] == 0.0)
+    {
+        XS_t::OneDArray bounds(Ng + 1);
+        for (int g = 0; g <= Ng; ++g)
+        {
+            bounds[g] = Ng - g;
+        }
+        xs.set_bounds(bounds);
+    }
+
+    // find the materials that particles can collide in
+    def::Vec_Int collide_mats;
+    for (int m = 0, Nm = materials.size(); m < Nm; ++m)
+    {
+        const auto &total = xs.vector(m, XS_t::TOTAL);
+        if (*std::min_element(total.values(), total.values() + Ng) > 0.0)
+        {
+            collide_mats.push_back(m);
+        }
+    }
+    const int Nm = collide_mats.size();
+    VALIDATE(Nm > 0, "No materials with collisions in " << library);
+
+    // make the physics (implicit capture by default)
+    RCP_ParameterList db = Teuchos::rcp(new ParameterList("physics"));
+    auto physics = std::make_shared<Physics_t>(db, builder.get_xs());
+
+    // make an infinite medium of each material and a particle in it
+    std::vector<SP_Geometry> geometries(Nm);
+    std::vector<Particle_t>  particles(Nm);
+    profugus::RNG_Control    control(opts.seed);
+    for (int n = 0; n < Nm; ++n)
+    {
+        int m = collide_mats[n];
+
+        auto pin = std::make_shared<Pin_Cell_t>(m, 100.0, 100.0);
+        auto lat = std::make_shared<Lattice_t>(1, 1, 1, 1);
+        lat->assign_object(pin, 0);
+        lat->complete(0.0, 0.0, 0.0);
+        auto core = std::make_shared<Core_t>(1, 1, 1, 1);
+        core->assign_object(lat, 0);
+        core->complete(0.0, 0.0, 0.0);
+        geometries[n] = std::make_shared<Geometry_t>(core);
+
+        Particle_t &p = particles[n];
+        geometries[n]->initialize(Space_Vector(50.0, 50.0, 50.0),
+                                  Space_Vector(1.0, 0.0, 0.0), p.geo_state());
+        p.set_rng(control.rng(n));
+        p.set_matid(m);
+        p.set_group(m % Ng);
+    }
+
+    Params params = {{"library", basename(library)},
+                     {"groups", std::to_string(Ng)},
+                     {"materials", std::to_string(Nm)}};
+
+    const int Nc = opts.num_collisions;
+    Bank_t bank;
+
+    bench.run("physics", "Physics::collide", params, double(Nm) * Nc,
+              [&](int reps)
+              {
+                  for (int n = 0; n < Nm; ++n)
+                  {
+                      physics->set_geometry(geometries[n]);
+                      Particle_t &p = particles[n];
+
+                      for (int c = 0, N = reps * Nc; c < N; ++c)
+                      {
+                          p.set_wt(1.0);
+                          p.set_event(profugus::events::COLLISION);
+                          p.live();
+                          physics->collide(p, bank);
+                      }
+                      sink = p.group();
+                  }
+              });
+}
+
+//---------------------------------------------------------------------------//
+
+int main(int argc, char *argv[])
+{
+    profugus::initialize(argc, argv);
+
+    // nodes
+    node  = profugus::node();
+    nodes = profugus::nodes();
+
+    // process input arguments
+    def::Vec_String arguments(argc - 1);
+    for (int c = 1; c < argc; c++)
+    {
+        arguments[c - 1] = argv[c];
+    }
+    Options opts = parse_input_arguments(arguments);
+
+    try
+    {
+        mc::Benchmark bench(opts.min_time);
+
+        // geometry and transport benchmarks for each problem
+        for (const auto &file : opts.problems)
+        {
+            profugus::pcout << "Benchmarking problem " << file
+                            << profugus::endl;
+
+            // read the data on every domain
+            auto master = Teuchos::rcp(new ParameterList(""));
+            auto comm   = Teuchos::DefaultComm<int>::getComm();
+            Teuchos::updateParametersFromXmlFileAndBroadcast(
+                file.c_str(), master.ptr(), *comm);
+            VALIDATE(master->isSublist("CORE"),
+                     "Benchmarks require an RTK (CORE) geometry in " << file);
+
+            Problem_Builder_t builder;
+            builder.setup(master);
+
+            bench_geometry(bench, basename(file), builder, opts);
+            bench_transport(bench, basename(file), builder, opts);
+        }
+
+        // collision physics benchmarks for each library
+        for (const auto &file : opts.libraries)
+        {
+            profugus::pcout << "Benchmarking cross sections " << file
+                            << profugus::endl;
+
+            bench_physics(bench, file, opts);
+        }
+
+        // summary
+        for (const auto &r : bench.results())
+        {
+            profugus::pcout << profugus::setw(10) << r.suite << " "
+                            << profugus::setw(34) << r.name << " "
+                            << profugus::scientific
+                            << profugus::setprecision(4) << r.rate()
+                            << " /s" << profugus::endl;
+        }
+        profugus::pcout << "Peak memory " << mc::Benchmark::peak_rss_kb()
+                        << " kB" << profugus::endl;
+
+        // write the results
+        if (node == 0)
+        {
+            if (opts.output.empty())
+            {
+                bench.write_json(std::cout, nodes);
+            }
+            else
+            {
+                std::ofstream out(opts.output.c_str());
+                VALIDATE(out, "Unable to open " << opts.output);
+                bench.write_json(out, nodes);
+            }
+        }
+    }
+    catch (const profugus::assertion &a)
+    {
+        std::cout << "Caught profugus assertion " << a.what() << std::endl;
+        exit(1);
+    }
+    catch (const std::exception &a)
+    {
+        std::cout << "Caught standard assertion " << a.what() << std::endl;
+        exit(1);
+    }
+    catch (...)
+    {
+        std::cout << "Caught assertion of unknown origin." << std::endl;
+        exit(1);
+    }
+
+    profugus::finalize();
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
+//                 end of mc_bench.cc
+//---------------------------------------------------------------------------//
@@ -15,7 +15,7 @@ SET(LIB_OPTIONAL_DEP_PACKAGES)
 
 SET(TEST_REQUIRED_DEP_PACKAGES)
 SET(TEST_OPTIONAL_DEP_PACKAGES)
-SET(LIB_REQUIRED_DEP_TPLS)
+SET(LIB_REQUIRED_DEP_TPLS Pthread)
 SET(LIB_OPTIONAL_DEP_TPLS)
 SET(TEST_REQUIRED_DEP_TPLS)
 SET(TEST_OPTIONAL_DEP_TPLS)
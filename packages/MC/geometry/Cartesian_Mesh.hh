@@ -144,6 +144,13 @@ class Cartesian_Mesh
         REQUIRE(0 <= d && d < d_dimension);
         return d_edges[d].back();
     }
+
+    // >>> RAY TRACING
+
+    // Walk a ray segment through the mesh, scoring the length in each cell.
+    template<class Score>
+    inline void segment(const Space_Vector &r, const Space_Vector &omega,
+                        double length, Score &&score) const;
 };
 
 } // end namespace profugus
@@ -12,6 +12,7 @@
 #define MC_geometry_Cartesian_Mesh_i_hh
 
 #include <algorithm>
+#include <limits>
 
 namespace profugus
 {
@@ -120,6 +121,117 @@ Cartesian_Mesh::index(dim_type i, dim_type j, dim_type k) const
     return i + d_extents[I] * (j + k * d_extents[J]);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Walk a ray segment through the mesh.
+ *
+ * The segment starting at \a r in (unit) direction \a omega with length \a
+ * length is traced through the mesh with a 3-D digital differential analyzer
+ * (DDA); \c score(cell, d) is called for each mesh cell the segment crosses,
+ * in order, with the pathlength \e d inside that cell.  Portions of the
+ * segment outside of the mesh are not scored.  The cost is proportional to
+ * the number of cells crossed; no searches are done after locating the
+ * first cell.
+ *
+ * On a 2-D mesh the z-extent is unbounded.
+ */
+template<class Score>
+void Cartesian_Mesh::segment(const Space_Vector &r,
+                             const Space_Vector &omega,
+                             double              length,
+                             Score             &&score) const
+{
+    using def::I; using def::J; using def::K;
+
+    REQUIRE(length >= 0.0);
+
+    const double huge = std::numeric_limits<double>::max();
+
+    // clip the segment to the mesh bounding box
+    double t_enter = 0.0;
+    double t_exit  = length;
+    for (int d = 0; d < d_dimension; ++d)
+    {
+        const double lo = d_edges[d].front();
+        const double hi = d_edges[d].back();
+
+        if (omega[d] == 0.0)
+        {
+            // parallel to this axis: the ray is either always in or out
+            if (r[d] < lo || r[d] > hi)
+                return;
+        }
+        else
+        {
+            double t_lo = (lo - r[d]) / omega[d];
+            double t_hi = (hi - r[d]) / omega[d];
+            if (t_lo > t_hi)
+                std::swap(t_lo, t_hi);
+
+            t_enter = std::max(t_enter, t_lo);
+            t_exit  = std::min(t_exit, t_hi);
+        }
+    }
+    if (t_enter >= t_exit)
+        return;
+
+    // locate the entry cell; a point on an edge is put in the cell that the
+    // ray is heading into, and the distance to the next edge along each axis
+    // is measured from the segment origin so that it does not drift
+    Dim_Vector             ijk(0);
+    Dim_Vector             step(0);
+    Vector_Lite<double, 3> t_next(huge);
+    for (int d = 0; d < d_dimension; ++d)
+    {
+        const Vec_Dbl &e = d_edges[d];
+        const double   x = r[d] + t_enter * omega[d];
+
+        dim_type i = (omega[d] < 0.0 ?
+                      std::lower_bound(e.begin(), e.end(), x) :
+                      std::upper_bound(e.begin(), e.end(), x)) - e.begin() - 1;
+        ijk[d] = std::max(0, std::min(i, d_extents[d] - 1));
+
+        if (omega[d] > 0.0)
+        {
+            step[d]   = 1;
+            t_next[d] = (e[ijk[d] + 1] - r[d]) / omega[d];
+        }
+        else if (omega[d] < 0.0)
+        {
+            step[d]   = -1;
+            t_next[d] = (e[ijk[d]] - r[d]) / omega[d];
+        }
+    }
+
+    // walk the cells until the end of the segment or the mesh is reached
+    double t = t_enter;
+    while (t < t_exit)
+    {
+        // axis of the nearest edge crossing
+        int d = t_next[I] < t_next[J] ? I : J;
+        if (t_next[K] < t_next[d])
+            d = K;
+
+        // score the length in the current cell
+        double t_end = std::min(t_next[d], t_exit);
+        if (t_end > t)
+        {
+            score(index(ijk[I], ijk[J], ijk[K]), t_end - t);
+            t = t_end;
+        }
+        if (t >= t_exit)
+            break;
+
+        // cross into the next cell along this axis
+        ijk[d] += step[d];
+        if (ijk[d] < 0 || ijk[d] >= d_extents[d])
+            break;
+
+        t_next[d] = (d_edges[d][step[d] > 0 ? ijk[d] + 1 : ijk[d]] - r[d])
+                    / omega[d];
+    }
+}
+
 } // end namespace profugus
 
 #endif // MC_geometry_Cartesian_Mesh_i_hh
@@ -83,7 +83,7 @@ void Mesh_Geometry::initialize(
 /*!
  * \brief Calculate distance to the next cell
  */
-double Mesh_Geometry::distance_to_boundary(Geo_State_t& state)
+double Mesh_Geometry::distance_to_boundary(Geo_State_t& state) const
 {
     using def::I; using def::J; using def::K;
     using profugus::soft_equiv;
@@ -461,7 +461,7 @@ Bounding_Box Mesh_Geometry::get_cell_extents(geometry::cell_type cell) const
 /*!
  * \brief Reflect the direction on a reflecting surface
  */
-bool Mesh_Geometry::reflect(Geo_State_t& state)
+bool Mesh_Geometry::reflect(Geo_State_t& state) const
 {
     using def::X; using def::Y; using def::Z;
     REQUIRE(soft_equiv(vector_magnitude(state.d_dir), 1.0, 1.0e-6));
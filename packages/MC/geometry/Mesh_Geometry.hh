@@ -90,10 +90,10 @@ class Mesh_Geometry : public Tracking_Geometry<Mesh_State>
                     Geo_State_t       & state) const;
 
     //! Get distance to next boundary.
-    double distance_to_boundary(Geo_State_t& state);
+    double distance_to_boundary(Geo_State_t& state) const;
 
     //! Move to and cross a surface in the current direction.
-    void move_to_surface(Geo_State_t& state)
+    void move_to_surface(Geo_State_t& state) const
     {
         using def::I; using def::J; using def::K;
 
@@ -149,7 +149,7 @@ class Mesh_Geometry : public Tracking_Geometry<Mesh_State>
     }
 
     //! Move a distance \e d to a point in the current direction.
-    void move_to_point(double d, Geo_State_t& state)
+    void move_to_point(double d, Geo_State_t& state) const
     {
         move(d, state);
 
@@ -245,7 +245,7 @@ class Mesh_Geometry : public Tracking_Geometry<Mesh_State>
     //! Change the direction to \p new_direction.
     void change_direction(
             const Space_Vector& new_direction,
-            Geo_State_t& state)
+            Geo_State_t& state) const
     {
         // update and normalize the direction
         state.d_dir = new_direction;
@@ -256,13 +256,13 @@ class Mesh_Geometry : public Tracking_Geometry<Mesh_State>
     void change_direction(
             double       costheta,
             double       phi,
-            Geo_State_t& state)
+            Geo_State_t& state) const
     {
         cartesian_vector_transform(costheta, phi, state.d_dir);
     }
 
     // Reflect the direction at a reflecting surface.
-    bool reflect(Geo_State_t& state);
+    bool reflect(Geo_State_t& state) const;
 
     // Return the outward normal at the location dictated by the state.
     Space_Vector normal(const Geo_State_t& state) const;
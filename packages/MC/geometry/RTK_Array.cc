@@ -34,7 +34,8 @@ int RTK_Array<RTK_Cell>::calc_level()
  * \brief Determine boundary crossing in array of pin cells.
  */
 template<>
-void RTK_Array<RTK_Cell>::determine_boundary_crossings(Geo_State_t &state)
+void RTK_Array<RTK_Cell>::determine_boundary_crossings(
+    Geo_State_t &state) const
 {
     using def::X; using def::Y; using def::Z;
 
@@ -45,7 +46,7 @@ void RTK_Array<RTK_Cell>::determine_boundary_crossings(Geo_State_t &state)
         // process internal pin-cell surface crossings
         case Geo_State_t::INTERNAL:
             // call the pin-cell surface crossing routine for internal surfaces
-            object(state)->cross_surface(state);
+            object(state).cross_surface(state);
             break;
         // otherwise process particles leaving the pin cell by updating the
         // region id to the moderator region in the next pin cell
@@ -80,7 +81,7 @@ void RTK_Array<RTK_Cell>::determine_boundary_crossings(Geo_State_t &state)
  */
 template<>
 void RTK_Array<RTK_Cell>::update_coordinates(const Space_Vector &r,
-                                             Geo_State_t        &state)
+                                             Geo_State_t        &state) const
 {
     REQUIRE(d_level == 0);
 
@@ -91,30 +92,30 @@ void RTK_Array<RTK_Cell>::update_coordinates(const Space_Vector &r,
     {
         CHECK(state.exiting_face != Geo_State_t::NONE);
         CHECK(state.region == Geo_State_t::VESSEL ?
-               object(state)->has_vessel() : true);
+               object(state).has_vessel() : true);
 
         // update the face of the state
         state.face = Geo_State_t::NONE;
 
         // set to moderator in the pin cell
-        state.region = object(state)->num_regions() - 1;
+        state.region = object(state).num_regions() - 1;
 
         // need to transport into coordinate system of pin cell
         Space_Vector tr = transform(r, state);
 
         // calculate the segment in the new pin-cell
-        state.segment = object(state)->segment(tr[0], tr[1]);
-        CHECK(state.segment < object(state)->num_segments());
+        state.segment = object(state).segment(tr[0], tr[1]);
+        CHECK(state.segment < object(state).num_segments());
 
         // update if crossing into pin cell from high or low Z-face or if the
         // adjoining cell has a vessel
         if (state.exiting_face == Geo_State_t::MINUS_Z ||
             state.exiting_face == Geo_State_t::PLUS_Z  ||
-            object(state)->has_vessel())
+            object(state).has_vessel())
         {
             // determine the region of the point entering the pin-cell through
             // the Z-face
-            state.region = object(state)->region(tr[0], tr[1]);
+            state.region = object(state).region(tr[0], tr[1]);
         }
     }
 } //end update_coordinates( const Space_Vector, Geo_State_t )
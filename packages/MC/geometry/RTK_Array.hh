@@ -76,6 +76,9 @@ class RTK_Array
     // Array dimensions.
     Vec_Dbl d_x, d_y, d_z;
 
+    // Inverse pitch in each dimension when the pitch is uniform, otherwise 0.
+    Space_Vector d_inv_pitch;
+
     // Coordinates in real space of lower-left coordinate of array.
     Space_Vector d_corner;
 
@@ -137,7 +140,7 @@ class RTK_Array
     void update_state(Geo_State_t &state) const;
 
     // Cross a surface.
-    void cross_surface(const Space_Vector &r, Geo_State_t &state);
+    void cross_surface(const Space_Vector &r, Geo_State_t &state) const;
 
     // Find the object a point is in.
     int find_object(const Space_Vector &r, Geo_State_t &state) const;
@@ -222,7 +225,7 @@ class RTK_Array
     typedef Vec_Int_Pair::const_iterator       Vec_Int_Pair_Itr;
 
     // Get object.
-    inline SP_Object object(const Geo_State_t &state) const;
+    inline const Object_t& object(const Geo_State_t &state) const;
 
     // Diagnostic output.
     void output(std::ostream &out, int level, int obj_id) const;
@@ -241,6 +244,13 @@ class RTK_Array
     // Build volumes.
     void build_volumes(Vec_Dbl &v, int offset) const;
 
+    // Find the logical index of a coordinate along one dimension.
+    inline int find_index(const Vec_Dbl &edges, double inv_pitch,
+                          double r) const;
+
+    // Inverse pitch along one dimension if it is uniform, otherwise 0.
+    static double uniform_inv_pitch(const Vec_Dbl &edges);
+
     // Return the widths by dimension.
     double dx(int i) const { return d_x[i+1] - d_x[i]; }
     double dy(int j) const { return d_y[j+1] - d_y[j]; }
@@ -252,15 +262,15 @@ class RTK_Array
 
     // Cross surface into next array element.
     inline void calc_high_face(Geo_State_t &state, int face_type,
-                               int exiting_face);
+                               int exiting_face) const;
     inline void calc_low_face(Geo_State_t &state, int face_type,
-                              int exiting_face);
+                              int exiting_face) const;
 
     // Determine boundary crossings at each level in the array.
-    void determine_boundary_crossings(Geo_State_t &state);
+    void determine_boundary_crossings(Geo_State_t &state) const;
 
     // Update the coordinates of each level in the array.
-    void update_coordinates(const Space_Vector &r, Geo_State_t &state);
+    void update_coordinates(const Space_Vector &r, Geo_State_t &state) const;
 
     // Calculate level.
     int d_level;
@@ -269,6 +279,39 @@ class RTK_Array
     bool d_completed;
 };
 
+//===========================================================================//
+/*!
+ * \struct RTK_Nested_Array
+ * \brief Type of an RTK_Array nested to a given number of levels.
+ *
+ * RTK_Nested_Array<1>::Array_t is an array of pin cells,
+ * RTK_Nested_Array<2>::Array_t is an array of arrays of pin cells, and so
+ * on.  Because arrays hold shared pointers to their objects, a repeated
+ * sub-assembly or assembly is stored once no matter how many times it is
+ * placed; deeper nesting keeps the memory proportional to the number of
+ * unique objects instead of flattening them into large arrays.
+ *
+ * The number of levels cannot exceed RTK_State::max_levels.
+ */
+//===========================================================================//
+
+template<int Levels>
+struct RTK_Nested_Array
+{
+    static_assert(Levels > 0 && Levels <= RTK_State::max_levels,
+                  "RTK nesting exceeds RTK_State::max_levels; reconfigure "
+                  "with a larger MC_RTK_MAX_LEVELS");
+
+    typedef RTK_Array<typename RTK_Nested_Array<Levels - 1>::Array_t> Array_t;
+};
+
+//! Single level of nesting (array of pin cells).
+template<>
+struct RTK_Nested_Array<1>
+{
+    typedef RTK_Array<RTK_Cell> Array_t;
+};
+
 } // end namespace profugus
 
 //---------------------------------------------------------------------------//
@@ -57,6 +57,45 @@ int RTK_Array<T>::index(int i,
     return i + d_N[0] * (j + k * d_N[1]);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Find the logical index of a coordinate along one dimension.
+ *
+ * A point on an interior edge is in the lower element, and a point on the
+ * low face of the array is in the first element.  When the pitch is uniform
+ * the index is computed directly and corrected for round-off against the
+ * edges; otherwise the edges are searched.
+ */
+template<class T>
+int RTK_Array<T>::find_index(const Vec_Dbl &edges,
+                             double         inv_pitch,
+                             double         r) const
+{
+    REQUIRE(r >= edges.front() && r <= edges.back());
+
+    const int N = edges.size() - 1;
+
+    int i = 0;
+    if (inv_pitch > 0.0)
+    {
+        i = static_cast<int>((r - edges[0]) * inv_pitch);
+        i = std::max(0, std::min(i, N - 1));
+
+        while (i > 0 && r <= edges[i])
+            --i;
+        while (i < N - 1 && r > edges[i+1])
+            ++i;
+    }
+    else
+    {
+        i = std::lower_bound(edges.begin(), edges.end(), r) - edges.begin();
+        i = std::max(i - 1, 0);
+    }
+
+    ENSURE(i >= 0 && i < N);
+    return i;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \brief Return the current material id.
@@ -64,7 +103,7 @@ int RTK_Array<T>::index(int i,
 template<class T>
 int RTK_Array<T>::matid(const Geo_State_t &state) const
 {
-    return object(state)->matid(state);
+    return object(state).matid(state);
 }
 
 //---------------------------------------------------------------------------//
@@ -74,8 +113,8 @@ int RTK_Array<T>::matid(const Geo_State_t &state) const
 template<class T>
 int RTK_Array<T>::cellid(const Geo_State_t &state) const
 {
-    REQUIRE(object(state)->cellid(state) < object(state)->num_cells());
-    return object(state)->cellid(state) + d_Nc_offset[
+    REQUIRE(object(state).cellid(state) < object(state).num_cells());
+    return object(state).cellid(state) + d_Nc_offset[
         index(state.level_coord[d_level][0],
               state.level_coord[d_level][1],
               state.level_coord[d_level][2])];
@@ -129,7 +168,7 @@ RTK_Array<T>::transform(const Space_Vector &r,
     Space_Vector lower, upper;
 
     // get the extents (we only need the lower)
-    object(state)->get_extents(lower, upper);
+    object(state).get_extents(lower, upper);
     CHECK(lower[X] == 0.0);
     CHECK(lower[Y] == 0.0);
     CHECK(lower[Z] == 0.0);
@@ -148,10 +187,13 @@ RTK_Array<T>::transform(const Space_Vector &r,
 
 //---------------------------------------------------------------------------//
 /*!
- * \brief Get an object.
+ * \brief Get the object a state is currently in.
+ *
+ * A reference is returned (rather than the stored shared pointer) so that
+ * tracking does not touch the shared reference count on every call.
  */
 template<class T>
-typename RTK_Array<T>::SP_Object
+const typename RTK_Array<T>::Object_t&
 RTK_Array<T>::object(const Geo_State_t &state) const
 {
     using def::X; using def::Y; using def::Z;
@@ -159,9 +201,9 @@ RTK_Array<T>::object(const Geo_State_t &state) const
     ENSURE(d_objects[d_layout[index(state.level_coord[d_level][X],
                                      state.level_coord[d_level][Y],
                                      state.level_coord[d_level][Z])]]);
-    return d_objects[d_layout[index(state.level_coord[d_level][X],
-                                    state.level_coord[d_level][Y],
-                                    state.level_coord[d_level][Z])]];
+    return *d_objects[d_layout[index(state.level_coord[d_level][X],
+                                     state.level_coord[d_level][Y],
+                                     state.level_coord[d_level][Z])]];
 }
 
 //---------------------------------------------------------------------------//
@@ -171,7 +213,7 @@ RTK_Array<T>::object(const Geo_State_t &state) const
 template<class T>
 void RTK_Array<T>::calc_low_face(Geo_State_t &state,
                                  int          face_type,
-                                 int          exiting_face)
+                                 int          exiting_face) const
 {
     // update the coordinates in this array
     state.level_coord[d_level][face_type]--;
@@ -192,7 +234,7 @@ void RTK_Array<T>::calc_low_face(Geo_State_t &state,
 template<class T>
 void RTK_Array<T>::calc_high_face(Geo_State_t &state,
                                   int          face_type,
-                                  int          exiting_face)
+                                  int          exiting_face) const
 {
     // update the coordinates in this array
     state.level_coord[d_level][face_type]++;
@@ -294,7 +336,7 @@ template<>
 inline int RTK_Array<RTK_Cell>::matid(const Geo_State_t &state) const
 {
     REQUIRE(d_level == 0);
-    return object(state)->matid(state.region);
+    return object(state).matid(state.region);
 }
 
 //---------------------------------------------------------------------------//
@@ -305,9 +347,9 @@ template<>
 inline int RTK_Array<RTK_Cell>::cellid(const Geo_State_t &state) const
 {
     REQUIRE(d_level == 0);
-    REQUIRE(object(state)->cell(state.region, state.segment) <
-             object(state)->num_cells());
-    return object(state)->cell(state.region, state.segment) + d_Nc_offset[
+    REQUIRE(object(state).cell(state.region, state.segment) <
+             object(state).num_cells());
+    return object(state).cell(state.region, state.segment) + d_Nc_offset[
         index(state.level_coord[d_level][0],
               state.level_coord[d_level][1],
               state.level_coord[d_level][2])];
@@ -330,7 +372,7 @@ RTK_Array<RTK_Cell>::transform(const Space_Vector &r,
     Space_Vector tr, lower, upper;
 
     // get the extents (we only need the lower)
-    object(state)->get_extents(lower, upper);
+    object(state).get_extents(lower, upper);
     CHECK(lower[X] < 0.0);
     CHECK(lower[Y] < 0.0);
 
@@ -368,11 +410,12 @@ template<>
 int RTK_Array<RTK_Cell>::calc_level();
 
 template<>
-void RTK_Array<RTK_Cell>::determine_boundary_crossings(Geo_State_t &state);
+void RTK_Array<RTK_Cell>::determine_boundary_crossings(
+    Geo_State_t &state) const;
 
 template<>
 void RTK_Array<RTK_Cell>::update_coordinates(const Space_Vector &r,
-                                             Geo_State_t &state);
+                                             Geo_State_t &state) const;
 
 template<>
 void RTK_Array<RTK_Cell>::output(std::ostream &out, int level,
@@ -37,6 +37,7 @@ RTK_Array<T>::RTK_Array(int Nx,
     , d_x(Nx + 1, 0.0)
     , d_y(Ny + 1, 0.0)
     , d_z(Nz + 1, 0.0)
+    , d_inv_pitch(0.0, 0.0, 0.0)
     , d_reflect(6, 0)
     , d_num_cells(d_N[0] * d_N[1] * d_N[2], 0)
     , d_Nc_offset(d_N[0] * d_N[1] * d_N[2] + 1, 0)
@@ -49,7 +50,10 @@ RTK_Array<T>::RTK_Array(int Nx,
     // calculate the level for quick access
     d_level = calc_level();
 
-    ENSURE(d_level < Geo_State_t::max_levels);
+    VALIDATE(d_level < Geo_State_t::max_levels, "RTK array has "
+             << d_level + 1 << " levels but at most "
+             << Geo_State_t::max_levels << " are supported; reconfigure "
+             << "with a larger MC_RTK_MAX_LEVELS.");
     ENSURE(d_layout.size() == size());
     ENSURE(size() > 0);
 }
@@ -192,6 +196,11 @@ void RTK_Array<T>::complete(double low_x,
     d_length[Y] = d_y.back() - low_y;
     d_length[Z] = d_z.back() - low_z;
 
+    // use direct index computation in find_object along uniform dimensions
+    d_inv_pitch[X] = uniform_inv_pitch(d_x);
+    d_inv_pitch[Y] = uniform_inv_pitch(d_y);
+    d_inv_pitch[Z] = uniform_inv_pitch(d_z);
+
     // count cells at each level
     count_cells();
 
@@ -387,7 +396,7 @@ void RTK_Array<T>::distance_to_boundary(const Space_Vector &r,
     Space_Vector tr = transform(r, state);
 
     // dive through objects until we hit the pin-cell
-    object(state)->distance_to_boundary(tr, omega, state);
+    object(state).distance_to_boundary(tr, omega, state);
 }
 
 //---------------------------------------------------------------------------//
@@ -431,7 +440,7 @@ void RTK_Array<T>::update_state(Geo_State_t &state) const
 
     // update the state of the current object if it has not escaped
     if (state.escaping_face == Geo_State_t::NONE)
-        object(state)->update_state(state);
+        object(state).update_state(state);
 }
 
 //---------------------------------------------------------------------------//
@@ -440,7 +449,7 @@ void RTK_Array<T>::update_state(Geo_State_t &state) const
  */
 template<class T>
 void RTK_Array<T>::cross_surface(const Space_Vector &r,
-                                 Geo_State_t        &state)
+                                 Geo_State_t        &state) const
 {
     using def::X; using def::Y; using def::Z;
 
@@ -543,40 +552,10 @@ int RTK_Array<T>::find_object(const Space_Vector &r,
     REQUIRE(r[Y] >= d_y.front()); REQUIRE(r[Y] <= d_y.back());
     REQUIRE(r[Z] >= d_z.front()); REQUIRE(r[Z] <= d_z.back());
 
-    // iterators
-    int                     i,j,k;
-    Vec_Dbl::const_iterator itr, jtr, ktr;
-
     // find the logical indices of the object in the array
-    itr = std::lower_bound(d_x.begin(), d_x.end(), r[X]);
-    i   = itr - d_x.begin() - 1;
-    jtr = std::lower_bound(d_y.begin(), d_y.end(), r[Y]);
-    j   = jtr - d_y.begin() - 1;
-    ktr = std::lower_bound(d_z.begin(), d_z.end(), r[Z]);
-    k   = ktr - d_z.begin() - 1;
-
-    // check for particles on the low face of the array
-    if (r[X] == d_x[0])
-    {
-        CHECK(itr == d_x.begin());
-
-        // reset index
-        i = 0;
-    }
-    if (r[Y] == d_y[0])
-    {
-        CHECK(jtr == d_y.begin());
-
-        // reset index
-        j = 0;
-    }
-    if (r[Z] == d_z[0])
-    {
-        CHECK(ktr == d_z.begin());
-
-        // reset index
-        k = 0;
-    }
+    int i = find_index(d_x, d_inv_pitch[X], r[X]);
+    int j = find_index(d_y, d_inv_pitch[Y], r[Y]);
+    int k = find_index(d_z, d_inv_pitch[Z], r[Z]);
 
     CHECK(i >= 0 && i < d_N[X]);
     CHECK(j >= 0 && j < d_N[Y]);
@@ -742,19 +721,40 @@ int RTK_Array<T>::num_regions() const
 
 //---------------------------------------------------------------------------//
 // PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Inverse pitch along one dimension if it is uniform, otherwise 0.
+ */
+template<class T>
+double RTK_Array<T>::uniform_inv_pitch(const Vec_Dbl &edges)
+{
+    REQUIRE(edges.size() > 1);
+
+    double pitch = (edges.back() - edges.front()) / (edges.size() - 1);
+    CHECK(pitch > 0.0);
+
+    for (int i = 0, N = edges.size() - 1; i < N; ++i)
+    {
+        if (!soft_equiv(edges[i+1] - edges[i], pitch, 1.0e-12))
+            return 0.0;
+    }
+
+    return 1.0 / pitch;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \brief Determine boundary crossings at each level starting at the lowest.
  */
 template<class T>
-void RTK_Array<T>::determine_boundary_crossings(Geo_State_t &state)
+void RTK_Array<T>::determine_boundary_crossings(Geo_State_t &state) const
 {
     using def::X; using def::Y; using def::Z;
 
     REQUIRE(d_level > 0);
 
     // dive into the object and see if it crosses a boundary
-    object(state)->determine_boundary_crossings(state);
+    object(state).determine_boundary_crossings(state);
 
     // process particles that cross an array boundary on the previous level,
     // they may cross a boundary at this level as well
@@ -794,7 +794,7 @@ void RTK_Array<T>::determine_boundary_crossings(Geo_State_t &state)
  */
 template<class T>
 void RTK_Array<T>::update_coordinates(const Space_Vector &r,
-                                      Geo_State_t        &state)
+                                      Geo_State_t        &state) const
 {
     using def::X; using def::Y; using def::Z;
 
@@ -810,34 +810,34 @@ void RTK_Array<T>::update_coordinates(const Space_Vector &r,
         {
             // update the coordinates of the object across the given face
             case Geo_State_t::MINUS_X:
-                object(state)->find_object_on_boundary(
+                object(state).find_object_on_boundary(
                     tr, Geo_State_t::PLUS_X, X, state);
                 break;
             case Geo_State_t::PLUS_X:
-                object(state)->find_object_on_boundary(
+                object(state).find_object_on_boundary(
                     tr, Geo_State_t::MINUS_X, X, state);
                 break;
             case Geo_State_t::MINUS_Y:
-                object(state)->find_object_on_boundary(
+                object(state).find_object_on_boundary(
                     tr, Geo_State_t::PLUS_Y, Y, state);
                 break;
             case Geo_State_t::PLUS_Y:
-                object(state)->find_object_on_boundary(
+                object(state).find_object_on_boundary(
                     tr, Geo_State_t::MINUS_Y, Y, state);
                 break;
             case Geo_State_t::MINUS_Z:
-                object(state)->find_object_on_boundary(
+                object(state).find_object_on_boundary(
                     tr, Geo_State_t::PLUS_Z, Z, state);
                 break;
             case Geo_State_t::PLUS_Z:
-                object(state)->find_object_on_boundary(
+                object(state).find_object_on_boundary(
                     tr, Geo_State_t::MINUS_Z, Z, state);
                 break;
         }
     }
 
     // go to child object and recursively update all coordinates
-    object(state)->update_coordinates(tr, state);
+    object(state).update_coordinates(tr, state);
 }
 
 //---------------------------------------------------------------------------//
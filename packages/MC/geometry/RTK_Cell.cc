@@ -35,6 +35,7 @@ RTK_Cell::RTK_Cell(int    mod_id,
     : d_mod_id(mod_id)
     , d_r(0)
     , d_ids(0)
+    , d_r2(squared(d_r))
     , d_z(height)
     , d_num_shells(0)
     , d_num_regions(1)
@@ -71,6 +72,7 @@ RTK_Cell::RTK_Cell(int    mod_id,
     : d_mod_id(mod_id)
     , d_r(0)
     , d_ids(0)
+    , d_r2(squared(d_r))
     , d_z(height)
     , d_num_shells(0)
     , d_num_regions(1)
@@ -108,6 +110,7 @@ RTK_Cell::RTK_Cell(int    fuel_id,
     : d_mod_id(mod_id)
     , d_r(1, r)
     , d_ids(1, fuel_id)
+    , d_r2(squared(d_r))
     , d_z(height)
     , d_num_shells(d_r.size())
     , d_num_regions(d_num_shells + 1)
@@ -149,6 +152,7 @@ RTK_Cell::RTK_Cell(const Vec_Int &ids,
     : d_mod_id(mod_id)
     , d_r(r)
     , d_ids(ids)
+    , d_r2(squared(d_r))
     , d_z(height)
     , d_num_shells(d_r.size())
     , d_num_regions(d_num_shells + 1)
@@ -195,6 +199,7 @@ RTK_Cell::RTK_Cell(const Vec_Int    &ids,
     : d_mod_id(mod_id)
     , d_r(r)
     , d_ids(ids)
+    , d_r2(squared(d_r))
     , d_z(height)
     , d_num_shells(d_r.size())
     , d_num_regions(d_num_shells + 1)
@@ -243,6 +248,7 @@ RTK_Cell::RTK_Cell(int               mod_id,
     : d_mod_id(mod_id)
     , d_r(0)
     , d_ids(0)
+    , d_r2(squared(d_r))
     , d_z(height)
     , d_num_shells(0)
     , d_num_regions(1)
@@ -352,6 +358,7 @@ RTK_Cell::RTK_Cell(int    mod_id,
     : d_mod_id(mod_id)
     , d_r(0)
     , d_ids(0)
+    , d_r2(squared(d_r))
     , d_z(height)
     , d_num_shells(0)
     , d_num_regions(1)
@@ -473,7 +480,7 @@ void RTK_Cell::initialize(const Space_Vector &r,
  */
 void RTK_Cell::distance_to_boundary(const Space_Vector &r,
                                     const Space_Vector &omega,
-                                    Geo_State_t        &state)
+                                    Geo_State_t        &state) const
 {
     using def::X; using def::Y; using def::Z;
 
@@ -486,8 +493,7 @@ void RTK_Cell::distance_to_boundary(const Space_Vector &r,
     REQUIRE(omega[Z]<0.0 ? r[Z] >= 0.0             : r[Z] <= d_z);
 
     // initialize running dist-to-boundary
-    d_db                      = constants::huge;
-    state.dist_to_next_region = d_db;
+    state.dist_to_next_region = constants::huge;
     state.next_segment        = state.segment;
 
     // >>> CHECK FOR INTERSECTIONS WITH OUTSIDE BOX
@@ -513,33 +519,35 @@ void RTK_Cell::distance_to_boundary(const Space_Vector &r,
     // crossing a segment does not enter a different region
     if (d_segments > 1)
     {
-        // initialize distance to boundary
-        d_db = constants::huge;
+        // distance, face, and segment of the nearest segment plane
+        double db      = constants::huge;
+        int    face    = Geo_State_t::NONE;
+        int    segment = state.segment;
 
         // check for intersection with x segment planes
         if (state.face != d_num_shells)
         {
             if (omega[X] > 0.0 && r[X] < 0.0)
             {
-                d_db      = -r[X] / omega[X];
-                d_face    = d_num_shells;
-                d_segment = state.segment - 1;
+                db      = -r[X] / omega[X];
+                face    = d_num_shells;
+                segment = state.segment - 1;
             }
             else if (omega[X] < 0.0 && r[X] > 0.0)
             {
-                d_db      = -r[X] / omega[X];
-                d_face    = d_num_shells;
-                d_segment = state.segment + 1;
+                db      = -r[X] / omega[X];
+                face    = d_num_shells;
+                segment = state.segment + 1;
             }
 
             // update distance to boundary info
-            if (d_db < state.dist_to_next_region)
+            if (db < state.dist_to_next_region)
             {
-                state.dist_to_next_region = d_db;
+                state.dist_to_next_region = db;
                 state.exiting_face        = Geo_State_t::INTERNAL;
-                state.next_face           = d_face;
+                state.next_face           = face;
                 state.next_region         = state.region;
-                state.next_segment        = d_segment;
+                state.next_segment        = segment;
             }
         }
 
@@ -548,25 +556,25 @@ void RTK_Cell::distance_to_boundary(const Space_Vector &r,
         {
             if (omega[Y] > 0.0 && r[Y] < 0.0)
             {
-                d_db      = -r[Y] / omega[Y];
-                d_face    = d_num_shells + 1;
-                d_segment = state.segment - 2;
+                db      = -r[Y] / omega[Y];
+                face    = d_num_shells + 1;
+                segment = state.segment - 2;
             }
             else if (omega[Y] < 0.0 && r[Y] > 0.0)
             {
-                d_db      = -r[Y] / omega[Y];
-                d_face    = d_num_shells + 1;
-                d_segment = state.segment + 2;
+                db      = -r[Y] / omega[Y];
+                face    = d_num_shells + 1;
+                segment = state.segment + 2;
             }
 
             // update distance to boundary info
-            if (d_db < state.dist_to_next_region)
+            if (db < state.dist_to_next_region)
             {
-                state.dist_to_next_region = d_db;
+                state.dist_to_next_region = db;
                 state.exiting_face        = Geo_State_t::INTERNAL;
-                state.next_face           = d_face;
+                state.next_face           = face;
                 state.next_region         = state.region;
-                state.next_segment        = d_segment;
+                state.next_segment        = segment;
             }
         }
     }
@@ -674,15 +682,18 @@ int RTK_Cell::region(double x,
     // calculate rp
     double rp2 = x*x + y*y;
 
-    // loop through shells to find the containing shell
-    for (int n = 0; n < d_num_shells; ++n)
+    // the shells are increasing, so the containing shell is the number of
+    // shells inside the point; this is a branch-free pass over all shells
+    const double *r2 = d_r2.data();
+    int n = 0;
+    for (int s = 0; s < d_num_shells; ++s)
     {
-        if (rp2 <= d_r[n] * d_r[n]) return n;
+        n += rp2 > r2[s];
     }
 
-    // point is in the moderator region
-    ENSURE(rp2 > d_r[d_num_shells-1]*d_r[d_num_shells-1]);
-    return d_num_regions - 1;
+    // n == d_num_shells is the moderator region
+    ENSURE(n == d_num_shells ? rp2 > d_r2.back() : rp2 <= d_r2[n]);
+    return n;
 }
 
 //---------------------------------------------------------------------------//
@@ -829,7 +840,7 @@ void RTK_Cell::output(std::ostream &out,
  */
 void RTK_Cell::dist_to_vessel(const Space_Vector &r,
                               const Space_Vector &omega,
-                              Geo_State_t        &state)
+                              Geo_State_t        &state) const
 {
     using def::X; using def::Y;
 
@@ -848,18 +859,19 @@ void RTK_Cell::dist_to_vessel(const Space_Vector &r,
     if (d_inner)
     {
         // only check if we aren't currently on the vessel face
+        double db = -1.0;
         if (state.face != Geo_State_t::R0_VESSEL)
         {
-            dist_to_shell(l2g(r[X], X), l2g(r[Y], Y), omega[X], omega[Y], d_R0,
-                          Geo_State_t::R0_VESSEL);
+            db = dist_to_shell(l2g(r[X], X), l2g(r[Y], Y), omega[X],
+                               omega[Y], d_R0, Geo_State_t::R0_VESSEL);
         }
 
         // update the distance to boundary
-        if (d_db > 0.0)
+        if (db > 0.0)
         {
-            if (d_db < state.dist_to_next_region)
+            if (db < state.dist_to_next_region)
             {
-                state.dist_to_next_region = d_db;
+                state.dist_to_next_region = db;
                 state.next_face           = Geo_State_t::R0_VESSEL;
                 state.exiting_face        = Geo_State_t::INTERNAL;
                 hit                       = true;
@@ -871,18 +883,19 @@ void RTK_Cell::dist_to_vessel(const Space_Vector &r,
     if (d_outer)
     {
         // only check if we aren't currently on the vessel face
+        double db = -1.0;
         if (state.face != Geo_State_t::R1_VESSEL)
         {
-            dist_to_shell(l2g(r[X], X), l2g(r[Y], Y), omega[X], omega[Y], d_R1,
-                          Geo_State_t::R1_VESSEL);
+            db = dist_to_shell(l2g(r[X], X), l2g(r[Y], Y), omega[X],
+                               omega[Y], d_R1, Geo_State_t::R1_VESSEL);
         }
 
         // update the distance to boundary
-        if (d_db > 0.0)
+        if (db > 0.0)
         {
-            if (d_db < state.dist_to_next_region)
+            if (db < state.dist_to_next_region)
             {
-                state.dist_to_next_region = d_db;
+                state.dist_to_next_region = db;
                 state.next_face           = Geo_State_t::R1_VESSEL;
                 state.exiting_face        = Geo_State_t::INTERNAL;
                 hit                       = true;
@@ -911,10 +924,15 @@ void RTK_Cell::dist_to_vessel(const Space_Vector &r,
  */
 void RTK_Cell::calc_shell_db(const Space_Vector &r,
                              const Space_Vector &omega,
-                             Geo_State_t        &state)
+                             Geo_State_t        &state) const
 {
+    using def::X; using def::Y;
+
     REQUIRE(d_num_shells > 0);
 
+    // the quadratic terms that are the same for every shell
+    const Ray_Terms ray = ray_terms(r[X], r[Y], omega[X], omega[Y]);
+
     // if we are on a face then check both bounding faces
     if (state.face < d_num_shells)
     {
@@ -922,13 +940,13 @@ void RTK_Cell::calc_shell_db(const Space_Vector &r,
         // that we would traverse through that shells region on entrance
         if (state.region == state.face)
         {
-            check_shell(r, omega, state.face, state.face, state.region + 1,
-                        state.face, state);
+            double db = check_shell(ray, state.face, state.face,
+                                    state.region + 1, state.face, state);
 
             // if we can't hit the shell because of a glancing shot + floating
             // point error, update the region since we won't traverse the
             // shell
-            if (d_db < 0.0)
+            if (db < 0.0)
             {
                 state.region++;
             }
@@ -938,7 +956,7 @@ void RTK_Cell::calc_shell_db(const Space_Vector &r,
         // as we aren't on the last face
         if (state.face < d_num_shells - 1)
         {
-            check_shell(r, omega, state.face + 1, Geo_State_t::NONE,
+            check_shell(ray, state.face + 1, Geo_State_t::NONE,
                         state.region + 1, state.face + 1, state);
         }
 
@@ -946,7 +964,7 @@ void RTK_Cell::calc_shell_db(const Space_Vector &r,
         // we aren't on the first face
         if (state.face > 0)
         {
-            check_shell(r, omega, state.face - 1, Geo_State_t::NONE,
+            check_shell(ray, state.face - 1, Geo_State_t::NONE,
                         state.region - 1, state.face - 1, state);
         }
     }
@@ -958,14 +976,14 @@ void RTK_Cell::calc_shell_db(const Space_Vector &r,
         if (state.region == 0)
         {
             // we can only hit the lowest shell
-            check_shell(r, omega, 0, Geo_State_t::NONE, 1, 0, state);
+            check_shell(ray, 0, Geo_State_t::NONE, 1, 0, state);
         }
 
         // check for hitting highest shell
         else if (state.region == d_mod_region)
         {
             // we can only hit the outer shell
-            check_shell(r, omega, d_num_shells - 1, Geo_State_t::NONE,
+            check_shell(ray, d_num_shells - 1, Geo_State_t::NONE,
                         d_num_shells - 1, d_num_shells - 1, state);
         }
 
@@ -975,11 +993,11 @@ void RTK_Cell::calc_shell_db(const Space_Vector &r,
             CHECK(state.region - 1 >= 0);
 
             // check hitting lower shell
-            check_shell(r, omega, state.region - 1, Geo_State_t::NONE,
+            check_shell(ray, state.region - 1, Geo_State_t::NONE,
                         state.region - 1, state.region - 1, state);
 
             // check hitting higher shell
-            check_shell(r, omega, state.region, Geo_State_t::NONE,
+            check_shell(ray, state.region, Geo_State_t::NONE,
                         state.region + 1, state.region, state);
         }
     }
@@ -988,86 +1006,64 @@ void RTK_Cell::calc_shell_db(const Space_Vector &r,
 //---------------------------------------------------------------------------//
 /*!
  * \brief Check a shell for distance to boundary.
+ *
+ * \return distance to the shell (negative if it is not intersected)
  */
-void RTK_Cell::check_shell(const Space_Vector &r,
-                           const Space_Vector &omega,
-                           int                 shell,
-                           int                 face,
-                           int                 next_region,
-                           int                 next_face,
-                           Geo_State_t        &state)
+double RTK_Cell::check_shell(const Ray_Terms &ray,
+                             int              shell,
+                             int              face,
+                             int              next_region,
+                             int              next_face,
+                             Geo_State_t     &state) const
 {
-    using def::X; using def::Y; using def::Z;
-
     REQUIRE(shell >= 0 && shell < d_num_shells);
 
     // calculate the distance to the requested shell
-    dist_to_shell(r[X], r[Y], omega[X], omega[Y], d_r[shell], face);
+    double db = dist_to_shell(ray, d_r2[shell], face);
 
     // check the distance to boundary
     //    a) if it intersects the shell, and
     //    b) if it is the smallest distance
-    if (d_db > 0.0)
+    if (db > 0.0)
     {
-        if (d_db < state.dist_to_next_region)
+        if (db < state.dist_to_next_region)
         {
-            state.dist_to_next_region = d_db;
+            state.dist_to_next_region = db;
             state.next_region         = next_region;
             state.next_face           = next_face;
             state.exiting_face        = Geo_State_t::INTERNAL;
         }
     }
+
+    return db;
 }
 
 //---------------------------------------------------------------------------//
 /*!
  * \brief Distance to a shell.
  *
- * d_db is set negative if there is no intersection with the shell.
+ * \return distance to the shell, negative if there is no intersection
  */
-void RTK_Cell::dist_to_shell(double x,
-                             double y,
-                             double omega_x,
-                             double omega_y,
-                             double r,
-                             int    face)
+double RTK_Cell::dist_to_shell(double x,
+                               double y,
+                               double omega_x,
+                               double omega_y,
+                               double r,
+                               int    face) const
 {
-    // initialize distance to boundary
-    d_db = -1.0;
-
-    // calculate terms in the quadratic
-    double a = omega_x * omega_x + omega_y * omega_y;
-    double b = 2.0 * (x * omega_x + y * omega_y);
-    double c = x * x + y * y - r * r;
-
-    // discriminant of quadratic
-    double discriminant = b * b - 4.0 * a * c;
-
-    // check for intersection with the surface anywhere along the line which
-    // will be true if the discriminant > 0.0 (of course that doesn't mean the
-    // ray will intersect the surface, just the line that the ray is on
-    // intersects the surface)
-    if (discriminant >= 0.0)
-    {
-        // calculate the sqrt of the discriminant and denominator once
-        double sqr_root    = std::sqrt(discriminant);
-        double denominator = 0.5 / a;
-
-        // calculate the roots of the equation
-        double d1 = (-b + sqr_root) * denominator;
-        double d2 = (-b - sqr_root) * denominator;
-
-        // determine d, if both d1 and d2 < 0 then the ray does not intersect
-        // the surface
-        if (d1 < 0.0)
-            d_db = d2;
-        else if (d2 < 0.0)
-            d_db = d1;
-        else if (face < d_num_shells)
-            d_db = std::max(d1, d2);
-        else
-            d_db = std::min(d1, d2);
-    }
+    return dist_to_shell(ray_terms(x, y, omega_x, omega_y), r * r, face);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Squared radii.
+ */
+RTK_Cell::Vec_Dbl RTK_Cell::squared(const Vec_Dbl &r)
+{
+    Vec_Dbl r2(r.size());
+    for (int n = 0, N = r.size(); n < N; ++n)
+        r2[n] = r[n] * r[n];
+    return r2;
 }
 
 //---------------------------------------------------------------------------//
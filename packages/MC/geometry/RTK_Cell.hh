@@ -11,6 +11,8 @@
 #ifndef MC_geometry_RTK_Cell_hh
 #define MC_geometry_RTK_Cell_hh
 
+#include <algorithm>
+#include <cmath>
 #include <ostream>
 #include <vector>
 
@@ -104,6 +106,9 @@ class RTK_Cell
     Vec_Dbl d_r;
     Vec_Int d_ids;
 
+    // Squared shell radii.
+    Vec_Dbl d_r2;
+
     // Radial dimensions (pitch).
     Vector_Lite<double, 2> d_xy;
 
@@ -138,7 +143,7 @@ class RTK_Cell
     // Track to next boundary.
     void distance_to_boundary(const Space_Vector &r,
                               const Space_Vector &omega,
-                              Geo_State_t &state);
+                              Geo_State_t &state) const;
 
     // Update a state at collision sites.
     void update_state(Geo_State_t &state) const;
@@ -208,27 +213,45 @@ class RTK_Cell
   private:
     // >>> IMPLEMENTATION
 
+    // Terms of the ray/cylinder quadratic that do not depend on the radius.
+    struct Ray_Terms
+    {
+        double a;    // omega_x^2 + omega_y^2
+        double b;    // 2 (x omega_x + y omega_y)
+        double rho2; // x^2 + y^2
+    };
+
+    // Calculate the radius-independent quadratic terms for a ray.
+    static inline Ray_Terms ray_terms(double x, double y, double omega_x,
+                                      double omega_y);
+
+    // Squared radii.
+    static Vec_Dbl squared(const Vec_Dbl &r);
+
     // Intersections with shells.
     void calc_shell_db(const Space_Vector &r, const Space_Vector &omega,
-                       Geo_State_t &state);
+                       Geo_State_t &state) const;
 
     // Distance to external surface.
     inline void dist_to_radial_face(int axis, double p, double dir,
-                                    Geo_State_t &state);
-    inline void dist_to_axial_face(double p, double dir, Geo_State_t &state);
+                                    Geo_State_t &state) const;
+    inline void dist_to_axial_face(double p, double dir,
+                                   Geo_State_t &state) const;
 
     // Distance to vessel.
     void dist_to_vessel(const Space_Vector &r, const Space_Vector &omega,
-                        Geo_State_t &state);
+                        Geo_State_t &state) const;
 
     // Distance to a shell.
-    void dist_to_shell(double x, double y, double omega_x, double omega_y,
-                       double r, int face);
+    double dist_to_shell(double x, double y, double omega_x, double omega_y,
+                         double r, int face) const;
+    inline double dist_to_shell(const Ray_Terms &ray, double r2,
+                                int face) const;
 
     // Update state if it hits a shell.
-    void check_shell(const Space_Vector &r, const Space_Vector &omega,
-                     int shell, int face, int next_region, int next_face,
-                     Geo_State_t &state);
+    double check_shell(const Ray_Terms &ray, int shell, int face,
+                       int next_region, int next_face,
+                       Geo_State_t &state) const;
 
     // Transform to vessel coordinates.
     double l2g(double local, int dir) const
@@ -259,11 +282,6 @@ class RTK_Cell
     // Number of cells.
     int d_num_cells;
 
-    // Work variables.
-    double d_db;
-    int    d_face;
-    int    d_segment;
-
     // Vessel parameters.
     bool d_vessel;         // indicates this cell has a vessel
     double d_offsets[2];   // radial offsets from origin of outer rtk-array to
@@ -101,26 +101,32 @@ int RTK_Cell::matid(int region) const
 void RTK_Cell::dist_to_radial_face(int          axis,
                                    double       p,
                                    double       dir,
-                                   Geo_State_t &state)
+                                   Geo_State_t &state) const
 {
+    // a direction parallel to the faces never intersects them
+    if (dir == 0.0)
+        return;
+
     // check high/low faces
+    double db   = 0.0;
+    int    face = Geo_State_t::NONE;
     if (dir > 0.0)
     {
-        d_db   = (d_extent[axis][HI] - p) / dir;
-        d_face = Geo_State_t::plus_face[axis];
+        db   = (d_extent[axis][HI] - p) / dir;
+        face = Geo_State_t::plus_face[axis];
     }
-    else if (dir < 0.0)
+    else
     {
-        d_db   = (d_extent[axis][LO] - p) / dir;
-        d_face = Geo_State_t::minus_face[axis];
+        db   = (d_extent[axis][LO] - p) / dir;
+        face = Geo_State_t::minus_face[axis];
     }
-    CHECK(d_db >= 0.0);
+    CHECK(db >= 0.0);
 
     // updated distance to boundary info
-    if (d_db < state.dist_to_next_region)
+    if (db < state.dist_to_next_region)
     {
-        state.dist_to_next_region = d_db;
-        state.exiting_face        = d_face;
+        state.dist_to_next_region = db;
+        state.exiting_face        = face;
         state.next_face           = Geo_State_t::NONE;
     }
 }
@@ -131,30 +137,98 @@ void RTK_Cell::dist_to_radial_face(int          axis,
  */
 void RTK_Cell::dist_to_axial_face(double       p,
                                   double       dir,
-                                  Geo_State_t &state)
+                                  Geo_State_t &state) const
 {
+    // a direction parallel to the faces never intersects them
+    if (dir == 0.0)
+        return;
+
     // check high/low faces
+    double db   = 0.0;
+    int    face = Geo_State_t::NONE;
     if (dir > 0.0)
     {
-        d_db   = (d_z - p) / dir;
-        d_face = Geo_State_t::PLUS_Z;
+        db   = (d_z - p) / dir;
+        face = Geo_State_t::PLUS_Z;
     }
-    else if (dir < 0.0)
+    else
     {
-        d_db   = -p / dir;
-        d_face = Geo_State_t::MINUS_Z;
+        db   = -p / dir;
+        face = Geo_State_t::MINUS_Z;
     }
-    CHECK(d_db >= 0.0);
+    CHECK(db >= 0.0);
 
     // updated distance to boundary info
-    if (d_db < state.dist_to_next_region)
+    if (db < state.dist_to_next_region)
     {
-        state.dist_to_next_region = d_db;
-        state.exiting_face        = d_face;
+        state.dist_to_next_region = db;
+        state.exiting_face        = face;
         state.next_face           = Geo_State_t::NONE;
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Calculate the radius-independent quadratic terms for a ray.
+ */
+RTK_Cell::Ray_Terms RTK_Cell::ray_terms(double x,
+                                        double y,
+                                        double omega_x,
+                                        double omega_y)
+{
+    Ray_Terms ray;
+    ray.a    = omega_x * omega_x + omega_y * omega_y;
+    ray.b    = 2.0 * (x * omega_x + y * omega_y);
+    ray.rho2 = x * x + y * y;
+    return ray;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Distance to a shell given the ray terms and the squared radius.
+ *
+ * \return distance to the shell, negative if there is no intersection
+ */
+double RTK_Cell::dist_to_shell(const Ray_Terms &ray,
+                               double           r2,
+                               int              face) const
+{
+    // initialize distance to boundary
+    double db = -1.0;
+
+    // discriminant of quadratic
+    double c            = ray.rho2 - r2;
+    double discriminant = ray.b * ray.b - 4.0 * ray.a * c;
+
+    // check for intersection with the surface anywhere along the line which
+    // will be true if the discriminant > 0.0 (of course that doesn't mean the
+    // ray will intersect the surface, just the line that the ray is on
+    // intersects the surface)
+    if (discriminant >= 0.0)
+    {
+        // calculate the sqrt of the discriminant and denominator once
+        double sqr_root    = std::sqrt(discriminant);
+        double denominator = 0.5 / ray.a;
+
+        // calculate the roots of the equation
+        double d1 = (-ray.b + sqr_root) * denominator;
+        double d2 = (-ray.b - sqr_root) * denominator;
+
+        // determine d, if both d1 and d2 < 0 then the ray does not intersect
+        // the surface
+        if (d1 < 0.0)
+            db = d2;
+        else if (d2 < 0.0)
+            db = d1;
+        else if (face < d_num_shells)
+            db = std::max(d1, d2);
+        else
+            db = std::min(d1, d2);
+    }
+
+    return db;
+}
+
 //---------------------------------------------------------------------------//
 /*
  * \brief Get the extents in the current reference frame
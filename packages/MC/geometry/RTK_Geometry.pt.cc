@@ -15,6 +15,10 @@ namespace profugus
 
 template class RTK_Geometry< RTK_Array<RTK_Cell> >;
 template class RTK_Geometry< RTK_Array< RTK_Array<RTK_Cell> > >;
+template class RTK_Geometry< RTK_Array< RTK_Array< RTK_Array<RTK_Cell> > > >;
+
+// Deeper nestings (MC_RTK_MAX_LEVELS > 3) are instantiated by clients that
+// include RTK_Array.t.hh and RTK_Geometry.t.hh.
 
 } // end namespace profugus
 
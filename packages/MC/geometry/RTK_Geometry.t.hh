@@ -110,7 +110,7 @@ void RTK_Geometry<Array>::initialize(const Space_Vector &r,
  * surface
  */
 template<class Array>
-bool RTK_Geometry<Array>::reflect(Geo_State_t &state)
+bool RTK_Geometry<Array>::reflect(Geo_State_t &state) const
 {
     using def::X; using def::Y; using def::Z;
 
@@ -11,7 +11,7 @@
 #ifndef MC_geometry_RTK_State_hh
 #define MC_geometry_RTK_State_hh
 
-#include <Utils/config.h>
+#include <MC/config.h>
 #include "utils/Vector_Lite.hh"
 #include "utils/Definitions.hh"
 
@@ -25,6 +25,12 @@ namespace profugus
  *
  * The RTK_State is a handle into the basic RTK core geometry package that
  * describes the position and state of a particle at any point in time.
+ *
+ * The state stores the logical coordinates of the particle in each level of
+ * nested profugus::RTK_Array objects, so the deepest supported nesting is
+ * fixed at compile time by max_levels.  It is set with the \c
+ * MC_RTK_MAX_LEVELS configure option (default 3: core, assembly, and
+ * sub-assembly arrays of pin cells).
  */
 //===========================================================================//
 
@@ -39,7 +45,10 @@ struct RTK_State
     // >>> REQUIRED DEFINITIONS
 
     // Pack the geometric state.
-    static int packed_bytes() { return (16 * SIZEOF_INT + 6 * SIZEOF_DOUBLE); }
+    static int packed_bytes()
+    {
+        return ((7 + 3 * max_levels) * SIZEOF_INT + 6 * SIZEOF_DOUBLE);
+    }
     void pack(char *buffer) const;
 
     // Unpack the geometric state.
@@ -78,7 +87,7 @@ struct RTK_State
     int exiting_face;
 
     //! Max levels supported.
-    static const int max_levels = 3;
+    static const int max_levels = MC_RTK_MAX_LEVELS;
 
     //! Coordinates in array at each level.
     Vector_Lite<Vector_Lite<int, 3>, max_levels> level_coord;
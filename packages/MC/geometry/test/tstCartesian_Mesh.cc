@@ -12,6 +12,12 @@
 
 #include "gtest/utils_gtest.hh"
 
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "utils/Vector_Functions.hh"
+
 using profugus::Cartesian_Mesh;
 using def::I; using def::J; using def::K;
 
@@ -135,6 +141,97 @@ TEST_F(CartesianMeshTest, find)
     EXPECT_EQ(2 , ijk[K]);
 }
 
+//---------------------------------------------------------------------------//
+
+TEST_F(CartesianMeshTest, segment)
+{
+    typedef std::vector<std::pair<size_type, double>> Segments;
+
+    Mesh_t mesh(x, y, z);
+
+    Segments segs;
+    auto score = [&segs](size_type cell, double d)
+    {
+        segs.push_back(std::make_pair(cell, d));
+    };
+
+    // ray along +x that starts and ends outside of the mesh
+    mesh.segment(Space_Vector(-0.1, 0.1, 0.05), Space_Vector(1.0, 0.0, 0.0),
+                 1.0, score);
+    ASSERT_EQ(4, segs.size());
+    EXPECT_EQ(mesh.index(0, 0, 1), segs[0].first);
+    EXPECT_EQ(mesh.index(1, 0, 1), segs[1].first);
+    EXPECT_EQ(mesh.index(2, 0, 1), segs[2].first);
+    EXPECT_EQ(mesh.index(3, 0, 1), segs[3].first);
+    EXPECT_SOFTEQ(0.10, segs[0].second, 1.e-12);
+    EXPECT_SOFTEQ(0.15, segs[1].second, 1.e-12);
+    EXPECT_SOFTEQ(0.05, segs[2].second, 1.e-12);
+    EXPECT_SOFTEQ(0.12, segs[3].second, 1.e-12);
+
+    // ray along -y that starts on an edge and ends inside the mesh
+    segs.clear();
+    mesh.segment(Space_Vector(0.2, 0.4, 0.2), Space_Vector(0.0, -1.0, 0.0),
+                 0.3, score);
+    ASSERT_EQ(2, segs.size());
+    EXPECT_EQ(mesh.index(1, 1, 2), segs[0].first);
+    EXPECT_EQ(mesh.index(1, 0, 2), segs[1].first);
+    EXPECT_SOFTEQ(0.2, segs[0].second, 1.e-12);
+    EXPECT_SOFTEQ(0.1, segs[1].second, 1.e-12);
+
+    // ray that misses the mesh
+    segs.clear();
+    mesh.segment(Space_Vector(-0.1, 0.1, 0.05), Space_Vector(-1.0, 0.0, 0.0),
+                 1.0, score);
+    EXPECT_TRUE(segs.empty());
+
+    // oblique rays: each segment must lie in the cell it is scored in and
+    // the segments must add up to the length of the ray inside the mesh
+    Space_Vector r(0.01, 0.02, -0.05);
+    for (int n = 0; n < 8; ++n)
+    {
+        Space_Vector omega(1.0 + n, 0.5 * n + 0.25, 2.0 - 0.3 * n);
+        profugus::vector_normalize(omega);
+
+        double t = 0.0;
+        bool   in_cell = true;
+        mesh.segment(r, omega, 0.6,
+                     [&](size_type cell, double d)
+                     {
+                         Space_Vector mid;
+                         for (int a = 0; a < 3; ++a)
+                             mid[a] = r[a] + (t + 0.5 * d) * omega[a];
+
+                         Dim_Vector ijk;
+                         in_cell = in_cell && mesh.find(mid, ijk) &&
+                                   mesh.index(ijk[I], ijk[J], ijk[K]) == cell;
+                         t += d;
+                     });
+        EXPECT_TRUE(in_cell) << "ray " << n;
+
+        // the ray starts inside the mesh, so it is scored until it leaves
+        // the mesh or ends
+        double t_exit = 0.6;
+        for (int a = 0; a < 3; ++a)
+        {
+            double edge = omega[a] > 0.0 ? mesh.high_corner(a)
+                                         : mesh.low_corner(a);
+            t_exit = std::min(t_exit, (edge - r[a]) / omega[a]);
+        }
+        EXPECT_SOFTEQ(t_exit, t, 1.e-12) << "ray " << n;
+    }
+
+    // a 2-D mesh is unbounded in z
+    Mesh_t mesh2(x, y, Vec_Dbl());
+    segs.clear();
+    mesh2.segment(Space_Vector(0.05, 0.1, 100.0),
+                  Space_Vector(0.6, 0.0, 0.8), 0.25, score);
+    ASSERT_EQ(2, segs.size());
+    EXPECT_EQ(mesh2.index(0, 0, 0), segs[0].first);
+    EXPECT_EQ(mesh2.index(1, 0, 0), segs[1].first);
+    EXPECT_SOFTEQ(0.05 / 0.6, segs[0].second, 1.e-12);
+    EXPECT_SOFTEQ(0.25 - 0.05 / 0.6, segs[1].second, 1.e-12);
+}
+
 //---------------------------------------------------------------------------//
 //                 end of tstCartesian_Mesh.cc
 //---------------------------------------------------------------------------//
@@ -20,6 +20,7 @@
 #include "utils/Constants.hh"
 #include "utils/Vector_Functions.hh"
 #include "rng/RNG_Control.hh"
+#include "comm/OMP.hh"
 #include "../Definitions.hh"
 #include "../RTK_Geometry.hh"
 
@@ -315,6 +316,148 @@ TEST(Core, Heuristic)
     }
 }
 
+//---------------------------------------------------------------------------//
+/*
+ * Track the same set of rays through a single shared core serially and on
+ * multiple threads; the tracking interface is const so the threads share
+ * the geometry without copying it.  The results must be identical.
+ */
+TEST(Core, Threaded)
+{
+    // 2 fuel pin types and a water box
+    SP_Pin_Cell pin1(make_shared<Pin_Cell_t>(1, 0.54, 3, 1.26, 14.28));
+    SP_Pin_Cell pin2(make_shared<Pin_Cell_t>(2, 0.54, 3, 1.26, 14.28));
+    SP_Pin_Cell box(make_shared<Pin_Cell_t>(3, 2.52, 14.28));
+
+    SP_Lattice lat1(make_shared<Lattice_t>(2, 2, 1, 1));
+    SP_Lattice lat2(make_shared<Lattice_t>(2, 2, 1, 1));
+    SP_Lattice lat3(make_shared<Lattice_t>(1, 1, 1, 1));
+
+    lat1->assign_object(pin1, 0);
+    lat2->assign_object(pin2, 0);
+    lat3->assign_object(box, 0);
+
+    lat1->complete(0.0, 0.0, 0.0);
+    lat2->complete(0.0, 0.0, 0.0);
+    lat3->complete(0.0, 0.0, 0.0);
+
+    // 3x3x2 core with a checkerboard of fuel lattices and a reflector
+    SP_Core core(make_shared<Core_t>(3, 3, 2, 4));
+    core->assign_object(lat1, 1);
+    core->assign_object(lat2, 2);
+    core->assign_object(lat3, 3);
+    for (int k = 0; k < 2; ++k)
+    {
+        for (int j = 0; j < 3; ++j)
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                if (k == 1 || i == 2 || j == 2)
+                    core->id(i, j, k) = 3;
+                else
+                    core->id(i, j, k) = 1 + (i + j) % 2;
+            }
+        }
+    }
+    core->complete(0.0, 0.0, 0.0);
+
+    const Core_Geometry geometry(core);
+
+    // sample the rays up front so both passes track the same set
+    profugus::RNG_Control control(seed);
+    auto rng = control.rng();
+
+    const int Np = 20000;
+    vector<Vector> r(Np), omega(Np);
+    for (int n = 0; n < Np; ++n)
+    {
+        r[n][0] = rng.ran() * 7.56;
+        r[n][1] = rng.ran() * 7.56;
+        r[n][2] = rng.ran() * 28.56;
+
+        double costheta = 1.0 - 2.0 * rng.ran();
+        double phi      = profugus::constants::two_pi * rng.ran();
+        double sintheta = sqrt(1.0 - costheta * costheta);
+
+        omega[n][0] = sintheta * cos(phi);
+        omega[n][1] = sintheta * sin(phi);
+        omega[n][2] = costheta;
+    }
+
+    // track a ray to escape and store its total length, number of
+    // crossings, and escaping face
+    auto track = [&geometry](const Vector &r, const Vector &omega,
+                             double &length, int &crossings, int &face)
+    {
+        State state;
+        geometry.initialize(r, omega, state);
+
+        length    = 0.0;
+        crossings = 0;
+        while (geometry.boundary_state(state) == INSIDE)
+        {
+            length += geometry.distance_to_boundary(state);
+            geometry.move_to_surface(state);
+            ++crossings;
+        }
+        face = state.escaping_face;
+    };
+
+    vector<double> serial_l(Np), thread_l(Np);
+    vector<int>    serial_c(Np), thread_c(Np);
+    vector<int>    serial_f(Np), thread_f(Np);
+
+    // serial pass
+    double begin = profugus::thread_time();
+    for (int n = 0; n < Np; ++n)
+    {
+        track(r[n], omega[n], serial_l[n], serial_c[n], serial_f[n]);
+    }
+    double serial_time = profugus::thread_time() - begin;
+
+    // threaded pass over the same geometry (the harness runs with a single
+    // thread by default)
+    int num_threads = 4;
+    profugus::set_num_threads(num_threads);
+    begin = profugus::thread_time();
+#pragma omp parallel
+    {
+#pragma omp master
+        num_threads = profugus::num_current_threads();
+
+#pragma omp for schedule(static)
+        for (int n = 0; n < Np; ++n)
+        {
+            track(r[n], omega[n], thread_l[n], thread_c[n], thread_f[n]);
+        }
+    }
+    double thread_time = profugus::thread_time() - begin;
+    profugus::set_num_threads(1);
+
+    for (int n = 0; n < Np; ++n)
+    {
+        EXPECT_EQ(serial_l[n], thread_l[n]);
+        EXPECT_EQ(serial_c[n], thread_c[n]);
+        EXPECT_EQ(serial_f[n], thread_f[n]);
+    }
+
+    if (serial_time > 0.0 && thread_time > 0.0)
+    {
+        int crossings = 0;
+        for (int n = 0; n < Np; ++n)
+            crossings += serial_c[n];
+
+        cout << endl;
+        cout << "Tracked " << Np << " rays (" << crossings
+             << " surface crossings)" << endl;
+        cout << "Serial   : " << setw(10) << serial_time << " s" << endl;
+        cout << "Threaded : " << setw(10) << thread_time << " s on "
+             << num_threads << " threads (speedup "
+             << serial_time / thread_time << ")" << endl;
+        cout << endl;
+    }
+}
+
 //---------------------------------------------------------------------------//
 
 TEST(Core, Reflecting)
@@ -741,6 +884,109 @@ TEST(Bwr, Symmetry)
     }
 }
 
+//---------------------------------------------------------------------------//
+/*
+ Nested core: a 2x1 core of a single assembly, made of 2x2 copies of a single
+ 2x2 sub-assembly of pins, compared to the same core with the assembly
+ flattened into a 4x4 lattice of pins.
+ */
+
+TEST(Nested, Assembly)
+{
+    typedef profugus::RTK_Nested_Geometry<3>  Nested_Geometry;
+    typedef Nested_Geometry::Array_t          Nested_Core_t;
+    typedef Nested_Core_t::Object_t           Assembly_t;
+    typedef Assembly_t::Object_t              Sub_Assembly_t;
+
+    EXPECT_EQ(2, Nested_Core_t::calc_level());
+
+    // 2 fuel pin types
+    SP_Pin_Cell pin1(make_shared<Pin_Cell_t>(1, 0.54, 3, 1.26, 14.28));
+    SP_Pin_Cell pin2(make_shared<Pin_Cell_t>(2, 0.54, 3, 1.26, 14.28));
+
+    // nested core
+    auto sub = make_shared<Sub_Assembly_t>(2, 2, 1, 2);
+    sub->assign_object(pin1, 0);
+    sub->assign_object(pin2, 1);
+    sub->id(1, 0, 0) = 1;
+    sub->id(0, 1, 0) = 1;
+    sub->complete(0.0, 0.0, 0.0);
+
+    auto assembly = make_shared<Assembly_t>(2, 2, 1, 1);
+    assembly->assign_object(sub, 0);
+    assembly->complete(0.0, 0.0, 0.0);
+
+    auto nested = make_shared<Nested_Core_t>(2, 1, 1, 1);
+    nested->assign_object(assembly, 0);
+    nested->complete(0.0, 0.0, 0.0);
+
+    // flattened core
+    SP_Lattice lat(make_shared<Lattice_t>(4, 4, 1, 2));
+    lat->assign_object(pin1, 0);
+    lat->assign_object(pin2, 1);
+    for (int j = 0; j < 4; ++j)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            lat->id(i, j, 0) = (i + j) % 2;
+        }
+    }
+    lat->complete(0.0, 0.0, 0.0);
+
+    SP_Core flat(make_shared<Core_t>(2, 1, 1, 1));
+    flat->assign_object(lat, 0);
+    flat->complete(0.0, 0.0, 0.0);
+
+    Nested_Geometry nested_geo(nested);
+    Core_Geometry   flat_geo(flat);
+    EXPECT_EQ(2, nested_geo.array().level());
+    EXPECT_EQ(flat_geo.num_cells(), nested_geo.num_cells());
+    EXPECT_EQ(64, nested_geo.num_cells());
+
+    // the tracks through both cores are the same
+    profugus::RNG_Control control(seed);
+    auto rng = control.rng();
+
+    Vector r, omega;
+    State  nested_state, flat_state;
+    double costheta, sintheta, phi;
+    int    crossings = 0;
+
+    for (int n = 0; n < 1000; ++n)
+    {
+        r[0] = rng.ran() * 10.08;
+        r[1] = rng.ran() * 5.04;
+        r[2] = rng.ran() * 14.28;
+
+        costheta = 1.0 - 2.0 * rng.ran();
+        phi      = profugus::constants::two_pi * rng.ran();
+        sintheta = sqrt(1.0 - costheta * costheta);
+
+        omega[0] = sintheta * cos(phi);
+        omega[1] = sintheta * sin(phi);
+        omega[2] = costheta;
+
+        nested_geo.initialize(r, omega, nested_state);
+        flat_geo.initialize(r, omega, flat_state);
+
+        while (flat_geo.boundary_state(flat_state) == INSIDE)
+        {
+            ASSERT_EQ(INSIDE, nested_geo.boundary_state(nested_state));
+            EXPECT_EQ(flat_geo.matid(flat_state),
+                      nested_geo.matid(nested_state));
+            EXPECT_NEAR(flat_geo.distance_to_boundary(flat_state),
+                        nested_geo.distance_to_boundary(nested_state),
+                        1.0e-10);
+
+            flat_geo.move_to_surface(flat_state);
+            nested_geo.move_to_surface(nested_state);
+            ++crossings;
+        }
+        EXPECT_EQ(OUTSIDE, nested_geo.boundary_state(nested_state));
+    }
+    EXPECT_GT(crossings, 1000);
+}
+
 //---------------------------------------------------------------------------//
 // end of tstCore.cc
 //---------------------------------------------------------------------------//
@@ -1488,6 +1488,77 @@ TEST(Ml, Lattice)
     }
 }
 
+//---------------------------------------------------------------------------//
+// find_object on uniform and non-uniform lattices must give the same indices
+// as a search of the edges, including points on the edges.
+
+TEST(Lattice, FindObject)
+{
+    typedef profugus::RTK_Array<profugus::RTK_Cell> Lattice;
+    typedef Lattice::SP_Object                      SP_Pin_Cell;
+    typedef profugus::RTK_Cell                      Pin_Cell;
+
+    // reference index: a point on an interior edge is in the lower element
+    auto ref_index = [](const vector<double> &edges, double r)
+    {
+        int i = 0;
+        while (i < edges.size() - 2 && r > edges[i+1])
+            ++i;
+        return i;
+    };
+
+    // x pitches are {1.0, 2.0, 1.0} (non-uniform), y pitches are 1.5
+    // (uniform), and z is a single level of height 2.0
+    SP_Pin_Cell narrow(make_shared<Pin_Cell>(1, 1.0, 1.5, 2.0));
+    SP_Pin_Cell wide(make_shared<Pin_Cell>(2, 2.0, 1.5, 2.0));
+
+    Lattice nonuniform(3, 4, 1, 2);
+    nonuniform.assign_object(narrow, 0);
+    nonuniform.assign_object(wide, 1);
+    for (int j = 0; j < 4; ++j)
+    {
+        nonuniform.id(0, j, 0) = 0;
+        nonuniform.id(1, j, 0) = 1;
+        nonuniform.id(2, j, 0) = 0;
+    }
+    nonuniform.complete(0.25, -0.75, 0.0);
+
+    Lattice uniform(3, 4, 1, 1);
+    uniform.assign_object(narrow, 0);
+    uniform.complete(0.25, -0.75, 0.0);
+
+    vector<double> x_nu = {0.25, 1.25, 3.25, 4.25};
+    vector<double> x_u  = {0.25, 1.25, 2.25, 3.25};
+    vector<double> y    = {-0.75, 0.75, 2.25, 3.75, 5.25};
+    vector<double> z    = {0.0, 2.0};
+
+    auto check = [&](const Lattice &lat, const vector<double> &x)
+    {
+        State state;
+        const int l = lat.level();
+
+        // points on and between the edges
+        for (int a = 0; a < 2 * x.size() - 1; ++a)
+        {
+            double rx = a % 2 ? 0.5 * (x[a/2] + x[a/2+1]) : x[a/2];
+            for (int b = 0; b < 2 * y.size() - 1; ++b)
+            {
+                double ry = b % 2 ? 0.5 * (y[b/2] + y[b/2+1]) : y[b/2];
+                for (double rz : {0.0, 1.0, 2.0})
+                {
+                    lat.find_object(Vector(rx, ry, rz), state);
+                    EXPECT_EQ(ref_index(x, rx), state.level_coord[l][X]);
+                    EXPECT_EQ(ref_index(y, ry), state.level_coord[l][Y]);
+                    EXPECT_EQ(ref_index(z, rz), state.level_coord[l][Z]);
+                }
+            }
+        }
+    };
+
+    check(nonuniform, x_nu);
+    check(uniform, x_u);
+}
+
 //---------------------------------------------------------------------------//
 // See support/lattice_cells.png for core figure showing particle path.
 
@@ -38,8 +38,9 @@ TEST(State, Packing)
     // make a buffer
     vector<char> buffer;
 
-    EXPECT_TRUE(Geo_State::packed_bytes() == 16 * sizeof(int) +
-              6 * sizeof(double));
+    EXPECT_TRUE(Geo_State::packed_bytes() ==
+                (7 + 3 * Geo_State::max_levels) * sizeof(int) +
+                6 * sizeof(double));
 
     // pack a state
     {
@@ -422,6 +423,71 @@ TEST(Multi, Shell)
 
 //---------------------------------------------------------------------------//
 
+TEST(Many, Shell)
+{
+    // pin with 10 shells (fuel rings, absorber, gap, clad)
+    vector<int>    ids(10, 0);
+    vector<double> rad(10, 0.0);
+    for (int n = 0; n < 10; ++n)
+    {
+        ids[n] = n + 1;
+        rad[n] = 0.1 + 0.05 * n;
+    }
+
+    RTK_Cell pin(ids, rad, 11, 1.26, 14.28);
+
+    EXPECT_EQ(11, pin.num_regions());
+    EXPECT_EQ(10, pin.num_shells());
+
+    // regions on either side of each shell
+    for (int n = 0; n < 10; ++n)
+    {
+        EXPECT_EQ(n, pin.region(0.0, rad[n] - 1.0e-6));
+        EXPECT_EQ(n + 1, pin.region(0.0, rad[n] + 1.0e-6));
+    }
+    EXPECT_EQ(10, pin.region(0.6, 0.6));
+
+    // track across the pin through every shell, off the centerline
+    const double y = 0.02;
+    Vector r(-0.62, y, 1.0), omega(1.0, 0.0, 0.0);
+
+    // crossings in x
+    vector<double> x;
+    for (int n = 9; n >= 0; --n)
+        x.push_back(-sqrt(rad[n] * rad[n] - y * y));
+    for (int n = 0; n < 10; ++n)
+        x.push_back(sqrt(rad[n] * rad[n] - y * y));
+    x.push_back(0.63);
+
+    Geo_State state;
+    pin.initialize(r, state);
+    EXPECT_EQ(10, state.region);
+
+    int region = 10;
+    for (int c = 0; c < x.size(); ++c)
+    {
+        pin.distance_to_boundary(r, omega, state);
+        EXPECT_SOFTEQ(x[c] - r[0], state.dist_to_next_region, 1.0e-12);
+        EXPECT_EQ(region, state.region);
+
+        if (c + 1 == x.size())
+        {
+            EXPECT_EQ(Geo_State::PLUS_X, state.exiting_face);
+            break;
+        }
+
+        // inward crossings decrement the region, outward increment it
+        region = c < 10 ? 9 - c : c - 9;
+        EXPECT_EQ(Geo_State::INTERNAL, state.exiting_face);
+        EXPECT_EQ(region, state.next_region);
+
+        pin.cross_surface(state);
+        r[0] = x[c];
+    }
+}
+
+//---------------------------------------------------------------------------//
+
 TEST(Empty, SquareCell)
 {
     // make an empty pin cell
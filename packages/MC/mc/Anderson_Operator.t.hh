@@ -149,9 +149,10 @@ void Anderson_Operator<Geometry,T>::build_tallies()
     }
     ENSURE( d_tallier->num_pathlength_tallies() == 1 );
 
-    // Build Fission_Tally
+    // Build Fission_Tally (event-based transport requires batch statistics)
     d_fisn_tally = std::make_shared<Fission_Tally_t>(
-        d_source->physics());
+        d_source->physics(),
+        d_transporter->event_based() ? tally::BATCH : tally::HISTORY);
     d_fisn_tally->set_mesh(d_mesh);
     d_tallier->add_pathlength_tally(d_fisn_tally);
     d_tallier->build();
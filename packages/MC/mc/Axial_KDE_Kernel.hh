@@ -54,7 +54,7 @@ class Axial_KDE_Kernel : public KDE_Kernel<Geometry>
     using Base::b_physics;
     using Base::b_coefficient;
     using Base::b_exponent;
-    using Base::b_bndwidth_map;
+    using Base::b_bandwidths;
     using Base::b_num_sampled;
     using Base::b_num_accepted;
 
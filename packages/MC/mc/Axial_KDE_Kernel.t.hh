@@ -91,8 +91,8 @@ Axial_KDE_Kernel<Geometry>::sample_position_fiss_rej(
         double epsilon = sampler::sample_epan(rng);
 
         // Get the bandwidth
-        CHECK(b_bndwidth_map.count(cellid) == 1);
-        double bandwidth = b_bndwidth_map.find(cellid)->second;
+        CHECK(cellid < b_bandwidths.size());
+        double bandwidth = b_bandwidths[cellid];
         CHECK(bandwidth >= 0.0);
 
         // Create a new position
@@ -154,8 +154,8 @@ Axial_KDE_Kernel<Geometry>::sample_position_cell_rej(
         double epsilon = sampler::sample_epan(rng);
 
         // Get the bandwidth if available
-        CHECK(b_bndwidth_map.count(cellid) == 1);
-        double bandwidth = b_bndwidth_map.find(cellid)->second;
+        CHECK(cellid < b_bandwidths.size());
+        double bandwidth = b_bandwidths[cellid];
         CHECK(bandwidth >= 0.0);
 
         // Create a new position
@@ -26,6 +26,14 @@ namespace profugus
  *
  * The bank is essentially a stack of particles. To reduce storage, we use a
  * delayed-copy approach.
+ *
+ * Particles are stored by value in a contiguous stack whose slots are never
+ * destroyed when particles are popped.  Pushing into a previously used slot
+ * copy-assigns into the existing particle (including its metadata buffer),
+ * so once the bank has grown to the deepest stack encountered, pushing and
+ * popping perform no heap allocations.  The value-based push/pop should be
+ * used in the transport loop; the shared-pointer versions are provided for
+ * convenience and allocate a new particle on each pop.
  */
 /*!
  * \example mc/test/tstBank.cc
@@ -51,7 +59,7 @@ class Bank
 
   private:
     // Container type for particles
-    typedef std::vector<SP_Particle> Stack_Particle;
+    typedef std::vector<Particle_t> Stack_Particle;
 
     // Container type for number of copies per particle
     typedef std::vector<size_type> Stack_Count;
@@ -59,9 +67,12 @@ class Bank
   private:
     // >>> DATA
 
-    // Stored particles
+    // Stored particles; only the first d_num_unique slots are in the stack
     Stack_Particle d_particles;
 
+    // Number of occupied slots in the particle stack
+    size_type d_num_unique;
+
     // Number of copies per particle
     Stack_Count d_count;
 
@@ -69,7 +80,7 @@ class Bank
     size_type d_total;
 
   public:
-    Bank() : d_particles(), d_count(), d_total(0) { /* * */ }
+    Bank() : d_particles(), d_num_unique(0), d_count(), d_total(0) { /* * */ }
 
     //! \name std::stack-like operatinos
     //@{
@@ -77,8 +88,9 @@ class Bank
     //! Is the bank empty?
     bool empty() const
     {
-        CHECK(d_particles.size() == d_count.size());
-        CHECK(d_particles.empty() ? d_total == 0 : true);
+        CHECK(d_num_unique == d_count.size());
+        CHECK(d_num_unique <= d_particles.size());
+        CHECK(d_num_unique == 0 ? d_total == 0 : true);
         return d_total == 0;
     }
 
@@ -87,37 +99,43 @@ class Bank
     size_type num_particles() const { return size(); }
 
     //! View the particle on the top of the stack
-    const SP_Particle& top() const
+    const Particle_t& top() const
     {
         REQUIRE(!empty());
-        REQUIRE(!d_particles.empty());
-        return d_particles.back();
+        REQUIRE(d_num_unique > 0);
+        return d_particles[d_num_unique - 1];
     }
-    const SP_Particle& back() const { return top(); }
-
-    //! Just pushing a particle
-    void basic_push(const SP_Particle& p, size_type count)
-    {
-        REQUIRE(p);
-        REQUIRE(count > 0);
+    const Particle_t& back() const { return top(); }
 
-        // Add a copy of the particle to the stack
-        d_particles.push_back(std::make_shared<Particle_t>(*p));
-        d_count.push_back(count);
+    // Just pushing a particle
+    inline void basic_push(const Particle_t& p, size_type count);
 
-        d_total += count;
+    //! Push a particle (default to basic push)
+    void push(const Particle_t& p, size_type count = 1)
+    {
+        basic_push(p, count);
     }
 
-    //! Push a particle (default to basic push)
+    //! Push a particle held by pointer
     void push(const SP_Particle& p, size_type count = 1)
     {
-        basic_push(p, count);
+        REQUIRE(p);
+        basic_push(*p, count);
     }
 
+    void push_back(const Particle_t& p) { push(p, 1); }
     void push_back(const SP_Particle& p) { push(p, 1); }
 
-    //! Emit the topmost particle from the stack
-    SP_Particle pop() { return basic_pop(); }
+    //! Emit the topmost particle from the stack into an existing particle
+    void pop(Particle_t& p) { basic_pop(p); }
+
+    //! Emit the topmost particle from the stack into a new particle
+    SP_Particle pop()
+    {
+        SP_Particle p(std::make_shared<Particle_t>());
+        basic_pop(*p);
+        return p;
+    }
     SP_Particle pop_back() { return pop(); }
 
     //@}
@@ -127,7 +145,10 @@ class Bank
     //@{
 
     //! Return the number of unique particles being stored
-    size_type num_unique() const { return d_particles.size(); }
+    size_type num_unique() const { return d_num_unique; }
+
+    //! Return the number of particle slots allocated by the bank
+    size_type capacity() const { return d_particles.size(); }
 
     //! Return the number of copies of the next particle
     size_type next_count() const
@@ -140,8 +161,8 @@ class Bank
   private:
     // >>> IMPLEMENTATION
 
-    //! Just emitting the topmost particle from the stack
-    inline SP_Particle basic_pop();
+    // Just emitting the topmost particle from the stack
+    inline void basic_pop(Particle_t& p);
 };
 
 } // end namespace profugus
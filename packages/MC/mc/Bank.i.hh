@@ -18,35 +18,58 @@ namespace profugus
 // INLINE FUNCTIONS
 //---------------------------------------------------------------------------//
 
+/*!
+ * \brief Push copies of a particle onto the stack.
+ *
+ * The particle is copied into the next free slot of the stack; a new slot is
+ * only allocated when the stack is deeper than it has ever been.
+ */
+template <class Geometry>
+void Bank<Geometry>::basic_push(const Particle_t& p, size_type count)
+{
+    REQUIRE(count > 0);
+
+    // Add a copy of the particle to the stack, reusing a slot if we can
+    if (d_num_unique < d_particles.size())
+        d_particles[d_num_unique] = p;
+    else
+        d_particles.push_back(p);
+    d_count.push_back(count);
+
+    ++d_num_unique;
+    d_total += count;
+
+    ENSURE(d_count.size() == d_num_unique);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Emit the topmost particle from the stack into p.
+ */
 template <class Geometry>
-auto Bank<Geometry>::basic_pop() -> SP_Particle
+void Bank<Geometry>::basic_pop(Particle_t& p)
 {
     REQUIRE(!empty());
-    REQUIRE(!d_particles.empty());
+    REQUIRE(d_num_unique > 0);
     REQUIRE(!d_count.empty());
 
-    SP_Particle new_particle;
+    // Copy the top particle into the output
+    p = d_particles[d_num_unique - 1];
 
     if (d_count.back() > 1)
     {
-        // Make a new copy to return
-        new_particle = std::make_shared<Particle_t>(*d_particles.back());
-
+        // Keep the stored copy for the remaining emissions
         --d_count.back();
     }
     else
     {
-        // Return our original copy
-        new_particle = d_particles.back();
-
-        d_particles.pop_back();
+        // Release the slot (the particle is kept for reuse)
+        --d_num_unique;
         d_count.pop_back();
     }
 
     // Also update the running total
     --d_total;
-
-    return new_particle;
 }
 
 } // end namespace mc
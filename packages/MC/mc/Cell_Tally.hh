@@ -17,6 +17,8 @@
 #include <utility>
 
 #include "Tally.hh"
+#include "Cycle_Output.hh"
+#include "Response_Bins.hh"
 
 namespace profugus
 {
@@ -25,6 +27,26 @@ namespace profugus
 /*!
  * \class Cell_Tally
  * \brief Do pathlength cell tallies.
+ *
+ * The tallied cells are mapped once, in set_cells(), to dense indices
+ * through a lookup table over all geometry cells, so that scoring is an
+ * array access.  All accumulators are contiguous arrays ordered like the
+ * cells passed to set_cells(); results() is keyed by cell and is filled in
+ * by finalize().  set_all_cells() tallies every cell in the geometry.
+ *
+ * Each cell scores a block of group-bin and response bins (see
+ * Response_Bins), so the accumulators are laid out \c
+ * [cell][group_bin][response].  By default there is one bin, the
+ * energy-integrated flux.
+ *
+ * The statistical error is estimated from per-history moments by default.
+ * Setting \c tally_statistics to \c "batch" in the database estimates it
+ * from the spread of the cycle (batch) means instead; only first moments are
+ * accumulated, scores go straight into the cycle tally, and end_history() is
+ * not needed.  At least two batches must be tallied before finalize(), so
+ * fixed-source problems with batch statistics must be run in cycles.
+ * Batch statistics are the default, and the only option, when \c
+ * transport_type is \c "event".
  */
 /*!
  * \example mc/test/tstCell_Tally.cc
@@ -48,6 +70,7 @@ class Cell_Tally : public Pathlength_Tally<Geometry>
     typedef std::shared_ptr<Geometry_t>      SP_Geometry;
     typedef std::pair<double, double>        Moments;
     typedef std::unordered_map<int, Moments> Result;
+    typedef std::vector<Moments>             Vec_Moments;
     typedef std::shared_ptr<Physics_t>       SP_Physics;
     typedef Teuchos::ParameterList           ParameterList_t;
     typedef Teuchos::RCP<ParameterList_t>    RCP_Std_DB;
@@ -61,6 +84,9 @@ class Cell_Tally : public Pathlength_Tally<Geometry>
     // Geometry.
     SP_Geometry d_geometry;
 
+    // Group bins and responses.
+    Response_Bins d_bins;
+
     // Map of tally moments.
     Result d_tally;
 
@@ -74,9 +100,31 @@ class Cell_Tally : public Pathlength_Tally<Geometry>
     // Add tally cells.
     void set_cells(const std::vector<int> &cells);
 
-    // Get tally results.
+    // Tally all cells in the geometry.
+    void set_all_cells();
+
+    //! Tallied cells.
+    const std::vector<int>& cells() const { return d_cells; }
+
+    // Set the group bins and responses.
+    void set_bins(const Response_Bins &bins);
+
+    //! Group bins and responses.
+    const Response_Bins& bins() const { return d_bins; }
+
+    // Get tally results for the first bin of each cell (set in finalize).
     const Result& results() const { return d_tally; }
 
+    //! Get tally results indexed [cell][group_bin][response] (set in
+    //! finalize).
+    const Vec_Moments& bin_results() const { return d_moments; }
+
+    //! Statistical error estimator.
+    tally::Statistics statistics() const { return d_statistics; }
+
+    //! Number of batches accumulated with batch statistics.
+    int num_batches() const { return d_num_batches; }
+
     // >>> TALLY INTERFACE
 
     // Begin new cycle
@@ -88,12 +136,24 @@ class Cell_Tally : public Pathlength_Tally<Geometry>
     // Accumulate first and second moments
     void end_history();
 
+    //! Only history statistics need end_history().
+    bool requires_end_history() const
+    {
+        return d_statistics == tally::HISTORY;
+    }
+
     // Do post-processing on first and second moments
     void finalize(double num_particles);
 
     // Clear/re-initialize all tally values between solves
     void reset();
 
+    // Size thread-private accumulators
+    void set_num_threads(int num_threads);
+
+    //! Cell tallies can be accumulated concurrently.
+    bool thread_safe() const { return true; }
+
     // >>> PATHLENGTH TALLY INTERFACE
 
     // Track particle and tally.
@@ -102,26 +162,69 @@ class Cell_Tally : public Pathlength_Tally<Geometry>
   private:
     // >>> IMPLEMENTATION
 
-    typedef std::unordered_map<int, double> History_Tally;
+    typedef std::vector<double> History_Tally;
+
+    // Thread-private accumulators, indexed by bin.
+    struct Thread_Tally
+    {
+        // Tally for a history.
+        History_Tally hist;
+
+        // Offsets of the response blocks scored in the current history, and
+        // whether each block is in the list.
+        std::vector<int>  touched;
+        std::vector<bool> scored;
+
+        // Response multipliers for the current step.
+        std::vector<double> response;
+
+        // Moments and cycle tally not yet reduced into the results.
+        Vec_Moments   moments;
+        History_Tally cycle;
+    };
 
     // Clear local values.
     void clear_local();
 
+    // Make empty thread-private accumulators for the current cells.
+    void init_threads(int num_threads);
+
+    // Reduce thread-private accumulators into the results.
+    void reduce_threads();
+
+    // Add the cycle tally to the batch moments.
+    void end_batch(double num_particles);
+
+    // Statistical error estimator
+    tally::Statistics d_statistics;
+
+    // Tallied cells and the tally index of each geometry cell (-1 if the
+    // cell is not tallied)
+    std::vector<int> d_cells;
+    std::vector<int> d_index;
+
+    // Accumulated moments, indexed by bin
+    Vec_Moments d_moments;
+
+    // Sums of batch means and their squares
+    Vec_Moments d_batch;
+    int         d_num_batches;
+
     // Cycle counter
     int d_cycle;
 
-    // Map for reordering fluxes from unordered map
-    std::vector<int> d_cell_map;
-
     // Filename for HDF5 output
     std::string d_outfile;
 
-    // Tally for a history.
-    History_Tally d_hist;
+    // Thread-private tallies.
+    std::vector<Thread_Tally> d_thread;
 
     // Should we write fluxes at every cycle
     bool d_cycle_output;
 
+    // Asynchronous writer for cycle fluxes
+    std::shared_ptr<Cycle_Output> d_cycle_writer;
+
     // Tally for single cycle
     History_Tally d_cycle_tally;
 };
@@ -15,6 +15,7 @@
 #include <algorithm>
 
 #include "Utils/comm/global.hh"
+#include "Utils/comm/OMP.hh"
 #include "Cell_Tally.hh"
 #include "utils/Serial_HDF5_Writer.hh"
 
@@ -31,13 +32,20 @@ template <class Geometry>
 Cell_Tally<Geometry>::Cell_Tally(RCP_Std_DB db, SP_Physics physics)
     : Base(physics, false)
     , d_geometry(b_physics->get_geometry())
+    , d_bins(b_physics->num_groups())
     , d_db(db)
+    , d_statistics(tally::HISTORY)
+    , d_num_batches(0)
+    , d_thread(1)
 {
     REQUIRE(d_geometry);
 
     // set the tally name
     set_name("cell");
 
+    // no cells are tallied until they are set
+    d_index.assign(d_geometry->num_cells(), -1);
+
     // reset tally
     reset();
 
@@ -46,6 +54,20 @@ Cell_Tally<Geometry>::Cell_Tally(RCP_Std_DB db, SP_Physics physics)
 
     // Should we write fluxes at each cycle
     d_cycle_output = d_db->get("do_cycle_output",false);
+
+    // Statistical error estimator; the event-based transporter interleaves
+    // histories, so it can only be used with batch statistics
+    bool events = (d_db->get("transport_type", std::string("history")) ==
+                   "event");
+    auto statistics = d_db->get("tally_statistics",
+                                std::string(events ? "batch" : "history"));
+    VALIDATE(statistics == "history" || statistics == "batch",
+             "Invalid tally_statistics '" << statistics << "'; must be "
+             "history or batch.");
+    VALIDATE(!events || statistics == "batch",
+             "Event-based transport requires batch tally_statistics.");
+    if (statistics == "batch")
+        d_statistics = tally::BATCH;
 }
 
 //---------------------------------------------------------------------------//
@@ -53,46 +75,95 @@ Cell_Tally<Geometry>::Cell_Tally(RCP_Std_DB db, SP_Physics physics)
 //---------------------------------------------------------------------------//
 /*!
  * \brief Add a list of cells to tally.
+ *
+ * Each cell may only be listed once.  Results are output in the order of the
+ * cells in the list.
  */
 template <class Geometry>
 void Cell_Tally<Geometry>::set_cells(const std::vector<int> &cells)
 {
-    // Make a new tally results
-    Result tally;
-    History_Tally cycle_tally;
+    const int num_cells = d_geometry->num_cells();
 
-    // Iterate through the cells and insert them into the map
-    for (const auto &cell : cells)
+    // Map each geometry cell to its tally index
+    std::vector<int> index(num_cells, -1);
+    for (int n = 0, N = cells.size(); n < N; ++n)
     {
-        VALIDATE(cell < d_geometry->num_cells(),
+        int cell = cells[n];
+        VALIDATE(cell >= 0 && cell < num_cells,
                 "Cell tally index exceeds number of cells in geometry.");
-        tally.insert({cell, {0.0, 0.0}});
-        cycle_tally.insert({cell, 0.0});
+        VALIDATE(index[cell] < 0, "Cell " << cell << " is listed more "
+                 "than once in the cell tally.");
+        index[cell] = n;
     }
 
-    // Swap with the existing tally
-    std::swap(tally,       d_tally);
-    std::swap(cycle_tally, d_cycle_tally);
+    d_cells = cells;
+    std::swap(index, d_index);
 
-    // Determine permutation vector for sorted cells
-    std::vector<std::pair<int,int>> sort_vec;
-    for (int i = 0; i < cells.size(); ++i)
-        sort_vec.push_back({cells[i],i});
-
-    std::sort(sort_vec.begin(), sort_vec.end(),
-        [](const std::pair<int,int> &lhs, const std::pair<int,int> &rhs)
-        { return lhs.first < rhs.first; } );
-
-    d_cell_map.resize(cells.size());
-    for (int i = 0; i < sort_vec.size(); ++i)
-        d_cell_map[i] = sort_vec[i].second;
+    // Make new tally results
+    Result tally;
+    for (int cell : d_cells)
+        tally.insert({cell, {0.0, 0.0}});
+    std::swap(tally, d_tally);
+
+    // Make empty accumulators for the new cells
+    int num_bins = d_cells.size() * d_bins.size();
+    d_moments.assign(num_bins, {0.0, 0.0});
+    d_cycle_tally.assign(num_bins, 0.0);
+    d_batch.assign(num_bins, {0.0, 0.0});
+    d_num_batches = 0;
+    init_threads(d_thread.size());
+
+    // Finish any cycle output before the file is rewritten, and wait for
+    // the cycle output of other tallies (HDF5 is not called concurrently)
+    if (d_cycle_writer)
+        d_cycle_writer->close();
+    Cycle_Output::drain_all();
 
 #ifdef USE_HDF5
     Serial_HDF5_Writer writer;
     writer.open(d_outfile);
     writer.write("cells",cells);
+    writer.write("group_bins",d_bins.first_groups());
+    writer.write("responses",std::vector<int>(d_bins.responses().begin(),
+                                              d_bins.responses().end()));
     writer.close();
 #endif
+
+    ENSURE(static_cast<int>(d_index.size()) == num_cells);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Set the group bins and responses.
+ *
+ * All accumulated results are cleared.
+ */
+template <class Geometry>
+void Cell_Tally<Geometry>::set_bins(const Response_Bins &bins)
+{
+    REQUIRE(bins.num_groups() == b_physics->num_groups());
+
+    d_bins = bins;
+
+    // Size the accumulators for the new bins
+    std::vector<int> cells(d_cells);
+    set_cells(cells);
+
+    ENSURE(d_moments.size() == d_cells.size() * d_bins.size());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Tally all cells in the geometry.
+ */
+template <class Geometry>
+void Cell_Tally<Geometry>::set_all_cells()
+{
+    std::vector<int> cells(d_geometry->num_cells());
+    for (int cell = 0, N = cells.size(); cell < N; ++cell)
+        cells[cell] = cell;
+
+    set_cells(cells);
 }
 
 //---------------------------------------------------------------------------//
@@ -104,24 +175,36 @@ void Cell_Tally<Geometry>::set_cells(const std::vector<int> &cells)
 template <class Geometry>
 void Cell_Tally<Geometry>::end_history()
 {
-    // Iterate through local tally results and add them to the permanent
-    // results
-    for (const auto &t : d_hist)
+    REQUIRE(profugus::thread_id() < static_cast<int>(d_thread.size()));
+
+    // Get the accumulators for this thread
+    auto &thread = d_thread[profugus::thread_id()];
+    CHECK(thread.hist.size() == d_moments.size());
+
+    const int Nr = d_bins.num_responses();
+
+    // Add the bins scored in this history to the thread's results and clear
+    // them
+    for (int offset : thread.touched)
     {
-        CHECK(d_tally.find(t.first) != d_tally.end());
+        CHECK(offset >= 0 &&
+              offset + Nr <= static_cast<int>(thread.hist.size()));
 
-        // Get the persistent tally result
-        auto &r = d_tally[t.first];
+        for (int i = offset; i < offset + Nr; ++i)
+        {
+            double &hist = thread.hist[i];
 
-        // Store the moments
-        r.first  += t.second;
-        r.second += t.second * t.second;
+            // Store the moments
+            thread.moments[i].first  += hist;
+            thread.moments[i].second += hist * hist;
 
-        d_cycle_tally[t.first] += t.second;
-    }
+            thread.cycle[i] += hist;
 
-    // Clear the local tally
-    clear_local();
+            hist = 0.0;
+        }
+        thread.scored[offset / Nr] = false;
+    }
+    thread.touched.clear();
 }
 
 //---------------------------------------------------------------------------//
@@ -132,8 +215,9 @@ template <class Geometry>
 void Cell_Tally<Geometry>::begin_cycle()
 {
     // Reset cycle tally results
-    for (auto &r : d_cycle_tally)
-        r.second = 0.0;
+    std::fill(d_cycle_tally.begin(), d_cycle_tally.end(), 0.0);
+    for (auto &thread : d_thread)
+        std::fill(thread.cycle.begin(), thread.cycle.end(), 0.0);
 }
 
 //---------------------------------------------------------------------------//
@@ -143,41 +227,36 @@ void Cell_Tally<Geometry>::begin_cycle()
 template <class Geometry>
 void Cell_Tally<Geometry>::end_cycle(double num_particles)
 {
+    // Reduce results from all threads
+    reduce_threads();
+
     if (d_cycle_output)
     {
         std::vector<double> mean(d_cycle_tally.size(),0.0);
 
         const auto &volumes = d_geometry->cell_volumes();
+        const int   B       = d_bins.size();
 
-        int ctr = 0;
-        for (const auto &t : d_cycle_tally)
-            mean[ctr++] = t.second / (num_particles * volumes[t.first]);
-
-        // Reorder vector
+        for (int i = 0, N = mean.size(); i < N; ++i)
         {
-            std::vector<double> tmp_mean  = mean;
-            for (int i = 0; i < d_cell_map.size(); ++i)
-            {
-                int ind = d_cell_map[i];
-                mean[i]  = tmp_mean[ind];
-            }
+            mean[i] = d_cycle_tally[i] /
+                      (num_particles * volumes[d_cells[i / B]]);
         }
 
-        // Global reduction
-        profugus::global_sum(mean.data(), mean.size());
-
-#ifdef USE_HDF5
-        Serial_HDF5_Writer writer;
-        writer.open(d_outfile,HDF5_IO::APPEND);
-        std::ostringstream m;
-        m << "cycle_" << d_cycle;
-        writer.begin_group(m.str());
-        writer.write("cycle_flux",mean);
-        writer.end_group();
-        writer.close();
-#endif
+        // Reduce and append to the cycle_flux dataset while the next cycle
+        // runs
+        if (!d_cycle_writer)
+        {
+            d_cycle_writer = std::make_shared<Cycle_Output>(
+                d_outfile, "cycle_flux");
+        }
+        d_cycle_writer->write(mean);
     }
 
+    // Each cycle is a batch
+    if (d_statistics == tally::BATCH)
+        end_batch(num_particles);
+
     d_cycle++;
 }
 
@@ -190,86 +269,92 @@ void Cell_Tally<Geometry>::finalize(double num_particles)
 {
     REQUIRE(num_particles > 1);
 
-    // Do a global reduction on moments
-    std::vector<int>    cells(d_tally.size(),  0.0);
-    std::vector<double> first(d_tally.size(),  0.0);
-    std::vector<double> second(d_tally.size(), 0.0);
+    // Reduce results from all threads
+    reduce_threads();
 
-    int ctr = 0;
-    for (const auto &t : d_tally)
-    {
-        // Get a reference to the moments
-        auto &moments = t.second;
+    // The error of the mean cannot be estimated from fewer than two batches
+    VALIDATE(d_statistics != tally::BATCH || d_num_batches > 1,
+             "Batch tally statistics need at least two batches (cycles), but "
+             << d_num_batches << " were tallied; run fixed-source problems "
+             << "in cycles or use history tally_statistics.");
 
-        // Copy the moments into the communciation buffer
-        cells[ctr]  = t.first;
-        first[ctr]  = moments.first;
-        second[ctr] = moments.second;
+    // Do a global reduction on moments
+    std::vector<double> first(d_moments.size(),  0.0);
+    std::vector<double> second(d_moments.size(), 0.0);
 
-        // Update the counter
-        ++ctr;
+    for (int i = 0, N = d_moments.size(); i < N; ++i)
+    {
+        first[i]  = d_moments[i].first;
+        second[i] = d_moments[i].second;
     }
-    CHECK(ctr == d_tally.size());
 
     // Do global reductions on the moments
     profugus::global_sum(first.data(),  first.size());
     profugus::global_sum(second.data(), second.size());
 
-    // Reset the counter
-    ctr = 0;
-
     const auto &volumes = d_geometry->cell_volumes();
+    const int   B       = d_bins.size();
 
-    // Iterate through tally cells and build the variance and mean
-    for (auto &t : d_tally)
+    // Store 1/N
+    double inv_N = 1.0 / static_cast<double>(num_particles);
+
+    // Iterate through tally bins and build the variance and mean
+    for (int i = 0, N = d_moments.size(); i < N; ++i)
     {
-        CHECK(volumes[t.first] > 0.0);
+        // Get the cell for this bin
+        int cell = d_cells[i / B];
+        CHECK(volumes[cell] > 0.0);
 
         // Get the volume for the cell
-        double inv_V = 1.0 / volumes[t.first];
-
-        // Store 1/N
-        double inv_N = 1.0 / static_cast<double>(num_particles);
+        double inv_V = 1.0 / volumes[cell];
 
-        // Calculate means for this cell
-        double avg_l  = first[ctr] * inv_N;
-        double avg_l2 = second[ctr] * inv_N;
+        // Calculate means for this bin
+        double avg_l  = first[i] * inv_N;
+        double avg_l2 = second[i] * inv_N;
 
         // Get a reference to the moments
-        auto &moments = t.second;
+        auto &moments = d_moments[i];
 
         // Store the sample mean
         moments.first = avg_l * inv_V;
 
-        // Calculate the variance
-        double var = num_particles / (num_particles - 1) * inv_V * inv_V *
-                     (avg_l2 - avg_l * avg_l);
+        if (d_statistics == tally::BATCH)
+        {
+            // Calculate the variance of the mean from the batch means
+            const auto &b = d_batch[i];
+            double inv_B  = 1.0 / d_num_batches;
+            double avg_b  = b.first * inv_B;
+            double avg_b2 = b.second * inv_B;
+            double var    = std::max(avg_b2 - avg_b * avg_b, 0.0) /
+                            (d_num_batches - 1);
+
+            // Store the error of the sample mean
+            moments.second = std::sqrt(var) * inv_V;
+        }
+        else
+        {
+            // Calculate the variance
+            double var = num_particles / (num_particles - 1) * inv_V *
+                         inv_V * (avg_l2 - avg_l * avg_l);
 
-        // Store the error of the sample mean
-        moments.second = std::sqrt(var * inv_N);
+            // Store the error of the sample mean
+            moments.second = std::sqrt(var * inv_N);
+        }
 
         // Store values back into vectors for HDF5 writing
-        first[ctr]  = moments.first;
-        second[ctr] = moments.second;
+        first[i]  = moments.first;
+        second[i] = moments.second;
 
-        // Update the counter
-        ++ctr;
+        // Store the results for the first bin of the cell
+        if (i % B == 0)
+            d_tally[cell] = moments;
     }
-    CHECK(ctr == d_tally.size());
 
-    // Reorder vectors
-    {
-        std::vector<int>    tmp_cells  = cells;
-        std::vector<double> tmp_first  = first;
-        std::vector<double> tmp_second = second;
-        for (int i = 0; i < d_cell_map.size(); ++i)
-        {
-            int ind = d_cell_map[i];
-            cells[i]  = tmp_cells[ind];
-            first[i]  = tmp_first[ind];
-            second[i] = tmp_second[ind];
-        }
-    }
+    // Finish any cycle output before the file is written, and wait for the
+    // cycle output of other tallies (HDF5 is not called concurrently)
+    if (d_cycle_writer)
+        d_cycle_writer->close();
+    Cycle_Output::drain_all();
 
 #ifdef USE_HDF5
     Serial_HDF5_Writer writer;
@@ -296,12 +381,34 @@ void Cell_Tally<Geometry>::reset()
         t.second.first  = 0.0;
         t.second.second = 0.0;
     }
+    std::fill(d_moments.begin(), d_moments.end(), Moments(0.0, 0.0));
+    std::fill(d_batch.begin(), d_batch.end(), Moments(0.0, 0.0));
+    d_num_batches = 0;
+    init_threads(d_thread.size());
 
-    ENSURE(d_hist.empty());
+    // Finish any cycle output from the previous solve
+    if (d_cycle_writer)
+        d_cycle_writer->close();
 
     d_cycle = 0;
 }
 
+//---------------------------------------------------------------------------//
+/*
+ * \brief Size thread-private accumulators.
+ */
+template <class Geometry>
+void Cell_Tally<Geometry>::set_num_threads(int num_threads)
+{
+    REQUIRE(num_threads > 0);
+
+    // Keep any results that are pending on the current threads
+    reduce_threads();
+    init_threads(num_threads);
+
+    ENSURE(static_cast<int>(d_thread.size()) == num_threads);
+}
+
 //---------------------------------------------------------------------------//
 /*
  * \brief Track particle and tally..
@@ -312,14 +419,44 @@ void Cell_Tally<Geometry>::accumulate(double            step,
 {
     // Get the cell index
     int cell = d_geometry->cell(p.geo_state());
+    CHECK(cell >= 0 && cell < static_cast<int>(d_index.size()));
 
     // O(1) check to see if we need to tally it
-    if (d_tally.find(cell) != d_tally.end())
+    int n = d_index[cell];
+    if (n < 0)
+        return;
+
+    CHECK(profugus::thread_id() < static_cast<int>(d_thread.size()));
+    auto &thread = d_thread[profugus::thread_id()];
+
+    // Get the response multipliers for the particle
+    const int Nr = thread.response.size();
+    d_bins.evaluate(*b_physics, p, thread.response.data());
+
+    // Offset of the responses for the cell and the particle's group bin
+    int    offset = n * d_bins.size() + d_bins.offset(p);
+    double score  = p.wt() * step;
+
+    // Tally for the history, or straight into the cycle for batch
+    // statistics
+    if (d_statistics == tally::BATCH)
+    {
+        double *cycle = &thread.cycle[offset];
+        for (int r = 0; r < Nr; ++r)
+            cycle[r] += score * thread.response[r];
+    }
+    else
     {
-        CHECK(d_tally.count(cell) == 1);
+        // Record the block on its first score in the history
+        double *hist = &thread.hist[offset];
+        if (!thread.scored[offset / Nr])
+        {
+            thread.scored[offset / Nr] = true;
+            thread.touched.push_back(offset);
+        }
 
-        // Tally for the history
-        d_hist[cell] += p.wt() * step;
+        for (int r = 0; r < Nr; ++r)
+            hist[r] += score * thread.response[r];
     }
 }
 
@@ -332,11 +469,97 @@ void Cell_Tally<Geometry>::accumulate(double            step,
 template <class Geometry>
 void Cell_Tally<Geometry>::clear_local()
 {
-    // Clear the local tally
-    History_Tally tally;
-    std::swap(tally, d_hist);
+    // Clear the local tally on every thread
+    for (auto &thread : d_thread)
+    {
+        std::fill(thread.hist.begin(), thread.hist.end(), 0.0);
+        std::fill(thread.scored.begin(), thread.scored.end(), false);
+        thread.touched.clear();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*
+ * \brief Make empty thread-private accumulators for the current cells.
+ */
+template <class Geometry>
+void Cell_Tally<Geometry>::init_threads(int num_threads)
+{
+    REQUIRE(num_threads > 0);
+
+    Thread_Tally empty;
+    empty.hist.resize(d_moments.size(), 0.0);
+    empty.scored.resize(d_moments.size() / d_bins.num_responses(), false);
+    empty.moments.resize(d_moments.size(), {0.0, 0.0});
+    empty.cycle.resize(d_moments.size(), 0.0);
+    empty.response.resize(d_bins.num_responses(), 0.0);
+    d_thread.assign(num_threads, empty);
+
+    ENSURE(static_cast<int>(d_thread.size()) == num_threads);
+}
+
+//---------------------------------------------------------------------------//
+/*
+ * \brief Reduce thread-private accumulators into the results.
+ *
+ * This must be called outside of a threaded region.
+ */
+template <class Geometry>
+void Cell_Tally<Geometry>::reduce_threads()
+{
+    REQUIRE(!profugus::in_thread_parallel_region());
+
+    for (auto &thread : d_thread)
+    {
+        CHECK(thread.touched.empty());
+        CHECK(thread.moments.size() == d_moments.size());
+        CHECK(thread.cycle.size() == d_cycle_tally.size());
+
+        for (int i = 0, N = d_moments.size(); i < N; ++i)
+        {
+            d_moments[i].first  += thread.moments[i].first;
+            d_moments[i].second += thread.moments[i].second;
+            d_cycle_tally[i]    += thread.cycle[i];
+        }
+
+        std::fill(thread.moments.begin(), thread.moments.end(),
+                  Moments(0.0, 0.0));
+        std::fill(thread.cycle.begin(), thread.cycle.end(), 0.0);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*
+ * \brief Add the cycle tally to the batch moments.
+ *
+ * The cycle tally is added to the first moments and the batch mean, summed
+ * over all domains, to the batch moments.  The cycle tally is cleared.
+ */
+template <class Geometry>
+void Cell_Tally<Geometry>::end_batch(double num_particles)
+{
+    REQUIRE(d_statistics == tally::BATCH);
+    REQUIRE(num_particles > 0.0);
+    REQUIRE(d_cycle_tally.size() == d_moments.size());
+
+    // Add the local first moments
+    for (int i = 0, N = d_moments.size(); i < N; ++i)
+        d_moments[i].first += d_cycle_tally[i];
+
+    // Sum the batch over all domains
+    profugus::global_sum(d_cycle_tally.data(), d_cycle_tally.size());
+
+    // Accumulate the batch means
+    double inv_N = 1.0 / num_particles;
+    for (int i = 0, N = d_moments.size(); i < N; ++i)
+    {
+        double mean = d_cycle_tally[i] * inv_N;
+        d_batch[i].first  += mean;
+        d_batch[i].second += mean * mean;
+    }
 
-    ENSURE(d_hist.empty());
+    std::fill(d_cycle_tally.begin(), d_cycle_tally.end(), 0.0);
+    ++d_num_batches;
 }
 
 } // end namespace profugus
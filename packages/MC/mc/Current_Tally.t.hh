@@ -14,6 +14,7 @@
 #include <algorithm>
 
 #include "Current_Tally.hh"
+#include "Cycle_Output.hh"
 
 #include "comm/global.hh"
 #include "harness/DBC.hh"
@@ -453,6 +454,9 @@ void Current_Tally<Geometry>::finalize(double num_particles)
 #ifdef USE_HDF5
     std::string filename = d_problem_name + "_current.h5";
 
+    // wait for any cycle output (HDF5 is not called concurrently)
+    Cycle_Output::drain_all();
+
     Serial_HDF5_Writer writer;
     writer.open(filename);
 
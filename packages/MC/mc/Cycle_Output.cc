@@ -0,0 +1,413 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   MC/mc/Cycle_Output.cc
+ * \author Thomas M. Evans
+ * \date   Fri Oct 16 09:12:44 2026
+ * \brief  Cycle_Output member definitions.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "Cycle_Output.hh"
+
+#include <Utils/config.h>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "harness/DBC.hh"
+#include "comm/global.hh"
+
+#ifdef USE_HDF5
+#include "utils/Serial_HDF5_Writer.hh"
+#endif
+
+namespace profugus
+{
+
+#ifdef USE_HDF5
+
+//===========================================================================//
+/*!
+ * \class Cycle_Output::Writer
+ * \brief Background thread that performs the cycle-output HDF5 calls.
+ *
+ * Jobs are processed in the order they are pushed.  An exception thrown on
+ * the writer thread is stored and rethrown by the next call to drain().  The
+ * writer is only used when the HDF5 library is thread-safe; otherwise jobs
+ * are processed directly on the calling thread.
+ */
+//===========================================================================//
+
+class Cycle_Output::Writer
+{
+  public:
+    //! Writer job.
+    struct Job
+    {
+        // File, filename, and dataset.
+        std::shared_ptr<Serial_HDF5_Writer> file;
+        std::string                         filename;
+        std::string                         dataset;
+
+        // Row to append; the file is closed if the row is empty.
+        Vec_Dbl row;
+    };
+
+  private:
+    // Job queue and synchronization.
+    std::mutex              d_mutex;
+    std::condition_variable d_work, d_idle;
+    std::deque<Job>         d_jobs;
+    bool                    d_busy;
+    bool                    d_done;
+    std::exception_ptr      d_error;
+
+    // Worker thread.
+    std::thread d_thread;
+
+  public:
+    // Constructor.
+    Writer()
+        : d_busy(false)
+        , d_done(false)
+    {
+        d_thread = std::thread([this]() { this->run(); });
+    }
+
+    // Destructor; finishes all queued jobs.
+    ~Writer()
+    {
+        {
+            std::lock_guard<std::mutex> lock(d_mutex);
+            d_done = true;
+        }
+        d_work.notify_one();
+        d_thread.join();
+    }
+
+    // Queue a job.
+    void push(Job job)
+    {
+        {
+            std::lock_guard<std::mutex> lock(d_mutex);
+            d_jobs.push_back(std::move(job));
+        }
+        d_work.notify_one();
+    }
+
+    // Wait until all queued jobs are done.
+    void drain()
+    {
+        std::unique_lock<std::mutex> lock(d_mutex);
+        d_idle.wait(lock, [this]() { return d_jobs.empty() && !d_busy; });
+
+        if (d_error)
+        {
+            std::exception_ptr error;
+            std::swap(error, d_error);
+            std::rethrow_exception(error);
+        }
+    }
+
+    // Get the writer shared by all cycle outputs, making it if needed.
+    static std::shared_ptr<Writer> instance()
+    {
+        auto writer = shared().lock();
+        if (!writer)
+        {
+            writer   = std::make_shared<Writer>();
+            shared() = writer;
+        }
+        return writer;
+    }
+
+    // Get the shared writer (null if there is none).
+    static std::shared_ptr<Writer> current() { return shared().lock(); }
+
+    // Whether HDF5 may be called from the writer thread.
+    static bool threadsafe_hdf5()
+    {
+#if H5_VERSION_GE(1, 8, 16)
+        hbool_t threadsafe = 0;
+        return H5is_library_threadsafe(&threadsafe) >= 0 && threadsafe;
+#elif defined(H5_HAVE_THREADSAFE)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    // Process a job.
+    static void process(Job &job)
+    {
+        Serial_HDF5_Writer &file = *job.file;
+
+        // close the file
+        if (job.row.empty())
+        {
+            if (!file.closed())
+                file.close();
+            return;
+        }
+
+        // open the file the first time a row is written; append to it if it
+        // already exists
+        if (file.closed())
+        {
+            bool exists = std::ifstream(job.filename.c_str()).good();
+            file.open(job.filename, exists ? HDF5_IO::APPEND
+                                           : HDF5_IO::CLOBBER);
+        }
+
+        if (!file.query(job.dataset))
+            file.create_extendible_dataset(job.dataset, job.row.size());
+
+        file.append_row(job.dataset, job.row.data(), job.row.size());
+    }
+
+  private:
+    // Storage for the shared writer.
+    static std::weak_ptr<Writer>& shared()
+    {
+        static std::weak_ptr<Writer> writer;
+        return writer;
+    }
+
+    // Thread loop.
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(d_mutex);
+        while (true)
+        {
+            d_work.wait(lock, [this]() { return d_done || !d_jobs.empty(); });
+            if (d_jobs.empty())
+                break;
+
+            Job job = std::move(d_jobs.front());
+            d_jobs.pop_front();
+            d_busy = true;
+
+            // do the HDF5 work without holding the lock
+            lock.unlock();
+            try
+            {
+                process(job);
+            }
+            catch (...)
+            {
+                lock.lock();
+                d_error = std::current_exception();
+                lock.unlock();
+            }
+            lock.lock();
+
+            d_busy = false;
+            if (d_jobs.empty())
+                d_idle.notify_all();
+        }
+    }
+
+};
+
+#endif // USE_HDF5
+
+//---------------------------------------------------------------------------//
+// CONSTRUCTOR
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Constructor.
+ *
+ * The file is not opened until the first row is written, so it may be
+ * created or written by other means before then.
+ *
+ * Rows are only written on the background thread when the HDF5 library was
+ * built thread-safe.  HDF5 is not thread-safe by default, and then node 0
+ * writes each row synchronously, on the transport thread, in write().
+ *
+ * \param filename HDF5 output file
+ * \param dataset name of the dataset that rows are appended to
+ */
+Cycle_Output::Cycle_Output(const std::string &filename,
+                           const std::string &dataset)
+    : d_filename(filename)
+    , d_dataset(dataset)
+    , d_pending(false)
+    , d_num_cycles(0)
+{
+    REQUIRE(!d_filename.empty());
+    REQUIRE(!d_dataset.empty());
+
+#ifdef USE_HDF5
+    if (profugus::node() == 0)
+    {
+        d_file = std::make_shared<Serial_HDF5_Writer>();
+
+        // write in the background only if HDF5 can be called from another
+        // thread
+        if (Writer::threadsafe_hdf5())
+            d_writer = Writer::instance();
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Destructor.
+ *
+ * The file is closed; errors are not reported.  Call close() explicitly to
+ * check that all rows were written.
+ */
+Cycle_Output::~Cycle_Output()
+{
+    try
+    {
+        close();
+    }
+    catch (...)
+    {
+    }
+}
+
+//---------------------------------------------------------------------------//
+// PUBLIC FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Add a row for the current cycle.
+ *
+ * This must be called on all domains.  The reduction of the previous row is
+ * completed before the reduction of this row is started.
+ *
+ * \param local local contribution to the row
+ */
+void Cycle_Output::write(const Vec_Dbl &local)
+{
+    REQUIRE(!local.empty());
+
+#ifdef USE_HDF5
+    // finish the previous cycle
+    complete();
+    CHECK(!d_pending);
+
+    // start the reduction for this cycle
+    d_send = local;
+    d_recv.resize(d_send.size());
+    profugus::sum_async(d_request, d_send.data(), d_recv.data(),
+                        d_send.size(), 0);
+    d_pending = true;
+#endif
+
+    ++d_num_cycles;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Complete any reduction and wait for all rows to be written.
+ *
+ * This must be called on all domains.  Errors on the writer thread are
+ * rethrown here.
+ */
+void Cycle_Output::flush()
+{
+    complete();
+
+#ifdef USE_HDF5
+    if (d_writer)
+        d_writer->drain();
+#endif
+
+    ENSURE(!d_pending);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Flush and close the file.
+ *
+ * Writing may continue after the file is closed; the file is reopened and
+ * rows are appended to the existing dataset.
+ */
+void Cycle_Output::close()
+{
+    complete();
+
+#ifdef USE_HDF5
+    if (d_file)
+    {
+        Writer::Job job;
+        job.file     = d_file;
+        job.filename = d_filename;
+
+        if (d_writer)
+        {
+            d_writer->push(std::move(job));
+            d_writer->drain();
+        }
+        else
+        {
+            Writer::process(job);
+        }
+    }
+#endif
+
+    ENSURE(!d_pending);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Wait until all queued rows of all cycle outputs have been written.
+ *
+ * Rows are only queued by write(), so the writer thread stays idle until the
+ * next call to write() on this thread.  Call this before any HDF5 I/O that
+ * does not go through Cycle_Output while cycle output may be in progress.
+ * Errors on the writer thread are rethrown here.
+ */
+void Cycle_Output::drain_all()
+{
+#ifdef USE_HDF5
+    auto writer = Writer::current();
+    if (writer)
+        writer->drain();
+#endif
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Complete the reduction in flight and queue the result.
+ */
+void Cycle_Output::complete()
+{
+    if (!d_pending)
+        return;
+
+    d_request.wait();
+    d_pending = false;
+
+#ifdef USE_HDF5
+    if (d_file)
+    {
+        Writer::Job job;
+        job.file     = d_file;
+        job.filename = d_filename;
+        job.dataset  = d_dataset;
+        job.row      = std::move(d_recv);
+
+        if (d_writer)
+            d_writer->push(std::move(job));
+        else
+            Writer::process(job);
+    }
+#endif
+}
+
+} // end namespace profugus
+
+//---------------------------------------------------------------------------//
+//                 end of Cycle_Output.cc
+//---------------------------------------------------------------------------//
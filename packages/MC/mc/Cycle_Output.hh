@@ -0,0 +1,128 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   MC/mc/Cycle_Output.hh
+ * \author Thomas M. Evans
+ * \date   Fri Oct 16 09:12:44 2026
+ * \brief  Cycle_Output class definition.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef MC_mc_Cycle_Output_hh
+#define MC_mc_Cycle_Output_hh
+
+#include <memory>
+#include <string>
+
+#include "comm/global.hh"
+#include "utils/Definitions.hh"
+
+namespace profugus
+{
+
+class Serial_HDF5_Writer;
+
+//===========================================================================//
+/*!
+ * \class Cycle_Output
+ * \brief Write per-cycle tally results to HDF5, overlapped with transport.
+ *
+ * Each call to write() adds one row, the sum of the local rows over all
+ * domains, to a dataset of dimensions \c [num_cycles, row_size] in an HDF5
+ * file.  The dataset is chunked by row and extended as cycles are added.
+ *
+ * The work is split so that neither the reduction nor the write blocks the
+ * cycle that produced the data:
+ * - write() copies the local row and posts a non-blocking sum to node 0; the
+ *   reduction completes during the next cycle and is waited on by the next
+ *   call to write() (or by flush());
+ * - on node 0 the reduced row is handed to a background writer thread that
+ *   opens the file once and appends rows until close() is called.
+ *
+ * All instances share a single writer thread, and rows are only queued from
+ * the thread that calls write().  HDF5 calls made on that thread, by other
+ * tallies or output, are \b not serialized with the writer: call
+ * drain_all() first, which waits until the writer thread is idle (it stays
+ * idle until the next write()).  Call flush() or close() before doing other
+ * HDF5 I/O on the same file.
+ *
+ * The background writer is only used when the HDF5 library was built
+ * thread-safe, which is not the HDF5 default.  Otherwise the rows are written
+ * synchronously on the transport thread, the thread that calls write().
+ * Only the reductions then overlap with transport.  When HDF5 is not
+ * enabled write() does nothing.
+ */
+//===========================================================================//
+
+class Cycle_Output
+{
+  public:
+    //@{
+    //! Typedefs.
+    typedef def::Vec_Dbl Vec_Dbl;
+    //@}
+
+    // Shared background writer (defined in the implementation).
+    class Writer;
+
+  private:
+    // >>> DATA
+
+    // Output file and dataset.
+    std::string d_filename;
+    std::string d_dataset;
+
+    // HDF5 file (node 0 only; only accessed by the writer thread while
+    // open).
+    std::shared_ptr<Serial_HDF5_Writer> d_file;
+
+    // Background writer (null if HDF5 is not thread-safe).
+    std::shared_ptr<Writer> d_writer;
+
+    // Reduction in flight.
+    Vec_Dbl d_send, d_recv;
+    Request d_request;
+    bool    d_pending;
+
+    // Number of rows written.
+    int d_num_cycles;
+
+  public:
+    // Constructor.
+    Cycle_Output(const std::string &filename, const std::string &dataset);
+
+    // Destructor.
+    ~Cycle_Output();
+
+    // Add a row for the current cycle.
+    void write(const Vec_Dbl &local);
+
+    // Complete any reduction and wait for all rows to be written.
+    void flush();
+
+    // Flush and close the file.
+    void close();
+
+    //! Number of rows written.
+    int num_cycles() const { return d_num_cycles; }
+
+    //! Whether rows are written by the background writer thread.
+    bool asynchronous() const { return static_cast<bool>(d_writer); }
+
+    // Wait until all queued rows of all cycle outputs have been written.
+    static void drain_all();
+
+  private:
+    // >>> IMPLEMENTATION
+
+    // Complete the reduction in flight and queue the result.
+    void complete();
+};
+
+} // end namespace profugus
+
+#endif // MC_mc_Cycle_Output_hh
+
+//---------------------------------------------------------------------------//
+//                 end of Cycle_Output.hh
+//---------------------------------------------------------------------------//
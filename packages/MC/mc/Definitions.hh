@@ -61,6 +61,20 @@ enum Reaction_Type {
 
 } // end namespace physics
 
+//---------------------------------------------------------------------------//
+
+namespace tally
+{
+
+//! Estimators for the statistical error of a tally.
+enum Statistics {
+    HISTORY = 0, //!< From per-history first and second moments
+    BATCH,       //!< From the spread of cycle (batch) means
+    END_STATISTICS
+};
+
+} // end namespace tally
+
 } // end namespace mc
 
 #endif // MC_mc_Definitions_hh
@@ -300,6 +300,9 @@ void Domain_Transporter<Geometry>::process_collision(Particle_t &particle,
     // move the particle to the collision site
     d_geometry->move_to_point(d_step.step(), particle.geo_state());
 
+    // tally the collision with the pre-collision particle state
+    d_tallier->collision(particle);
+
     // sample fission sites
     if (d_sample_fission_sites)
     {
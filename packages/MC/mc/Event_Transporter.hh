@@ -0,0 +1,203 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   MC/mc/Event_Transporter.hh
+ * \author Thomas M. Evans
+ * \date   Fri Oct 16 09:12:44 2026
+ * \brief  Event_Transporter class definition.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef MC_mc_Event_Transporter_hh
+#define MC_mc_Event_Transporter_hh
+
+#include <memory>
+#include <vector>
+
+#include "utils/Definitions.hh"
+#include "Physics.hh"
+#include "Variance_Reduction.hh"
+#include "Tallier.hh"
+
+namespace profugus
+{
+
+//===========================================================================//
+/*!
+ * \class Event_Transporter
+ * \brief Transport a batch of particles on a computational domain one event
+ * at a time.
+ *
+ * This is the event-based alternative to Domain_Transporter.  Instead of
+ * following a single particle from birth to death, up to \c batch_size
+ * particles are kept in flight and each event is applied to all of them
+ * before moving on to the next:
+ *
+ * -# sample distances to collision for particles starting a flight;
+ * -# calculate total cross sections and distances to collision and boundary
+ *    for all particles, with the particles sorted by material and group so
+ *    that cross section data is accessed contiguously;
+ * -# score path-length tallies;
+ * -# process all boundary crossings;
+ * -# process all collisions (in material order);
+ * -# replace dead particles with secondaries of the same history or new
+ *    source particles.
+ *
+ * Each slot runs one source history at a time: secondaries (from splitting
+ * or physics) go onto the slot's own stack and are started in that slot
+ * before it draws the next source particle.  Particle state is held in the
+ * reusable slots themselves (an array of particles); only the per-event data
+ * (distance to collision in mean-free-paths, total cross section, step
+ * length, and material sort key) is stored as a structure-of-arrays indexed
+ * by slot.
+ *
+ * Every particle carries its own random number stream, so when the source
+ * uses counter-based streams the trajectories, and therefore the tally means
+ * and fission sites, are identical to those of Domain_Transporter.
+ *
+ * Many histories are in flight at the same time on a thread, but the tallies
+ * keep a single history accumulator per thread, so per-history moments
+ * cannot be formed.  The tallier must therefore not contain any tallies that
+ * require end_history() (tallies using history statistics); Cell_Tally and
+ * Mesh_Tally use batch statistics by default when \c transport_type is \c
+ * "event".
+ *
+ * \note The particle state itself is not split into a structure-of-arrays;
+ * the physics, tallies and variance reduction all act on whole particles.
+ * The eigenvalue and cell tallies of a reflected c5g7 UO2/MOX lattice agree
+ * with Domain_Transporter within statistics (see tstKCode_Solver).
+ */
+/*!
+ * \example mc/test/tstEvent_Transporter.cc
+ *
+ * Test of Event_Transporter.
+ */
+//===========================================================================//
+
+template <class Geometry>
+class Event_Transporter
+{
+  public:
+    //@{
+    //! Useful typedefs.
+    typedef Geometry                                   Geometry_t;
+    typedef Physics<Geometry_t>                        Physics_t;
+    typedef typename Physics_t::Particle_t             Particle_t;
+    typedef typename Physics_t::Bank_t                 Bank_t;
+    typedef typename Physics_t::Fission_Site_Container Fission_Site_Container;
+    typedef Variance_Reduction<Geometry_t>             Variance_Reduction_t;
+    typedef Tallier<Geometry_t>                        Tallier_t;
+    typedef def::size_type                             size_type;
+    //@}
+
+    //@{
+    //! Smart pointers.
+    typedef std::shared_ptr<Fission_Site_Container> SP_Fission_Sites;
+    typedef std::shared_ptr<Geometry_t>             SP_Geometry;
+    typedef std::shared_ptr<Physics_t>              SP_Physics;
+    typedef std::shared_ptr<Variance_Reduction_t>   SP_Variance_Reduction;
+    typedef std::shared_ptr<Tallier_t>              SP_Tallier;
+    //@}
+
+  private:
+    // >>> DATA
+
+    // Problem geometry implementation.
+    SP_Geometry d_geometry;
+
+    // Problem physics implementation.
+    SP_Physics d_physics;
+
+    // Variance reduction.
+    SP_Variance_Reduction d_var_reduction;
+
+    // Regular tallies.
+    SP_Tallier d_tallier;
+
+    // Fission sites.
+    SP_Fission_Sites d_fission_sites;
+
+  public:
+    // Constructor.
+    explicit Event_Transporter(size_type batch_size = 10000);
+
+    // Set the geometry and physics classes.
+    void set(SP_Geometry geometry, SP_Physics physics);
+
+    // Set the variance reduction.
+    void set(SP_Variance_Reduction reduction);
+
+    // Set regular tallies.
+    void set(SP_Tallier tallies);
+
+    // Set fission site sampling.
+    void set(SP_Fission_Sites fission_sites, double keff);
+
+    // Transport all particles produced by a source functor.
+    template<class Emitter>
+    size_type transport(Emitter &&emit);
+
+    //! Maximum number of particles in flight.
+    size_type batch_size() const { return d_batch_size; }
+
+    //! Return the number of sampled fission sites.
+    int num_sampled_fission_sites() const { return d_num_fission_sites; }
+
+    //! Source history of each fission site sampled since the last set().
+    const std::vector<size_type>& fission_site_histories() const
+    {
+        return d_site_histories;
+    }
+
+  private:
+    // >>> IMPLEMENTATION
+
+    typedef def::Vec_Dbl     Vec_Dbl;
+    typedef std::vector<int> Vec_Slot;
+
+    // Maximum number of particles in flight.
+    size_type d_batch_size;
+
+    // Particle slots.
+    std::vector<Particle_t> d_particles;
+
+    // Per-slot event data.
+    Vec_Dbl d_dist_mfp, d_xs_tot, d_step;
+    std::vector<unsigned int> d_key;
+
+    // Slots that are in flight, at a boundary, and at a collision.
+    Vec_Slot d_active, d_boundary, d_collision;
+
+    // Source history running in each slot and its secondary particles.
+    std::vector<size_type> d_history;
+    std::vector<Bank_t>    d_banks;
+
+    // Flag indicating that fission sites should be sampled.
+    bool d_sample_fission_sites;
+
+    // Number of fission sites sampled and the source history of each.
+    int                    d_num_fission_sites;
+    std::vector<size_type> d_site_histories;
+
+    // Current keff iterate.
+    double d_keff;
+
+    // Start a particle in a slot from the bank or the source.
+    template<class Emitter>
+    bool start(int slot, Emitter &emit, size_type &num_source);
+
+    // Event kernels.
+    void sample_flights();
+    void calc_steps();
+    void tally_steps();
+    void process_boundaries();
+    void process_collisions();
+};
+
+} // end namespace profugus
+
+#endif // MC_mc_Event_Transporter_hh
+
+//---------------------------------------------------------------------------//
+//                 end of Event_Transporter.hh
+//---------------------------------------------------------------------------//
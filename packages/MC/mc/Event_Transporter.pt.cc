@@ -0,0 +1,25 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   MC/mc/Event_Transporter.pt.cc
+ * \author Thomas M. Evans
+ * \date   Fri Oct 16 09:12:44 2026
+ * \brief  Event_Transporter template instantiations
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "Event_Transporter.t.hh"
+#include "geometry/RTK_Geometry.hh"
+#include "geometry/Mesh_Geometry.hh"
+
+namespace profugus
+{
+
+template class Event_Transporter<Core>;
+template class Event_Transporter<Mesh_Geometry>;
+
+} // end namespace profugus
+
+//---------------------------------------------------------------------------//
+//                 end of Event_Transporter.pt.cc
+//---------------------------------------------------------------------------//
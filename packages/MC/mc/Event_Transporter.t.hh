@@ -0,0 +1,461 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   MC/mc/Event_Transporter.t.hh
+ * \author Thomas M. Evans
+ * \date   Fri Oct 16 09:12:44 2026
+ * \brief  Event_Transporter template member definitions.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef MC_mc_Event_Transporter_t_hh
+#define MC_mc_Event_Transporter_t_hh
+
+#include <cmath>
+#include <algorithm>
+
+#include "harness/DBC.hh"
+#include "harness/Diagnostics.hh"
+#include "geometry/Definitions.hh"
+#include "Definitions.hh"
+#include "Step_Selector.hh"
+#include "Event_Transporter.hh"
+
+namespace profugus
+{
+
+//---------------------------------------------------------------------------//
+// CONSTRUCTOR
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Constructor.
+ *
+ * The particle slots and event data are allocated here, once, and reused for
+ * every call to transport().
+ *
+ * \param batch_size maximum number of particles in flight
+ */
+template <class Geometry>
+Event_Transporter<Geometry>::Event_Transporter(size_type batch_size)
+    : d_batch_size(batch_size)
+    , d_particles(batch_size)
+    , d_dist_mfp(batch_size, 0.0)
+    , d_xs_tot(batch_size, 0.0)
+    , d_step(batch_size, 0.0)
+    , d_key(batch_size, 0)
+    , d_history(batch_size, 0)
+    , d_banks(batch_size)
+    , d_sample_fission_sites(false)
+    , d_num_fission_sites(0)
+    , d_keff(0.0)
+{
+    VALIDATE(d_batch_size > 0, "Event batch size must be positive, "
+             << d_batch_size << " requested.");
+}
+
+//---------------------------------------------------------------------------//
+// PUBLIC FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Set the geometry and physics classes.
+ *
+ * \param geometry
+ * \param physics
+ */
+template <class Geometry>
+void Event_Transporter<Geometry>::set(SP_Geometry geometry,
+                                      SP_Physics  physics)
+{
+    REQUIRE(geometry);
+    REQUIRE(physics);
+
+    d_geometry = geometry;
+    d_physics  = physics;
+
+    if (d_var_reduction)
+    {
+        d_var_reduction->set(d_geometry);
+        d_var_reduction->set(d_physics);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Set the variance reduction.
+ *
+ * \param reduction
+ */
+template <class Geometry>
+void Event_Transporter<Geometry>::set(SP_Variance_Reduction reduction)
+{
+    REQUIRE(reduction);
+    d_var_reduction = reduction;
+
+    if (d_geometry)
+        d_var_reduction->set(d_geometry);
+    if (d_physics)
+        d_var_reduction->set(d_physics);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Set regular tallies.
+ *
+ * \param tallies
+ */
+template <class Geometry>
+void Event_Transporter<Geometry>::set(SP_Tallier tallies)
+{
+    REQUIRE(tallies);
+    d_tallier = tallies;
+    ENSURE(d_tallier);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Set fission site sampling.
+ *
+ * \param fission_sites
+ * \param keff
+ */
+template <class Geometry>
+void Event_Transporter<Geometry>::set(SP_Fission_Sites fission_sites,
+                                      double           keff)
+{
+    // assign the container and set the sampling flag
+    d_fission_sites        = fission_sites;
+    d_sample_fission_sites = static_cast<bool>(d_fission_sites);
+
+    // assign current iterate of keff
+    d_keff = keff;
+
+    // initialize the number of fission sites to 0
+    d_num_fission_sites = 0;
+    d_site_histories.clear();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Transport all particles produced by a source functor.
+ *
+ * The emitter is called as \c emit(p, history) with a particle slot; it
+ * must either initialize the particle as a live source particle, set \c
+ * history to the index of the source history on this domain, and return
+ * true, or return false when the source is exhausted.  Fission sites are
+ * tagged with the history that produced them (see fission_site_histories())
+ * so that callers can order them independently of the event schedule.  Transport continues until all
+ * source particles and their secondaries are dead.
+ *
+ * \return the number of source particles transported
+ */
+template <class Geometry>
+template <class Emitter>
+auto Event_Transporter<Geometry>::transport(Emitter &&emit) -> size_type
+{
+    REQUIRE(d_geometry);
+    REQUIRE(d_physics);
+    REQUIRE(d_var_reduction);
+    REQUIRE(d_tallier);
+    REQUIRE(d_particles.size() == d_batch_size);
+    REQUIRE(d_banks.size() == d_batch_size);
+
+    // histories are interleaved, so per-history moments cannot be formed
+    VALIDATE(d_tallier->num_history_tallies() == 0,
+             "Event-based transport requires tallies that do not need "
+             << "end_history(); use batch tally_statistics.");
+
+    // number of source particles started
+    size_type num_source = 0;
+
+    // fill the slots
+    d_active.clear();
+    for (size_type slot = 0; slot < d_batch_size; ++slot)
+    {
+        if (!start(slot, emit, num_source))
+            break;
+        d_active.push_back(slot);
+    }
+
+    // process events until all particles are dead
+    while (!d_active.empty())
+    {
+        sample_flights();
+        calc_steps();
+        tally_steps();
+        process_boundaries();
+        process_collisions();
+
+        // replace dead particles and compact the slots in flight
+        int num_active = 0;
+        for (int slot : d_active)
+        {
+            // refill the slot with a secondary or the next history
+            if (!d_particles[slot].alive() && !start(slot, emit, num_source))
+                continue;
+            d_active[num_active++] = slot;
+        }
+        d_active.resize(num_active);
+    }
+
+    ENSURE(std::all_of(d_banks.begin(), d_banks.end(),
+                       [](const Bank_t &b) { return b.empty(); }));
+    return num_source;
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Start a particle in a slot.
+ *
+ * Secondaries of the history running in the slot are started before a new
+ * source particle is drawn.
+ *
+ * \return false if there are no more particles to start
+ */
+template <class Geometry>
+template <class Emitter>
+bool Event_Transporter<Geometry>::start(int        slot,
+                                        Emitter   &emit,
+                                        size_type &num_source)
+{
+    REQUIRE(slot >= 0 && slot < static_cast<int>(d_particles.size()));
+
+    Particle_t &p    = d_particles[slot];
+    Bank_t     &bank = d_banks[slot];
+
+    if (!bank.empty())
+    {
+        // get a secondary particle from the bank and make it alive
+        bank.pop(p);
+        p.live();
+    }
+    else
+    {
+        // get a particle from the source
+        if (!emit(p, d_history[slot]))
+            return false;
+        ++num_source;
+
+        // do "source event" tallies on the particle
+        d_tallier->source(p);
+    }
+
+    // the particle begins a new flight
+    p.set_event(events::BORN);
+
+    ENSURE(p.alive());
+    ENSURE(p.rng().assigned());
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Sample the distance to collision for particles starting a flight.
+ *
+ * Particles that were born or collided in the last event begin a new flight;
+ * particles that crossed a boundary continue their current flight.
+ */
+template <class Geometry>
+void Event_Transporter<Geometry>::sample_flights()
+{
+    for (int slot : d_active)
+    {
+        Particle_t &p = d_particles[slot];
+        CHECK(p.alive());
+
+        if (p.event() != events::BOUNDARY)
+        {
+            // calculate distance to collision in mean-free-paths
+            d_dist_mfp[slot] = -std::log(p.rng().ran());
+            p.set_event(events::BOUNDARY);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Calculate the next step and event for all particles in flight.
+ *
+ * Particles are sorted by material and group before the cross sections are
+ * evaluated.  Slots are then partitioned (in sorted order) into particles
+ * that will hit a boundary and particles that will collide.
+ */
+template <class Geometry>
+void Event_Transporter<Geometry>::calc_steps()
+{
+    // sort the particles by material and group
+    const unsigned int num_groups = d_physics->num_groups();
+    for (int slot : d_active)
+    {
+        const Particle_t &p = d_particles[slot];
+        d_key[slot] = p.matid() * num_groups + p.group();
+    }
+    std::sort(d_active.begin(), d_active.end(),
+              [this](int a, int b) { return d_key[a] < d_key[b]; });
+
+    d_boundary.clear();
+    d_collision.clear();
+
+    Step_Selector step;
+    for (int slot : d_active)
+    {
+        Particle_t &p = d_particles[slot];
+        CHECK(p.event() == events::BOUNDARY);
+        CHECK(d_dist_mfp[slot] > 0.0);
+
+        // total interaction cross section
+        double xs_tot = d_physics->total(physics::TOTAL, p);
+        CHECK(xs_tot >= 0.0);
+
+        // sample distance to next collision
+        double dist_col = constants::huge;
+        if (xs_tot > 0.0)
+            dist_col = d_dist_mfp[slot] / xs_tot;
+
+        // select the nearest of the collision and the next boundary
+        step.initialize(dist_col, events::COLLISION);
+        step.submit(d_geometry->distance_to_boundary(p.geo_state()),
+                    events::BOUNDARY);
+
+        // set the next event in the particle
+        CHECK(step.tag() < events::END_EVENT);
+        p.set_event(static_cast<events::Event>(step.tag()));
+
+        d_xs_tot[slot] = xs_tot;
+        d_step[slot]   = step.step();
+
+        if (p.event() == events::BOUNDARY)
+            d_boundary.push_back(slot);
+        else
+            d_collision.push_back(slot);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Score path-length tallies for all particles in flight.
+ *
+ * Tallies see the particle at the beginning of the step; the particles are
+ * moved when the events are processed.
+ */
+template <class Geometry>
+void Event_Transporter<Geometry>::tally_steps()
+{
+    for (int slot : d_active)
+    {
+        d_tallier->path_length(d_step[slot], d_particles[slot]);
+
+        // update the mfp distance travelled
+        d_dist_mfp[slot] -= d_step[slot] * d_xs_tot[slot];
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Process all particles at a boundary.
+ */
+template <class Geometry>
+void Event_Transporter<Geometry>::process_boundaries()
+{
+    for (int slot : d_boundary)
+    {
+        Particle_t &p = d_particles[slot];
+        REQUIRE(p.alive());
+        REQUIRE(p.event() == events::BOUNDARY);
+
+        // move the particle to the surface
+        d_geometry->move_to_surface(p.geo_state());
+
+        // get the in/out state of the particle
+        int state = d_geometry->boundary_state(p.geo_state());
+
+        // process surface tally events on non-reflecting surfaces
+        if (state != geometry::REFLECT)
+            d_tallier->surface(p);
+
+        // reflected flag
+        bool reflected = false;
+
+        switch (state)
+        {
+            case geometry::OUTSIDE:
+                // the particle has left the problem geometry
+                p.set_event(events::ESCAPE);
+                p.kill();
+
+                DIAGNOSTICS_TWO(integers["geo_escape"]++);
+                break;
+
+            case geometry::REFLECT:
+                // the particle has hit a reflecting surface
+                reflected = d_geometry->reflect(p.geo_state());
+                CHECK(reflected);
+
+                DIAGNOSTICS_TWO(integers["geo_reflect"]++);
+                break;
+
+            case geometry::INSIDE:
+                // update the material id of the region the particle has
+                // entered and apply variance reduction
+                p.set_matid(d_geometry->matid(p.geo_state()));
+                d_var_reduction->post_surface(p, d_banks[slot]);
+
+                DIAGNOSTICS_TWO(integers["geo_surface"]++);
+                break;
+
+            default:
+                CHECK(0);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Process all particles at a collision site (in material order).
+ */
+template <class Geometry>
+void Event_Transporter<Geometry>::process_collisions()
+{
+    for (int slot : d_collision)
+    {
+        Particle_t &p = d_particles[slot];
+        REQUIRE(p.alive());
+        REQUIRE(p.event() == events::COLLISION);
+
+        // move the particle to the collision site
+        d_geometry->move_to_point(d_step[slot], p.geo_state());
+
+        // tally the collision with the pre-collision particle state
+        d_tallier->collision(p);
+
+        // sample fission sites
+        if (d_sample_fission_sites)
+        {
+            CHECK(d_fission_sites);
+            CHECK(d_keff > 0.0);
+            auto num_sites = d_fission_sites->size();
+            d_num_fission_sites += d_physics->sample_fission_site(
+                p, *d_fission_sites, d_keff);
+
+            // tag the new sites with the source history
+            d_site_histories.resize(
+                d_site_histories.size() + d_fission_sites->size() - num_sites,
+                d_history[slot]);
+        }
+
+        // use the physics package to process the collision
+        d_physics->collide(p, d_banks[slot]);
+
+        // apply weight windows
+        d_var_reduction->post_collision(p, d_banks[slot]);
+    }
+}
+
+} // end namespace profugus
+
+#endif // MC_mc_Event_Transporter_t_hh
+
+//---------------------------------------------------------------------------//
+//                 end of Event_Transporter.t.hh
+//---------------------------------------------------------------------------//
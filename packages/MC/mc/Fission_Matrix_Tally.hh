@@ -133,9 +133,6 @@ class Fission_Matrix_Tally : public Compound_Tally<Geometry>
         // Common fission matrix tally data.
         SP_FM_Data d_data;
 
-        // Geometric state on the fission tally mesh geometry.
-        Mesh_Geometry::Geo_State_t d_fm_state;
-
       public:
         // Constructor.
         PL_Tally(SP_Physics physics, SP_FM_Data data)
@@ -176,6 +173,9 @@ class Fission_Matrix_Tally : public Compound_Tally<Geometry>
     //! Clear/re-initialize all tally values between solves
     void reset();
 
+    //! The fission matrix is built from cycle sums; no end-of-history work.
+    bool requires_end_history() const { return false; }
+
   private:
     // >>> IMPLEMENTATION
 
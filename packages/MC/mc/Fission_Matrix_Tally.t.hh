@@ -12,6 +12,7 @@
 #define MC_mc_Fission_Matrix_Tally_t_hh
 
 #include "Fission_Matrix_Tally.hh"
+#include "Cycle_Output.hh"
 
 #include <sstream>
 #include <algorithm>
@@ -80,7 +81,8 @@ Fission_Matrix_Tally<Geometry>::Fission_Matrix_Tally(RCP_Std_DB       db,
         CHECK(db->isParameter("problem_name"));
         d_filename = db->get<std::string>("problem_name") + "_fm.h5";
 
-        // make the initial file
+        // make the initial file (after any cycle output is written)
+        Cycle_Output::drain_all();
         d_writer.open(d_filename);
         d_writer.close();
 #else
@@ -144,6 +146,9 @@ void Fission_Matrix_Tally<Geometry>::end_cycle(double num_particles)
         // use the processor to build the global fission matrix
         d_processor.build_matrix(d_data->d_numerator, d_data->d_denominator);
 
+        // wait for any cycle output (HDF5 is not called concurrently)
+        Cycle_Output::drain_all();
+
         // open the file - writing is only on proc 0
         d_writer.open(d_filename, HDF5_IO::APPEND, 0);
 
@@ -273,8 +278,6 @@ void Fission_Matrix_Tally<Geometry>::PL_Tally::accumulate(
         double            step,
         const Particle_t &p)
 {
-    using geometry::INSIDE;
-
     // return if we haven't started tallying yet
     if (d_data->d_cycle_start > d_data->d_cycle_ctr)
         return;
@@ -284,53 +287,23 @@ void Fission_Matrix_Tally<Geometry>::PL_Tally::accumulate(
     // get the particle's geometric state
     const auto &geo_state = p.geo_state();
 
-    // initialize the particle in the fission-matrix mesh
-    d_data->d_fm_mesh->initialize(d_data->d_geometry->position(geo_state),
-                                  d_data->d_geometry->direction(geo_state),
-                                  d_fm_state);
-
-    // remaining distance before finishing
-    double remaining = step;
-
-    // current fission matrix mesh cell (i)
-    int i = 0;
-
     // cell particle was born in (j)
     int j = p.metadata().template access<int>(d_data->d_birth_idx);
 
-    // distance of current step through the fission matrix
-    double d = 0.0;
-
     // get weighted contribution to the fission matrix tally that is constant
     // across the step
     double keff = p.wt() * this->b_physics->total(physics::NU_FISSION, p);
 
-    // track through the fission matrix and accumulate the fission matrix
-    // elements
-    while (remaining > 0.0)
-    {
-        // calculate next step
-        d = d_data->d_fm_mesh->distance_to_boundary(d_fm_state);
-        if (d > remaining)
-            d = remaining;
-
-        // only accumulate tallies while inside the mesh
-        if (d_data->d_fm_mesh->boundary_state(d_fm_state) == INSIDE)
+    // track through the fission matrix mesh and accumulate the (i,j)
+    // elements for each mesh cell (i) that the step crosses
+    auto &numerator = d_data->d_numerator;
+    d_data->d_fm_mesh->mesh().segment(
+        d_data->d_geometry->position(geo_state),
+        d_data->d_geometry->direction(geo_state), step,
+        [&numerator, j, keff](Cartesian_Mesh::size_type i, double d)
         {
-            // get the current cell
-            i = d_data->d_fm_mesh->cell(d_fm_state);
-            CHECK(i >= 0 && i < d_data->d_fm_mesh->num_cells());
-
-            // tally the fission matrix contribution to the (i,j) element
-            d_data->d_numerator[Idx(i, j)] += d * keff;
-        }
-
-        // subtract this step from the remaining distance
-        remaining -= d;
-
-        // move the particle to the next cell boundary
-        d_data->d_fm_mesh->move_to_surface(d_fm_state);
-    }
+            numerator[Idx(static_cast<int>(i), j)] += d * keff;
+        });
 }
 
 } // end namespace profugus
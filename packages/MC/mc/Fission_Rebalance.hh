@@ -115,6 +115,30 @@ namespace profugus
  *
  * To summarize, in each iteration a set has at most 2 communications with its
  * nearest set neighbor.
+ *
+ * \section all_to_all_rebalance All-to-all rebalance
+ *
+ * When the bank is strongly skewed the neighbor algorithm needs up to \c
+ * N_sets iterations, each with a global convergence check.  The \c
+ * ALL_TO_ALL algorithm instead moves every site directly to its target set in
+ * a single exchange.  Because the current (\c a_i/b_i) and target (\c
+ * ax_i/bx_i) array bounds of \e every set follow from the site counts, each
+ * set computes the overlap of its current bounds with each target range (the
+ * sends) and of its target bounds with each current range (the receives).
+ * The sites are contiguous in the fission bank in global order, so they are
+ * sent directly out of the bank without packing.  In the example above:
+ *
+ * \verbatim
+            i   send to (number of sites)        receive from
+   -----------------------------------------------------------------
+            0   1 (251), 2 (57)                  --
+            1   2 (114)                          0 (251)
+            2   3 (70)                           0 (57), 1 (114)
+            3   --                               2 (70)
+   \endverbatim
+ *
+ * After rebalance the sites are in the same global order as before, and the
+ * result is identical to the neighbor algorithm's.
  */
 /*!
  * \example mc/test/tstFission_Rebalance.cc
@@ -138,9 +162,16 @@ class Fission_Rebalance
     typedef std::pair<int, int>                         Array_Bnds;
     //@}
 
+    //! Rebalance algorithms.
+    enum Algorithm
+    {
+        NEIGHBOR = 0, //!< iterative exchange with nearest neighbors
+        ALL_TO_ALL    //!< single exchange directly to target sets
+    };
+
   public:
     // Constructor.
-    Fission_Rebalance();
+    explicit Fission_Rebalance(Algorithm algorithm = NEIGHBOR);
 
     // Rebalance the fission bank across all sets.
     void rebalance(Fission_Site_Container_t &fission_bank);
@@ -165,6 +196,9 @@ class Fission_Rebalance
     //! Return number of iterations for this rebalance.
     int num_iterations() const { return d_num_iter; }
 
+    //! Rebalance algorithm.
+    Algorithm algorithm() const { return d_algorithm; }
+
   private:
     // >>> IMPLEMENTATION
 
@@ -174,6 +208,12 @@ class Fission_Rebalance
     // Communicate fission bank sites during a rebalance step.
     void communicate(Fission_Site_Container_t &fission_bank);
 
+    // Exchange all fission bank sites directly with their target sets.
+    void exchange(Fission_Site_Container_t &fission_bank);
+
+    // Target global fission bank array bounds on a set.
+    Array_Bnds target_bnds(int set) const;
+
     // Calculate the number of fission sites across all sets.
     void calc_num_sites(const Fission_Site_Container_t &fission_bank);
 
@@ -190,6 +230,9 @@ class Fission_Rebalance
                  Fission_Site_Container_t &recv_bank, int destination,
                  profugus::Request &handle, int tag);
 
+    // Rebalance algorithm.
+    Algorithm d_algorithm;
+
     // Number of sets and this set.
     int d_num_sets, d_set;
 
@@ -220,6 +263,9 @@ class Fission_Rebalance
     // Receive banks.
     Fission_Site_Container_t d_recv_left, d_recv_right;
 
+    // All-to-all byte counts and offsets by set.
+    Vec_Int d_send_counts, d_send_offsets, d_recv_counts, d_recv_offsets;
+
     // Counters for send/receive diagnostics.
     int d_num_recv, d_num_send, d_num_iter;
 
@@ -28,10 +28,13 @@ namespace profugus
 //---------------------------------------------------------------------------//
 /*!
  * \brief Constructor.
+ *
+ * \param algorithm rebalance algorithm
  */
 template <class Geometry>
-Fission_Rebalance<Geometry>::Fission_Rebalance()
-    : d_num_sets(profugus::nodes())
+Fission_Rebalance<Geometry>::Fission_Rebalance(Algorithm algorithm)
+    : d_algorithm(algorithm)
+    , d_num_sets(profugus::nodes())
     , d_set(profugus::node())
     , d_left(-1)
     , d_right(-1)
@@ -44,6 +47,15 @@ Fission_Rebalance<Geometry>::Fission_Rebalance()
     if (d_num_sets == 1)
         return;
 
+    // size the all-to-all counts
+    if (d_algorithm == ALL_TO_ALL)
+    {
+        d_send_counts.resize(d_num_sets);
+        d_send_offsets.resize(d_num_sets);
+        d_recv_counts.resize(d_num_sets);
+        d_recv_offsets.resize(d_num_sets);
+    }
+
     // get left and right neighbors
     if (d_set > 0)
     {
@@ -65,7 +77,7 @@ Fission_Rebalance<Geometry>::Fission_Rebalance()
  * \brief Rebalance the fission bank across sets.
  *
  * When the number of sets is greater than 1, the fission bank is rebalanced
- * across all of the sets using the algorithm described in the
+ * across all of the sets using one of the algorithms described in the
  * Fission_Rebalance class description.
  *
  * When the number of sets is equal to 1, this is a no-op.
@@ -99,6 +111,16 @@ void Fission_Rebalance<Geometry>::rebalance(
 
     // set-up global/local fission bank parameters
     fission_bank_parameters(fission_bank);
+
+    // move all sites to their targets in one exchange
+    if (d_algorithm == ALL_TO_ALL)
+    {
+        exchange(fission_bank);
+        d_num_iter = 1;
+        CHECK(static_cast<int>(fission_bank.size()) == d_target_set);
+        return;
+    }
+
     profugus::global_barrier();
 
     // actual fissions on the set
@@ -273,6 +295,98 @@ void Fission_Rebalance<Geometry>::communicate(
     ENSURE(!d_handle_left.inuse());
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Exchange all fission bank sites directly with their target sets.
+ *
+ * The sites on this set occupy the global array bounds \c d_bnds; the sites
+ * sent to set \e q are the overlap of \c d_bnds with the target bounds of
+ * \e q.  Similarly, the sites received from \e q are the overlap of its
+ * current bounds with the target bounds on this set.  The sites are sent and
+ * received (as bytes) in a single all-to-all.
+ */
+template <class Geometry>
+void Fission_Rebalance<Geometry>::exchange(
+        Fission_Site_Container_t &fission_bank)
+{
+    REQUIRE(d_algorithm == ALL_TO_ALL);
+    REQUIRE(static_cast<int>(d_send_counts.size()) == d_num_sets);
+    REQUIRE(static_cast<int>(fission_bank.size()) == d_sites_set[d_set]);
+
+    // current global array bounds on each set
+    int first = 0;
+
+    for (int q = 0; q < d_num_sets; ++q)
+    {
+        // sites on this set that go to q
+        Array_Bnds target = target_bnds(q);
+        int lo = std::max(d_bnds.first, target.first);
+        int hi = std::min(d_bnds.second, target.second);
+        d_send_counts[q]  = std::max(hi - lo + 1, 0) * d_size_fs;
+        d_send_offsets[q] = (lo - d_bnds.first) * d_size_fs;
+
+        // sites on q that come to this set
+        int last = first + d_sites_set[q] - 1;
+        lo = std::max(first, d_target_bnds.first);
+        hi = std::min(last, d_target_bnds.second);
+        d_recv_counts[q]  = std::max(hi - lo + 1, 0) * d_size_fs;
+        d_recv_offsets[q] = (lo - d_target_bnds.first) * d_size_fs;
+        first = last + 1;
+
+        // count the messages to/from other sets
+        if (q != d_set)
+        {
+            if (d_send_counts[q]) ++d_num_send;
+            if (d_recv_counts[q]) ++d_num_recv;
+        }
+    }
+    CHECK(first == d_num_global);
+
+    // make the rebalanced bank
+    Fission_Site_Container_t recv_bank(d_target_set);
+
+    // byte buffers (the all-to-all requires valid pointers for empty banks)
+    char empty = 0;
+    const char *send_buffer = fission_bank.empty() ? &empty :
+        reinterpret_cast<const char *>(&fission_bank[0]);
+    char *recv_buffer = recv_bank.empty() ? &empty :
+        reinterpret_cast<char *>(&recv_bank[0]);
+
+    // send/receive all sites
+    profugus::all_to_all(send_buffer, &d_send_counts[0], &d_send_offsets[0],
+                         recv_buffer, &d_recv_counts[0], &d_recv_offsets[0]);
+
+    fission_bank.swap(recv_bank);
+
+    // update the array bounds
+    d_bnds = d_target_bnds;
+
+    ENSURE(static_cast<int>(fission_bank.size()) == d_target_set);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Target global fission bank array bounds on a set.
+ *
+ * This is the same partitioning as fission_bank_parameters(), evaluated for
+ * any set.
+ */
+template <class Geometry>
+auto Fission_Rebalance<Geometry>::target_bnds(int set) const -> Array_Bnds
+{
+    REQUIRE(set >= 0 && set < d_num_sets);
+
+    int base = d_num_global / d_num_sets;
+    int pad  = d_num_global - base * d_num_sets;
+
+    Array_Bnds bnds;
+    bnds.first  = base * set + std::min(set, pad);
+    bnds.second = bnds.first + base + (set < pad ? 1 : 0) - 1;
+
+    ENSURE(set != d_set || bnds == d_target_bnds);
+    return bnds;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \brief Calculate the number of physics sites on each set and the current
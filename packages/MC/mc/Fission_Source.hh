@@ -56,6 +56,10 @@ namespace profugus
  *
  * \arg \c Np (int) number of particles to use in each cycle (default:
  * 1000)
+ *
+ * \arg \c fission_rebalance (string) algorithm used to rebalance the fission
+ * bank across sets, "neighbor" or "all_to_all" (default: "neighbor"); see
+ * Fission_Rebalance
  */
 /*!
  * \example mc/test/tstFission_Source.cc
@@ -124,6 +128,9 @@ class Fission_Source : public Source<Geometry>
     // Get a particle from the source.
     virtual SP_Particle get_particle();
 
+    // Emit the next source particle into an existing particle.
+    virtual void emit_particle(Particle_t &p);
+
     //! Boolean operator for source (true when source still has particles).
     bool empty() const { return d_num_left == 0; }
 
@@ -179,7 +186,7 @@ class Fission_Source : public Source<Geometry>
 
     // Sample the geometry.
     int sample_geometry(Space_Vector &r, const Space_Vector &omega,
-                        Particle_t &p, RNG_t rng);
+                        Particle_t &p, const RNG_t &rng);
 
     // Initial fission source lower coords and width.
     Space_Vector d_lower;
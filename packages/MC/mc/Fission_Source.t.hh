@@ -40,7 +40,6 @@ Fission_Source<Geometry>::Fission_Source(RCP_Std_DB     db,
                                          SP_Physics     physics,
                                          SP_RNG_Control rng_control)
     : Base(geometry, physics, rng_control)
-    , d_fission_rebalance(std::make_shared<Fission_Rebalance_t>())
     , d_np_requested(0)
     , d_np_total(0)
     , d_np_domain(0)
@@ -54,6 +53,19 @@ Fission_Source<Geometry>::Fission_Source(RCP_Std_DB     db,
     REQUIRE(b_physics);
     REQUIRE(b_rng_control);
 
+    // set the random number stream type
+    Base::set_rng_type(db->get("rng_type", std::string("sprng")));
+
+    // make the fission rebalance
+    std::string rebalance = db->get("fission_rebalance",
+                                    std::string("neighbor"));
+    VALIDATE(rebalance == "neighbor" || rebalance == "all_to_all",
+             "Invalid fission_rebalance " << rebalance
+             << "; must be neighbor or all_to_all");
+    d_fission_rebalance = std::make_shared<Fission_Rebalance_t>(
+        rebalance == "all_to_all" ? Fission_Rebalance_t::ALL_TO_ALL :
+        Fission_Rebalance_t::NEIGHBOR);
+
     // Boundaries in -X, +X, -Y, +Y, -Z, +Z
     Teuchos::Array<double> extents(6, 0.);
 
@@ -140,6 +152,9 @@ void Fission_Source<Geometry>::build_initial_source(SP_Cart_Mesh     mesh,
     d_num_left = d_np_domain;
     d_num_run  = 0;
 
+    // number the histories on this domain
+    Base::make_history_ids(d_np_domain);
+
     // weight per particle
     d_wt = static_cast<double>(d_np_requested) /
            static_cast<double>(d_np_total);
@@ -199,6 +214,9 @@ void Fission_Source<Geometry>::build_source(SP_Fission_Sites &fission_sites)
     d_num_left = d_np_domain;
     d_num_run  = 0;
 
+    // number the histories on this domain
+    Base::make_history_ids(d_np_domain);
+
     // weight per particle
     d_wt = static_cast<double>(d_np_requested) /
            static_cast<double>(d_np_total);
@@ -231,11 +249,6 @@ auto Fission_Source<Geometry>::create_fission_site_container() const
 template <class Geometry>
 auto Fission_Source<Geometry>::get_particle() -> SP_Particle
 {
-    using def::I; using def::J; using def::K;
-
-    REQUIRE(d_wt > 0.0);
-    REQUIRE(profugus::Global_RNG::d_rng.assigned());
-
     // particle
     SP_Particle p;
     CHECK(!p);
@@ -247,14 +260,31 @@ auto Fission_Source<Geometry>::get_particle() -> SP_Particle
         return p;
     }
 
-    SCOPED_TIMER_2("MC::Fission_Source.get_particle");
-
     // make a particle
     p = std::make_shared<Particle_t>();
+    emit_particle(*p);
 
-    // use the global rng on this domain for the random number generator
-    p->set_rng(profugus::Global_RNG::d_rng);
-    RNG rng = p->rng();
+    return p;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Emit the next source particle into an existing particle.
+ */
+template <class Geometry>
+void Fission_Source<Geometry>::emit_particle(Particle_t &p)
+{
+    using def::I; using def::J; using def::K;
+
+    REQUIRE(d_wt > 0.0);
+    REQUIRE(profugus::Global_RNG::d_rng.assigned());
+    REQUIRE(d_num_left);
+
+    SCOPED_TIMER_2("MC::Fission_Source.get_particle");
+
+    // use the random number generator for this history
+    p.set_rng(Base::history_RNG(d_num_left - 1));
+    RNG &rng = p.rng();
 
     // material id
     int matid = 0;
@@ -281,13 +311,13 @@ auto Fission_Source<Geometry>::get_particle() -> SP_Particle
         r = b_physics->fission_site(fs);
 
         // intialize the geometry state
-        b_geometry->initialize(r, omega, p->geo_state());
+        b_geometry->initialize(r, omega, p.geo_state());
 
         // get the material id
-        matid = b_geometry->matid(p->geo_state());
+        matid = b_geometry->matid(p.geo_state());
 
         // initialize the physics state at the fission site
-        sampled = b_physics->initialize_fission(fs, *p);
+        sampled = b_physics->initialize_fission(fs, p);
         CHECK(sampled);
 
         // pop this fission site from the list
@@ -295,24 +325,23 @@ auto Fission_Source<Geometry>::get_particle() -> SP_Particle
     }
     else
     {
-        matid = sample_geometry(r, omega, *p, rng);
+        matid = sample_geometry(r, omega, p, rng);
     }
 
     // set the material id in the particle
-    p->set_matid(matid);
+    p.set_matid(matid);
 
     // set particle weight
-    p->set_wt(d_wt);
+    p.set_wt(d_wt);
 
     // make particle alive
-    p->live();
+    p.live();
 
     // update counters
     d_num_left--;
     d_num_run++;
 
-    ENSURE(p->matid() == matid);
-    return p;
+    ENSURE(p.matid() == matid);
 }
 
 //---------------------------------------------------------------------------//
@@ -439,7 +468,7 @@ template <class Geometry>
 int Fission_Source<Geometry>::sample_geometry(Space_Vector       &r,
                                               const Space_Vector &omega,
                                               Particle_t         &p,
-                                              RNG_t               rng)
+                                              const RNG_t        &rng)
 {
     using def::I; using def::J; using def::K;
 
@@ -25,6 +25,10 @@ namespace profugus
 /*!
  * \class Fission_Tally
  * \brief Do pathlength mesh tallies on fission source.
+ *
+ * With tally::BATCH statistics the error is estimated from the cycle (batch)
+ * means instead of per-history moments, as in Cell_Tally; at least two
+ * batches must be tallied.
  */
 /*!
  * \example mc/test/tstFission_Tally.cc
@@ -69,7 +73,8 @@ class Fission_Tally : public Pathlength_Tally<Geometry>
 
   public:
     // Constructor.
-    Fission_Tally(SP_Physics physics);
+    Fission_Tally(SP_Physics        physics,
+                  tally::Statistics statistics = tally::HISTORY);
 
     // Add tally mesh.
     void set_mesh(SP_Mesh mesh);
@@ -77,17 +82,40 @@ class Fission_Tally : public Pathlength_Tally<Geometry>
     // Get tally results.
     const Result& results() const { return d_tally; }
 
+    //! Statistical error estimator.
+    tally::Statistics statistics() const { return d_statistics; }
+
+    //! Number of batches accumulated with batch statistics.
+    int num_batches() const { return d_num_batches; }
+
     // >>> TALLY INTERFACE
 
     // Accumulate first and second moments
     void end_history();
 
+    //! Only history statistics need end_history().
+    bool requires_end_history() const
+    {
+        return d_statistics == tally::HISTORY;
+    }
+
+    // End cycle
+    void end_cycle(double num_particles);
+
     // Do post-processing on first and second moments
     void finalize(double num_particles);
 
     // Clear/re-initialize all tally values between solves
     void reset();
 
+    // >>> THREADING INTERFACE
+
+    // Size thread-private accumulators.
+    void set_num_threads(int num_threads);
+
+    //! Histories can be tallied concurrently.
+    bool thread_safe() const { return true; }
+
     // >>> PATHLENGTH TALLY INTERFACE
 
     // Track particle and tally.
@@ -98,11 +126,45 @@ class Fission_Tally : public Pathlength_Tally<Geometry>
 
     typedef std::vector<double> History_Tally;
 
+    // Thread-private accumulators.
+    struct Thread_Tally
+    {
+        // Tally for a history.
+        History_Tally hist;
+
+        // Cells scored in the current history, and whether each cell is in
+        // the list.
+        std::vector<int>  touched;
+        std::vector<bool> scored;
+
+        // Moments not yet reduced into the results.
+        Result moments;
+
+        // Tally for the current batch.
+        History_Tally cycle;
+    };
+
     // Clear local values.
     void clear_local();
 
-    // Tally for a history.
-    History_Tally d_hist;
+    // Make empty thread-private accumulators for the current mesh.
+    void init_threads(int num_threads);
+
+    // Reduce thread-private accumulators into the results.
+    void reduce_threads();
+
+    // Add the batch tally to the batch moments.
+    void end_batch(double num_particles);
+
+    // Accumulators for each thread.
+    std::vector<Thread_Tally> d_thread;
+
+    // Statistical error estimator.
+    tally::Statistics d_statistics;
+
+    // Sums of batch means and their squares.
+    Result d_batch;
+    int    d_num_batches;
 };
 
 //---------------------------------------------------------------------------//
@@ -15,6 +15,7 @@
 #include <algorithm>
 
 #include "Utils/comm/global.hh"
+#include "Utils/comm/OMP.hh"
 #include "Fission_Tally.hh"
 
 namespace profugus
@@ -25,12 +26,20 @@ namespace profugus
 //---------------------------------------------------------------------------//
 /*!
  * \brief Constructor.
+ *
+ * \param physics physics
+ * \param statistics statistical error estimator
  */
 template <class Geometry>
-Fission_Tally<Geometry>::Fission_Tally(SP_Physics physics)
+Fission_Tally<Geometry>::Fission_Tally(SP_Physics        physics,
+                                       tally::Statistics statistics)
     : Base(physics, false)
     , d_geometry(b_physics->get_geometry())
+    , d_thread(1)
+    , d_statistics(statistics)
+    , d_num_batches(0)
 {
+    REQUIRE(d_statistics < tally::END_STATISTICS);
     REQUIRE(d_geometry);
 
     // set the tally name
@@ -55,7 +64,9 @@ void Fission_Tally<Geometry>::set_mesh(SP_Mesh mesh)
 
     // Resize result vector
     d_tally.resize(mesh->num_cells(),{0.0,0.0});
-    d_hist.resize( mesh->num_cells(),0.0);
+    d_batch.assign(mesh->num_cells(),{0.0,0.0});
+    d_num_batches = 0;
+    init_threads(d_thread.size());
 }
 
 //---------------------------------------------------------------------------//
@@ -67,19 +78,39 @@ void Fission_Tally<Geometry>::set_mesh(SP_Mesh mesh)
 template <class Geometry>
 void Fission_Tally<Geometry>::end_history()
 {
-    REQUIRE( d_tally.size() == d_mesh->num_cells() );
-    REQUIRE( d_hist.size()  == d_mesh->num_cells() );
+    REQUIRE( profugus::thread_id() < static_cast<int>(d_thread.size()) );
 
-    // Iterate through local tally results and add them to the permanent
-    // results
-    for (int cell = 0; cell < d_mesh->num_cells(); ++cell )
+    // Get the accumulators for this thread
+    auto &thread = d_thread[profugus::thread_id()];
+    CHECK( thread.hist.size() == d_mesh->num_cells() );
+
+    // Add the cells scored in this history to the thread's results and
+    // clear them
+    for (int cell : thread.touched)
     {
-        d_tally[cell].first  += d_hist[cell];
-        d_tally[cell].second += d_hist[cell]*d_hist[cell];
+        CHECK( cell >= 0 && cell < static_cast<int>(d_mesh->num_cells()) );
+        double &hist = thread.hist[cell];
+
+        thread.moments[cell].first  += hist;
+        thread.moments[cell].second += hist * hist;
+
+        hist                = 0.0;
+        thread.scored[cell] = false;
     }
+    thread.touched.clear();
+}
 
-    // Clear the local tally
-    clear_local();
+//---------------------------------------------------------------------------//
+/*
+ * \brief End cycle.
+ *
+ * Each cycle is a batch when batch statistics are used.
+ */
+template <class Geometry>
+void Fission_Tally<Geometry>::end_cycle(double num_particles)
+{
+    if (d_statistics == tally::BATCH)
+        end_batch(num_particles);
 }
 
 //---------------------------------------------------------------------------//
@@ -91,6 +122,15 @@ void Fission_Tally<Geometry>::finalize(double num_particles)
 {
     REQUIRE(num_particles > 1);
 
+    // Reduce results from all threads
+    reduce_threads();
+
+    // The error of the mean cannot be estimated from fewer than two batches
+    VALIDATE(d_statistics != tally::BATCH || d_num_batches > 1,
+             "Batch tally statistics need at least two batches (cycles), but "
+             << d_num_batches << " were tallied; run fixed-source problems "
+             << "in cycles or use history tally_statistics.");
+
     // Do a global reduction on moments
     std::vector<double> first( d_tally.size(),  0.0);
     std::vector<double> second(d_tally.size(), 0.0);
@@ -125,7 +165,20 @@ void Fission_Tally<Geometry>::finalize(double num_particles)
         moments.first = avg_l * inv_V;
 
         // Calculate the variance
-        double var = (avg_l2 - avg_l * avg_l) / (num_particles - 1);
+        double var = 0.0;
+        if (d_statistics == tally::BATCH)
+        {
+            // Variance of the mean from the batch means
+            double inv_B  = 1.0 / d_num_batches;
+            double avg_b  = d_batch[cell].first  * inv_B;
+            double avg_b2 = d_batch[cell].second * inv_B;
+            var = std::max(avg_b2 - avg_b * avg_b, 0.0) /
+                  (d_num_batches - 1);
+        }
+        else
+        {
+            var = (avg_l2 - avg_l * avg_l) / (num_particles - 1);
+        }
 
         // Store the error of the sample mean
         moments.second = std::sqrt(var) * inv_V;
@@ -141,30 +194,72 @@ void Fission_Tally<Geometry>::reset()
 {
     // Clear the local tally
     clear_local();
+
+    // Clear the batch moments
+    std::fill(d_batch.begin(), d_batch.end(), Moments(0.0, 0.0));
+    d_num_batches = 0;
 }
 
 //---------------------------------------------------------------------------//
 /*
- * \brief Track particle and tally..
+ * \brief Size thread-private accumulators.
+ */
+template <class Geometry>
+void Fission_Tally<Geometry>::set_num_threads(int num_threads)
+{
+    REQUIRE( num_threads > 0 );
+
+    // Keep any results that are pending on the current threads
+    reduce_threads();
+    init_threads(num_threads);
+
+    ENSURE( static_cast<int>(d_thread.size()) == num_threads );
+}
+
+//---------------------------------------------------------------------------//
+/*
+ * \brief Trace the step through the mesh and tally.
  */
 template <class Geometry>
 void Fission_Tally<Geometry>::accumulate(double            step,
                                          const Particle_t &p)
 {
-    // Get the cell index
-    Mesh::Dim_Vector ijk;
-    const Mesh::Space_Vector &xyz = p.geo_state().d_r;
-    d_mesh->find_upper(xyz,ijk);
-
-    Mesh::size_type cell;
-    bool found = d_mesh->index( ijk[def::I], ijk[def::J], ijk[def::K], cell );
-    if( found )
-    {
-        REQUIRE( cell >= 0 && cell < d_mesh->num_cells() );
+    REQUIRE( d_mesh );
+    CHECK( profugus::thread_id() < static_cast<int>(d_thread.size()) );
+
+    // Get the accumulators for this thread
+    auto &thread = d_thread[profugus::thread_id()];
+
+    // Weighted fission contribution, constant along the step
+    double wt = p.wt() * b_physics->total(physics::NU_FISSION,p);
+
+    const auto &geo_state = p.geo_state();
 
-        // Tally for the history
-        d_hist[cell] += p.wt() * step * b_physics->total(physics::NU_FISSION,p);
+    // With batch statistics, tally straight into the batch
+    if (d_statistics == tally::BATCH)
+    {
+        d_mesh->segment(d_geometry->position(geo_state),
+                        d_geometry->direction(geo_state), step,
+                        [&thread, wt](Mesh::size_type cell, double d)
+                        {
+                            thread.cycle[cell] += wt * d;
+                        });
+        return;
     }
+
+    // Trace the step through the mesh and tally in each cell that it
+    // crosses, recording each cell on its first score
+    d_mesh->segment(d_geometry->position(geo_state),
+                    d_geometry->direction(geo_state), step,
+                    [&thread, wt](Mesh::size_type cell, double d)
+                    {
+                        if (!thread.scored[cell])
+                        {
+                            thread.scored[cell] = true;
+                            thread.touched.push_back(cell);
+                        }
+                        thread.hist[cell] += wt * d;
+                    });
 }
 
 //---------------------------------------------------------------------------//
@@ -176,8 +271,102 @@ void Fission_Tally<Geometry>::accumulate(double            step,
 template <class Geometry>
 void Fission_Tally<Geometry>::clear_local()
 {
-    // Clear the local tally
-    std::fill(d_hist.begin(), d_hist.end(), 0.0);
+    // Clear the local tally on every thread
+    for (auto &thread : d_thread)
+    {
+        std::fill(thread.hist.begin(), thread.hist.end(), 0.0);
+        std::fill(thread.scored.begin(), thread.scored.end(), false);
+        thread.touched.clear();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*
+ * \brief Make empty thread-private accumulators for the current mesh.
+ */
+template <class Geometry>
+void Fission_Tally<Geometry>::init_threads(int num_threads)
+{
+    REQUIRE( num_threads > 0 );
+
+    Thread_Tally empty;
+    empty.hist.resize(d_tally.size(), 0.0);
+    empty.scored.resize(d_tally.size(), false);
+    empty.moments.resize(d_tally.size(), {0.0, 0.0});
+    empty.cycle.resize(d_tally.size(), 0.0);
+    d_thread.assign(num_threads, empty);
+
+    ENSURE( static_cast<int>(d_thread.size()) == num_threads );
+}
+
+//---------------------------------------------------------------------------//
+/*
+ * \brief Reduce thread-private accumulators into the results.
+ *
+ * This must be called outside of a threaded region.
+ */
+template <class Geometry>
+void Fission_Tally<Geometry>::reduce_threads()
+{
+    REQUIRE( !profugus::in_thread_parallel_region() );
+
+    for (auto &thread : d_thread)
+    {
+        CHECK( thread.moments.size() == d_tally.size() );
+
+        for (int cell = 0, N = d_tally.size(); cell < N; ++cell)
+        {
+            d_tally[cell].first  += thread.moments[cell].first;
+            d_tally[cell].second += thread.moments[cell].second;
+        }
+
+        std::fill(thread.moments.begin(), thread.moments.end(),
+                  Moments(0.0, 0.0));
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*
+ * \brief Add the batch tally to the batch moments.
+ *
+ * The batch tally on all threads is added to the first moments and the batch
+ * mean, summed over all domains, to the batch moments.  This must be called
+ * outside of a threaded region.
+ */
+template <class Geometry>
+void Fission_Tally<Geometry>::end_batch(double num_particles)
+{
+    REQUIRE( d_statistics == tally::BATCH );
+    REQUIRE( num_particles > 0.0 );
+    REQUIRE( !profugus::in_thread_parallel_region() );
+
+    // Reduce the batch over threads and add the local first moments
+    std::vector<double> batch(d_tally.size(), 0.0);
+    for (auto &thread : d_thread)
+    {
+        CHECK( thread.cycle.size() == d_tally.size() );
+
+        for (int cell = 0, N = d_tally.size(); cell < N; ++cell)
+            batch[cell] += thread.cycle[cell];
+
+        std::fill(thread.cycle.begin(), thread.cycle.end(), 0.0);
+    }
+    for (int cell = 0, N = d_tally.size(); cell < N; ++cell)
+        d_tally[cell].first += batch[cell];
+
+    // Sum the batch over all domains
+    profugus::global_sum(batch.data(), batch.size());
+
+    // Accumulate the batch means
+    double inv_N = 1.0 / num_particles;
+    for (int cell = 0, N = d_tally.size(); cell < N; ++cell)
+    {
+        double mean = batch[cell] * inv_N;
+        d_batch[cell].first  += mean;
+        d_batch[cell].second += mean * mean;
+    }
+
+    ++d_num_batches;
 }
 
 } // end namespace profugus
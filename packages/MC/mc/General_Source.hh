@@ -90,6 +90,9 @@ class General_Source : public Source<Geometry>
       //! Get particle from source
       SP_Particle get_particle() override;
 
+      //! Generate particle from source into an existing particle
+      void emit_particle(Particle_t &p) override;
+
   private:
 
       using Base::b_geometry;
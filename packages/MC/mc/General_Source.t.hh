@@ -48,6 +48,9 @@ General_Source<Geometry>::General_Source(RCP_ParameterList  db,
     REQUIRE( b_rng_control );
     REQUIRE( b_nodes > 0 );
 
+    // set the random number stream type
+    Base::set_rng_type(db->get("rng_type", std::string("sprng")));
+
     // Resize CDFs
     int num_cells  = b_geometry->num_cells();
     int num_groups = b_physics->num_groups();
@@ -116,6 +119,7 @@ void General_Source<Geometry>::build_source(Teuchos::TwoDArray<double> &source)
 
     // Build RNG
     Base::make_RNG();
+    Base::make_history_ids(d_np_domain);
 
     profugus::global_barrier();
 }
@@ -127,14 +131,6 @@ void General_Source<Geometry>::build_source(Teuchos::TwoDArray<double> &source)
 template <class Geometry>
 auto General_Source<Geometry>::get_particle() -> SP_Particle
 {
-    REQUIRE( d_np_left > 0 );
-    REQUIRE( d_wt > 0.0 );
-    REQUIRE( profugus::Global_RNG::d_rng.assigned() );
-
-    using def::I;
-    using def::J;
-    using def::K;
-
     SP_Particle p;
 
     // Return null particle if no histories left
@@ -143,10 +139,30 @@ auto General_Source<Geometry>::get_particle() -> SP_Particle
 
     // Make particle
     p = std::make_shared<Particle_t>();
-    p->set_rng(profugus::Global_RNG::d_rng);
-    auto rng = p->rng();
+    emit_particle(*p);
+
+    return p;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Generate particle from source into an existing particle
+ */
+template <class Geometry>
+void General_Source<Geometry>::emit_particle(Particle_t &p)
+{
+    REQUIRE( d_np_left > 0 );
+    REQUIRE( d_wt > 0.0 );
+    REQUIRE( profugus::Global_RNG::d_rng.assigned() );
 
-    p->set_wt(d_wt);
+    using def::I;
+    using def::J;
+    using def::K;
+
+    p.set_rng(Base::history_RNG(d_np_run));
+    auto &rng = p.rng();
+
+    p.set_wt(d_wt);
 
     // Sample angle isotropically
     Space_Vector omega;
@@ -161,7 +177,7 @@ auto General_Source<Geometry>::get_particle() -> SP_Particle
     auto g = sampler::sample_discrete_CDF(b_physics->num_groups(),
                                           &d_erg_cdfs[cell][0],
                                           rng.ran());
-    p->set_group(g);
+    p.set_group(g);
 
     // Now determine spatial location within cell
     Space_Vector r;
@@ -178,9 +194,9 @@ auto General_Source<Geometry>::get_particle() -> SP_Particle
         Space_Vector r = {x, y, z};
 
         // Initialize particles geo state
-        b_geometry->initialize(r, omega, p->geo_state());
+        b_geometry->initialize(r, omega, p.geo_state());
 
-        if( cell == b_geometry->cell( p->geo_state() ) )
+        if( cell == b_geometry->cell( p.geo_state() ) )
         {
             found = true;
             break;
@@ -188,17 +204,15 @@ auto General_Source<Geometry>::get_particle() -> SP_Particle
     }
     ENSURE( found );
 
-    auto matid = b_geometry->matid(p->geo_state());
+    auto matid = b_geometry->matid(p.geo_state());
 
-    p->set_matid(matid);
+    p.set_matid(matid);
 
-    p->live();
+    p.live();
 
     // Update counters
     d_np_left--;
     d_np_run++;
-
-    return p;
 }
 
 } // end namespace profugus
@@ -71,6 +71,8 @@ class KCode_Solver : public Keff_Solver<Geometry>
     typedef Pathlength_Tally<Geometry_t>                Pathlength_Tally_t;
     typedef Source_Tally<Geometry_t>                    Source_Tally_t;
     typedef Compound_Tally<Geometry_t>                  Compound_Tally_t;
+    typedef Surface_Tally<Geometry_t>                   Surface_Tally_t;
+    typedef Collision_Tally<Geometry_t>                 Collision_Tally_t;
     typedef typename FS_t::SP_Fission_Sites             SP_Fission_Sites;
     typedef typename Base::SP_Fission_Source            SP_Fission_Source;
     typedef typename Base::SP_FM_Acceleration           SP_FM_Acceleration;
@@ -85,6 +85,7 @@ void KCode_Solver<Geometry>::set(SP_Source_Transporter transporter,
     // create our "disabled" (inactive cycle) tallier
     d_inactive_tallier = std::make_shared<Tallier_t>();
     d_inactive_tallier->set(b_tallier->geometry(), b_tallier->physics());
+    d_inactive_tallier->set_num_threads(b_tallier->num_threads());
 
     d_build_phase = ASSIGNED;
 
@@ -294,9 +295,11 @@ void KCode_Solver<Geometry>::initialize()
         if (tally->inactive_cycle_tally())
         {
             // create tallies (only 1 can be valid)
-            auto pl_t  = std::dynamic_pointer_cast<Pathlength_Tally_t>(tally);
-            auto src_t = std::dynamic_pointer_cast<Source_Tally_t>(tally);
-            auto cpd_t = std::dynamic_pointer_cast<Compound_Tally_t>(tally);
+            auto pl_t   = std::dynamic_pointer_cast<Pathlength_Tally_t>(tally);
+            auto src_t  = std::dynamic_pointer_cast<Source_Tally_t>(tally);
+            auto cpd_t  = std::dynamic_pointer_cast<Compound_Tally_t>(tally);
+            auto surf_t = std::dynamic_pointer_cast<Surface_Tally_t>(tally);
+            auto col_t  = std::dynamic_pointer_cast<Collision_Tally_t>(tally);
 
             // attempt to cast to valid tally types and add the tally
             if (pl_t)
@@ -314,6 +317,14 @@ void KCode_Solver<Geometry>::initialize()
                 CHECK(!pl_t && !src_t);
                 d_inactive_tallier->add_compound_tally(cpd_t);
             }
+            else if (surf_t)
+            {
+                d_inactive_tallier->add_surface_tally(surf_t);
+            }
+            else if (col_t)
+            {
+                d_inactive_tallier->add_collision_tally(col_t);
+            }
             else
             {
                 throw profugus::assertion("Unknown tally type.");
@@ -72,8 +72,8 @@ class KDE_Fission_Source : public Fission_Source<Geometry>
     // Build a source from a fission site container
     virtual void build_source(SP_Fission_Sites &fission_sites) override;
 
-    // Sample a particle
-    virtual SP_Particle get_particle() override;
+    // Sample a particle into an existing particle
+    virtual void emit_particle(Particle_t &p) override;
 
     //! Get the bandwidth
     double bandwidth(cell_type cellid) const
@@ -105,36 +105,22 @@ void KDE_Fission_Source<Geometry>::build_source(SP_Fission_Sites &fission_sites)
 
 //---------------------------------------------------------------------------//
 /*!
- * \brief Sample a particle.
+ * \brief Sample a particle into an existing particle.
  */
 template<class Geometry>
-typename KDE_Fission_Source<Geometry>::SP_Particle
-KDE_Fission_Source<Geometry>::get_particle()
+void KDE_Fission_Source<Geometry>::emit_particle(Particle_t &p)
 {
     using def::I; using def::J; using def::K;
 
     REQUIRE(d_wt > 0.0);
     REQUIRE(profugus::Global_RNG::d_rng.assigned());
-
-    // particle
-    SP_Particle p;
-    CHECK(!p);
-
-    // return a null particle if no source
-    if (!d_num_left)
-    {
-        ENSURE(d_fission_sites ? d_fission_sites->empty() : true);
-        return p;
-    }
+    REQUIRE(d_num_left);
 
     SCOPED_TIMER_2("MC::KDE_Fission_Source.get_particle");
 
-    // make a particle
-    p = std::make_shared<Particle_t>();
-
-    // use the global rng on this domain for the random number generator
-    p->set_rng(profugus::Global_RNG::d_rng);
-    RNG rng = p->rng();
+    // use the random number generator for this history
+    p.set_rng(Base::history_RNG(d_num_left - 1));
+    RNG &rng = p.rng();
 
     // material id
     int matid = 0;
@@ -164,35 +150,34 @@ KDE_Fission_Source<Geometry>::get_particle()
         r = d_kernel->sample_position(r, rng);
 
         // intialize the geometry state
-        b_geometry->initialize(r, omega, p->geo_state());
+        b_geometry->initialize(r, omega, p.geo_state());
 
         // get the material id
-        matid = b_geometry->matid(p->geo_state());
+        matid = b_geometry->matid(p.geo_state());
 
         // initialize the physics state at the fission site
-        sampled = b_physics->initialize_fission(fs, *p);
+        sampled = b_physics->initialize_fission(fs, p);
         CHECK(sampled);
     }
     else
     {
-        matid = this->sample_geometry(r, omega, *p, rng);
+        matid = this->sample_geometry(r, omega, p, rng);
     }
 
     // set the material id in the particle
-    p->set_matid(matid);
+    p.set_matid(matid);
 
     // set particle weight
-    p->set_wt(d_wt);
+    p.set_wt(d_wt);
 
     // make particle alive
-    p->live();
+    p.live();
 
     // update counters
     d_num_left--;
     d_num_run++;
 
-    ENSURE(p->matid() == matid);
-    return p;
+    ENSURE(p.matid() == matid);
 }
 
 //---------------------------------------------------------------------------//
@@ -11,8 +11,6 @@
 #ifndef MC_mc_KDE_Kernel_hh
 #define MC_mc_KDE_Kernel_hh
 
-#include <map>
-#include <utility>
 #include <vector>
 
 #include "utils/Definitions.hh"
@@ -49,8 +47,7 @@ class KDE_Kernel
     typedef profugus::Physics<Geometry>                Physics_t;
     typedef std::shared_ptr<Physics_t>                 SP_Physics;
     typedef typename Physics_t::Fission_Site_Container Fission_Site_Container;
-    typedef std::pair<cell_type, double>               Bandwidth_Element;
-    typedef std::map<cell_type, double>                Bandwidth_Map;
+    typedef std::vector<double>                        Vec_Dbl;
     //@}
 
   protected:
@@ -64,8 +61,8 @@ class KDE_Kernel
     // Stores the exponent to use in calculating the bandwidth
     double b_exponent;
 
-    // Stores the bandwidth on each cell
-    Bandwidth_Map b_bndwidth_map;
+    // Stores the bandwidth on each cell (indexed by cell id)
+    Vec_Dbl b_bandwidths;
 
   public:
     // Constructor.
@@ -84,10 +81,14 @@ class KDE_Kernel
     void calc_bandwidths(const Fission_Site_Container &fis_sites);
 
     //! Return the bandwidth for a given cell
-    double bandwidth(cell_type cellid) const;
+    double bandwidth(cell_type cellid) const
+    {
+        REQUIRE(cellid < b_bandwidths.size());
+        return b_bandwidths[cellid];
+    }
 
     //! Return the bandwidths for all cells
-    std::vector<double> get_bandwidths() const;
+    const Vec_Dbl& get_bandwidths() const { return b_bandwidths; }
 
     //! Manually set the bandwidth
     void set_bandwidth(cell_type cell,
@@ -101,10 +102,6 @@ class KDE_Kernel
     double acceptance_fraction() const;
 
   protected:
-    // >>> IMPLEMENTATION FUNCTIONS
-    std::vector<Space_Vector> communicate_sites(
-        const Fission_Site_Container &fis_sites) const;
-
     // >>> IMPLEMENTATION DATA
 
     // Keeps track of the number of kernel samples
@@ -13,6 +13,9 @@
 
 #include "KDE_Kernel.hh"
 
+#include <algorithm>
+#include <cmath>
+
 #include "harness/DBC.hh"
 #include "comm/global.hh"
 #include "utils/Container_Functions.hh"
@@ -43,119 +46,78 @@ KDE_Kernel<Geometry>::KDE_Kernel(SP_Geometry geometry,
     REQUIRE(b_coefficient > 0.0);
     REQUIRE(b_exponent > -1.0 && b_exponent < 0.0);
 
-    // Setup the bandwidth map (start with a bandwidth of all zero)
-    cell_type num_cells = b_geometry->num_cells();
-    for (cell_type cellid = 0; cellid < num_cells; ++cellid)
-    {
-        b_bndwidth_map[cellid] = 0.0;
-    }
+    // Start with a bandwidth of zero in every cell
+    b_bandwidths.assign(b_geometry->num_cells(), 0.0);
 }
 
 //---------------------------------------------------------------------------//
 // PUBLIC FUNCTIONS
 //---------------------------------------------------------------------------//
 /*!
- * \brief Set the bandwidth for a cell.
+ * \brief Calculate the bandwidth in each cell from the fission sites.
+ *
+ * The bandwidth in a cell is computed from the number of fission sites and
+ * the variance of their axial positions.  Each domain accumulates the count,
+ * sum, and sum-of-squares of the z-position of its local sites in each cell
+ * and these are reduced across domains in a single global sum; the fission
+ * sites themselves are never communicated.
  */
 template<class Geometry>
 void KDE_Kernel<Geometry>::calc_bandwidths(
     const Fission_Site_Container &fis_sites)
 {
-    typedef geometry::cell_type  cell_type;
-
-    // Reset all bandwidths to zero
-    for (cell_type cellid = 0; cellid < b_geometry->num_cells(); ++cellid)
-    {
-        b_bndwidth_map[cellid] = 0.0;
-    }
+    cell_type num_cells = b_geometry->num_cells();
+    CHECK(b_bandwidths.size() == num_cells);
 
-    // Broadcast all of the fission sites to all cores
-    std::vector<Space_Vector> global_sites = this->communicate_sites(fis_sites);
+    // Local per-cell moments of the z-position stored contiguously so they
+    // can be reduced together: [count | sum z | sum z^2]
+    Vec_Dbl moments(3 * num_cells, 0.0);
+    double *num_fs = moments.data();
+    double *sum    = num_fs + num_cells;
+    double *sum_sq = sum + num_cells;
 
-    // Stores a map of the sum and sum-squared of the z-position for each
-    // fission site in each cell as well as the number of fission sites in
-    // each cell
-    std::map<cell_type, double> cell_sums;
-    std::map<cell_type, double> cell_sum_sq;
-    std::map<cell_type, unsigned int> num_fs;
-    for (const Space_Vector& fs : global_sites)
+    for (const auto &fs : fis_sites)
     {
         // Get the Z-position
-        double z = fs[def::Z];
+        double z = fs.r[def::Z];
 
         // Get the cell
-        cell_type cell = b_geometry->cell(fs);
+        cell_type cell = b_geometry->cell(fs.r);
+        CHECK(cell < num_cells);
 
-        cell_sums[cell]   += z;
-        cell_sum_sq[cell] += z*z;
-        num_fs[cell]      += 1;
+        num_fs[cell] += 1.0;
+        sum[cell]    += z;
+        sum_sq[cell] += z*z;
     }
 
-    // Loop over the cells and calculate the bandwidths
-    auto cell_sum_iter = cell_sums.cbegin();
-    auto cell_sq_iter  = cell_sum_sq.cbegin();
-    for (auto num_fs_iter = num_fs.cbegin(); num_fs_iter != num_fs.cend();
-         ++num_fs_iter, ++cell_sum_iter, ++cell_sq_iter)
+    // Reduce the moments across all domains
+    profugus::global_sum(moments.data(), moments.size());
+
+    // Calculate the bandwidths
+    for (cell_type cell = 0; cell < num_cells; ++cell)
     {
-        CHECK(cell_sum_iter != cell_sums.cend());
-        CHECK(cell_sq_iter  != cell_sum_sq.cend());
-        CHECK(cell_sum_iter->first == cell_sq_iter->first);
-        CHECK(cell_sum_iter->first == num_fs_iter->first);
+        double N = num_fs[cell];
 
-        // Get the data
-        cell_type cell = cell_sum_iter->first;
-        double sum     = cell_sum_iter->second;
-        double sum_sq  = cell_sq_iter->second;
-        unsigned int N = num_fs_iter->second;
+        // Cells without fission sites have zero bandwidth
+        if (N == 0.0)
+        {
+            b_bandwidths[cell] = 0.0;
+            continue;
+        }
 
         // Calculate the variance
-        double variance = sum_sq/N - (sum/N)*(sum/N);
+        double mean     = sum[cell] / N;
+        double variance = sum_sq[cell] / N - mean * mean;
 
         // Low particle counts can results in very small variance, which can
         // go to zero with roundoff.  Change to zero if this happens
         variance = std::max(variance, 0.0);
 
         // Calculate the bandwidth
-        b_bndwidth_map[cell] = b_coefficient*std::sqrt(variance)*
-                               std::pow(N, b_exponent);
-        CHECK(b_bndwidth_map[cell] >= 0.0);
-    }
-}
-
-//---------------------------------------------------------------------------//
-/*!
- * \brief Return the bandwidth for a given cell.
- */
-template<class Geometry>
-double KDE_Kernel<Geometry>::bandwidth(cell_type cellid) const
-{
-    REQUIRE(b_bndwidth_map.count(cellid) == 1);
-
-    return b_bndwidth_map.find(cellid)->second;
-}
-
-//---------------------------------------------------------------------------//
-/*!
- * \brief Return the bandwidths for all cells.
- */
-template<class Geometry>
-std::vector<double>
-KDE_Kernel<Geometry>::get_bandwidths() const
-{
-    // Create the vector to hold the bandwidths
-    std::vector<double> bandwidths(b_bndwidth_map.size());
-
-    // Loop over the bandwidth map and fill the bandwidth vector
-    std::vector<double>::iterator vec_iter = bandwidths.begin();
-    for (const auto &map_elem : b_bndwidth_map)
-    {
-        CHECK(vec_iter != bandwidths.end());
-
-        // Fill element and update iterator
-        *vec_iter++ = map_elem.first;
+        b_bandwidths[cell] = b_coefficient * std::sqrt(variance) *
+                             std::pow(N, b_exponent);
+        CHECK(b_bandwidths[cell] >= 0.0);
     }
-
-    return bandwidths;
 }
 
 //---------------------------------------------------------------------------//
@@ -166,9 +128,9 @@ template<class Geometry>
 void KDE_Kernel<Geometry>::set_bandwidth(geometry::cell_type cell,
                                          double              bandwidth)
 {
-    REQUIRE(b_bndwidth_map.find(cell) != b_bndwidth_map.end());
+    REQUIRE(cell < b_bandwidths.size());
 
-    b_bndwidth_map[cell] = bandwidth;
+    b_bandwidths[cell] = bandwidth;
 }
 
 //---------------------------------------------------------------------------//
@@ -184,57 +146,6 @@ double KDE_Kernel<Geometry>::acceptance_fraction() const
             static_cast<double>(b_num_sampled));
 }
 
-//---------------------------------------------------------------------------//
-// PRIVATE FUNCTIONS
-//---------------------------------------------------------------------------//
-/*!
- * \brief Extract the local z-locations of the Space_Vector and broadcast to
- *        all cores.
- */
-template<class Geometry>
-std::vector<typename KDE_Kernel<Geometry>::Space_Vector>
-KDE_Kernel<Geometry>::communicate_sites(
-    const Fission_Site_Container &fis_sites) const
-{
-    // >>> COMMUNICATE SIZES
-    // Create a vector to hold all of the local sizes
-    std::vector<int> local_sizes(profugus::nodes(), 0);
-
-    // Set the local size
-    local_sizes[profugus::node()] = fis_sites.size();
-
-    // Communicate all of the local sizes
-    profugus::global_sum(local_sizes.data(), local_sizes.size());
-
-    // Calculate the global size
-    int global_size =
-        std::accumulate(local_sizes.begin(), local_sizes.end(), 0);
-
-    // >>> COMMUNICATE GLOBAL FISSION SITES
-    // Create a vector to hold all of the fission sites
-    std::vector<Space_Vector> global_locs(global_size,
-                                          Space_Vector(0.0, 0.0, 0.0));
-    if (global_size > 0)
-    {
-        // Find the copy index
-        int begin_index =
-            std::accumulate(local_sizes.begin(),
-                            local_sizes.begin() + profugus::node(), 0);
-        CHECK(begin_index + fis_sites.size() <= global_locs.size());
-
-        // Fill the local portion with the z locations
-        std::transform(fis_sites.begin(), fis_sites.end(),
-                       global_locs.begin() + begin_index,
-                       [](const typename Physics_t::Fission_Site &fs)
-                       { return fs.r; });
-
-        // Communicate the vector
-        profugus::global_sum(&global_locs[0][def::X], 3*global_locs.size());
-    }
-
-    return global_locs;
-}
-
 //---------------------------------------------------------------------------//
 } // end namespace profugus
 
@@ -11,6 +11,9 @@
 #ifndef MC_mc_Keff_Tally_hh
 #define MC_mc_Keff_Tally_hh
 
+#include <algorithm>
+#include <cmath>
+
 #include "Tally.hh"
 #include "utils/Definitions.hh"
 
@@ -23,6 +26,10 @@ namespace profugus
  * \brief Use path length to estimate eigenvalue and variance
  *
  * Tally keff during KCode operation using path-length accumulators.
+ *
+ * The thread-private accumulators are fixed-point sums, which are exact and
+ * therefore independent of the order of the contributions; the cycle
+ * estimate does not depend on how histories are distributed over threads.
  */
 /*!
  * \example mc/test/tstKeff_Tally.cc
@@ -65,6 +72,54 @@ class Keff_Tally : public Pathlength_Tally<Geometry>
     //! Accumulated second moment of keff for calculating variance
     double d_keff_sum_sq;
 
+    //! Number of threads tallying concurrently
+    int d_num_threads;
+
+    //! Order-independent sum of path-length estimates
+    struct Exact_Sum
+    {
+        // Whole part and fractional part (in units of 2^-52).
+        long long whole;
+        long long frac;
+
+        Exact_Sum() : whole(0), frac(0) { /* * */ }
+
+        //! Add a value; its bits below 2^-52 are dropped.
+        void add(double x)
+        {
+            double w = std::floor(x);
+            whole += static_cast<long long>(w);
+            frac  += static_cast<long long>(std::ldexp(x - w, d_bits));
+            normalize();
+        }
+
+        //! Add another sum.
+        void add(const Exact_Sum &s)
+        {
+            whole += s.whole;
+            frac  += s.frac;
+            normalize();
+        }
+
+        //! Value of the sum.
+        double value() const
+        {
+            return static_cast<double>(whole) + std::ldexp(frac, -d_bits);
+        }
+
+        //! Carry the whole part of the fraction.
+        void normalize()
+        {
+            whole += frac >> d_bits;
+            frac  &= (1LL << d_bits) - 1;
+        }
+
+        static constexpr int d_bits = 52;
+    };
+
+    //! Thread-private path-length accumulators (one cache line per thread)
+    std::vector<Exact_Sum> d_thread_keff;
+
   public:
     // Kcode solver should construct this with initial keff estimate
     Keff_Tally(double keff_init, SP_Physics physics);
@@ -74,8 +129,8 @@ class Keff_Tally : public Pathlength_Tally<Geometry>
     //! Access all keff estimators, both active and inactive
     const Vec_Dbl& all_keff() const { return d_all_keff; }
 
-    //! Obtain keff estimate from this cycle
-    double latest() const { return d_keff_cycle; }
+    // Obtain keff estimate from this cycle
+    double latest() const;
 
     // Calculate average keff over active cycles
     double mean() const;
@@ -111,10 +166,32 @@ class Keff_Tally : public Pathlength_Tally<Geometry>
     // Clear/re-initialize all tally values between solves.
     virtual void reset() override final;
 
+    //! Keff is estimated per cycle, so there is no end-of-history work.
+    virtual bool requires_end_history() const override final
+    {
+        return false;
+    }
+
+    // Size thread-private accumulators.
+    virtual void set_num_threads(int num_threads) override final;
+
+    //! Keff can be tallied concurrently.
+    virtual bool thread_safe() const override final { return true; }
+
     // >>> SETTERS
 
     //! Set the latest keff in the tally.
-    void set_keff(double k) { d_keff_cycle = k; }
+    void set_keff(double k)
+    {
+        d_keff_cycle = k;
+        std::fill(d_thread_keff.begin(), d_thread_keff.end(), Exact_Sum());
+    }
+
+  private:
+    // >>> IMPLEMENTATION
+
+    // Stride between thread-private accumulators (avoids false sharing).
+    static constexpr int d_stride = 4;
 };
 
 } // end namespace profugus
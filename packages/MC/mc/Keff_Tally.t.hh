@@ -15,6 +15,7 @@
 
 #include "harness/DBC.hh"
 #include "comm/global.hh"
+#include "comm/OMP.hh"
 #include "Definitions.hh"
 
 namespace profugus
@@ -31,6 +32,8 @@ Keff_Tally<Geometry>::Keff_Tally(double     keff_init,
                                  SP_Physics physics)
     : Base(physics, true)
     , d_keff_cycle(keff_init)
+    , d_num_threads(1)
+    , d_thread_keff(d_stride)
 {
     REQUIRE(physics);
 
@@ -43,6 +46,25 @@ Keff_Tally<Geometry>::Keff_Tally(double     keff_init,
 
 //---------------------------------------------------------------------------//
 // PUBLIC FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Obtain the keff estimate from this cycle.
+ *
+ * During a cycle this is the (unnormalized) path-length estimate accumulated
+ * so far, including any contributions that have not yet been reduced from
+ * thread-private storage.
+ */
+template <class Geometry>
+double Keff_Tally<Geometry>::latest() const
+{
+    Exact_Sum keff;
+    for (int t = 0; t < d_num_threads; ++t)
+    {
+        keff.add(d_thread_keff[t * d_stride]);
+    }
+    return d_keff_cycle + keff.value();
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \brief Calculate average keff over active cycles.
@@ -103,8 +125,10 @@ void Keff_Tally<Geometry>::accumulate(double            step,
                             const Particle_t &p)
 {
     REQUIRE(b_physics);
+    REQUIRE(profugus::thread_id() < d_num_threads);
 
-    d_keff_cycle += p.wt() * step * b_physics->total(physics::NU_FISSION, p);
+    d_thread_keff[profugus::thread_id() * d_stride].add(
+        p.wt() * step * b_physics->total(physics::NU_FISSION, p));
 }
 
 //---------------------------------------------------------------------------//
@@ -131,6 +155,7 @@ template <class Geometry>
 void Keff_Tally<Geometry>::begin_cycle()
 {
     d_keff_cycle = 0.;
+    std::fill(d_thread_keff.begin(), d_thread_keff.end(), Exact_Sum());
 }
 
 //---------------------------------------------------------------------------//
@@ -148,6 +173,10 @@ void Keff_Tally<Geometry>::end_cycle(double num_particles)
 {
     REQUIRE(num_particles > 0.);
 
+    // Reduce the thread-private path lengths
+    d_keff_cycle = latest();
+    std::fill(d_thread_keff.begin(), d_thread_keff.end(), Exact_Sum());
+
     // Keff estimate is total nu-sigma-f reaction rate / num particles
     d_keff_cycle /= num_particles;
 
@@ -180,6 +209,24 @@ void Keff_Tally<Geometry>::reset()
     d_all_keff.clear();
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Size thread-private accumulators.
+ *
+ * Any pending thread-private path lengths are kept in the cycle estimate.
+ */
+template <class Geometry>
+void Keff_Tally<Geometry>::set_num_threads(int num_threads)
+{
+    REQUIRE(num_threads > 0);
+
+    d_keff_cycle  = latest();
+    d_num_threads = num_threads;
+    d_thread_keff.assign(d_num_threads * d_stride, Exact_Sum());
+
+    ENSURE(latest() == d_keff_cycle);
+}
+
 } // end namespace profugus
 
 #endif // MC_mc_Keff_Tally_t_hh
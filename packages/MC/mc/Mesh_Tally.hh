@@ -16,6 +16,8 @@
 #include <utility>
 
 #include "Tally.hh"
+#include "Cycle_Output.hh"
+#include "Response_Bins.hh"
 #include "geometry/Cartesian_Mesh.hh"
 
 namespace profugus
@@ -25,6 +27,15 @@ namespace profugus
 /*!
  * \class Mesh_Tally
  * \brief Do pathlength mesh tallies on fission source.
+ *
+ * Setting \c tally_statistics to \c "batch" in the database estimates the
+ * statistical error from the cycle (batch) means instead of per-history
+ * moments, as in Cell_Tally; batch statistics are required for event-based
+ * transport, and at least two batches must be tallied.
+ *
+ * Each mesh cell scores a block of group-bin and response bins (see
+ * Response_Bins); results() is indexed \c [cell][group_bin][response].  By
+ * default there is one bin, the energy-integrated flux.
  */
 /*!
  * \example mc/test/tstMesh_Tally.cc
@@ -66,6 +77,9 @@ class Mesh_Tally : public Pathlength_Tally<Geometry>
     // Cartesian mesh
     SP_Mesh d_mesh;
 
+    // Group bins and responses.
+    Response_Bins d_bins;
+
     // Map of tally moments.
     Result d_tally;
 
@@ -76,6 +90,9 @@ class Mesh_Tally : public Pathlength_Tally<Geometry>
     std::vector<double> d_cycle_tally;
     int d_cycle;
 
+    // Asynchronous writer for cycle fluxes
+    std::shared_ptr<Cycle_Output> d_cycle_writer;
+
     // Parameters
     RCP_Std_DB d_db;
 
@@ -89,14 +106,32 @@ class Mesh_Tally : public Pathlength_Tally<Geometry>
     // Add tally mesh.
     void set_mesh(SP_Mesh mesh);
 
+    // Set the group bins and responses.
+    void set_bins(const Response_Bins &bins);
+
+    //! Group bins and responses.
+    const Response_Bins& bins() const { return d_bins; }
+
     // Get tally results.
     const Result& results() const { return d_tally; }
 
+    //! Statistical error estimator.
+    tally::Statistics statistics() const { return d_statistics; }
+
+    //! Number of batches accumulated with batch statistics.
+    int num_batches() const { return d_num_batches; }
+
     // >>> TALLY INTERFACE
 
     // Accumulate first and second moments
     void end_history();
 
+    //! Only history statistics need end_history().
+    bool requires_end_history() const
+    {
+        return d_statistics == tally::HISTORY;
+    }
+
     // Begin new cycle
     void begin_cycle();
 
@@ -109,6 +144,14 @@ class Mesh_Tally : public Pathlength_Tally<Geometry>
     // Clear/re-initialize all tally values between solves
     void reset();
 
+    // >>> THREADING INTERFACE
+
+    // Size thread-private accumulators.
+    void set_num_threads(int num_threads);
+
+    //! Histories can be tallied concurrently.
+    bool thread_safe() const { return true; }
+
     // >>> PATHLENGTH TALLY INTERFACE
 
     // Track particle and tally.
@@ -119,11 +162,46 @@ class Mesh_Tally : public Pathlength_Tally<Geometry>
 
     typedef std::vector<double> History_Tally;
 
+    // Thread-private accumulators.
+    struct Thread_Tally
+    {
+        // Tally for a history.
+        History_Tally hist;
+
+        // Offsets of the response blocks scored in the current history, and
+        // whether each block is in the list.
+        std::vector<int>  touched;
+        std::vector<bool> scored;
+
+        // Response multipliers for the current step.
+        std::vector<double> response;
+
+        // Moments and cycle tally not yet reduced into the results.
+        Result              moments;
+        std::vector<double> cycle;
+    };
+
     // Clear local values.
     void clear_local();
 
-    // Tally for a history.
-    History_Tally d_hist;
+    // Make empty thread-private accumulators for the current mesh.
+    void init_threads(int num_threads);
+
+    // Reduce thread-private accumulators into the results.
+    void reduce_threads();
+
+    // Add the cycle tally to the batch moments.
+    void end_batch(double num_particles);
+
+    // Accumulators for each thread.
+    std::vector<Thread_Tally> d_thread;
+
+    // Statistical error estimator.
+    tally::Statistics d_statistics;
+
+    // Sums of batch means and their squares.
+    Result d_batch;
+    int    d_num_batches;
 };
 
 //---------------------------------------------------------------------------//
@@ -15,7 +15,7 @@
 #include <algorithm>
 
 #include "Utils/comm/global.hh"
-#include "Utils/harness/Soft_Equivalence.hh"
+#include "Utils/comm/OMP.hh"
 #include "Mesh_Tally.hh"
 #include "utils/Serial_HDF5_Writer.hh"
 
@@ -32,7 +32,11 @@ template <class Geometry>
 Mesh_Tally<Geometry>::Mesh_Tally(RCP_Std_DB db, SP_Physics physics)
     : Base(physics, false)
     , d_geometry(b_physics->get_geometry())
+    , d_bins(b_physics->num_groups())
     , d_db(db)
+    , d_thread(1)
+    , d_statistics(tally::HISTORY)
+    , d_num_batches(0)
 {
     REQUIRE(d_geometry);
 
@@ -46,6 +50,20 @@ Mesh_Tally<Geometry>::Mesh_Tally(RCP_Std_DB db, SP_Physics physics)
     reset();
 
     d_cycle_output = d_db->get("do_cycle_output",false);
+
+    // Statistical error estimator; the event-based transporter interleaves
+    // histories, so it can only be used with batch statistics
+    bool events = (d_db->get("transport_type", std::string("history")) ==
+                   "event");
+    auto statistics = d_db->get("tally_statistics",
+                                std::string(events ? "batch" : "history"));
+    VALIDATE(statistics == "history" || statistics == "batch",
+             "Invalid tally_statistics '" << statistics << "'; must be "
+             "history or batch.");
+    VALIDATE(!events || statistics == "batch",
+             "Event-based transport requires batch tally_statistics.");
+    if (statistics == "batch")
+        d_statistics = tally::BATCH;
 }
 
 //---------------------------------------------------------------------------//
@@ -62,9 +80,18 @@ void Mesh_Tally<Geometry>::set_mesh(SP_Mesh mesh)
     d_mesh = mesh;
 
     // Resize result vector
-    d_tally.resize(mesh->num_cells(),{0.0,0.0});
-    d_hist.resize(mesh->num_cells(),0.0);
-    d_cycle_tally.resize(mesh->num_cells(),0.0);
+    int num_bins = mesh->num_cells() * d_bins.size();
+    d_tally.assign(num_bins,{0.0,0.0});
+    d_cycle_tally.assign(num_bins,0.0);
+    d_batch.assign(num_bins,{0.0,0.0});
+    d_num_batches = 0;
+    init_threads(d_thread.size());
+
+    // Finish any cycle output before the file is rewritten, and wait for
+    // the cycle output of other tallies (HDF5 is not called concurrently)
+    if (d_cycle_writer)
+        d_cycle_writer->close();
+    Cycle_Output::drain_all();
 
 #ifdef USE_HDF5
     Serial_HDF5_Writer writer;
@@ -72,10 +99,33 @@ void Mesh_Tally<Geometry>::set_mesh(SP_Mesh mesh)
     writer.write("x_edges",d_mesh->edges(def::I));
     writer.write("y_edges",d_mesh->edges(def::J));
     writer.write("z_edges",d_mesh->edges(def::K));
+    writer.write("group_bins",d_bins.first_groups());
+    writer.write("responses",std::vector<int>(d_bins.responses().begin(),
+                                              d_bins.responses().end()));
     writer.close();
 #endif
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Set the group bins and responses.
+ *
+ * All accumulated results are cleared.
+ */
+template <class Geometry>
+void Mesh_Tally<Geometry>::set_bins(const Response_Bins &bins)
+{
+    REQUIRE( bins.num_groups() == b_physics->num_groups() );
+
+    d_bins = bins;
+
+    // Size the accumulators for the new bins
+    if (d_mesh)
+        set_mesh(d_mesh);
+    else
+        init_threads(d_thread.size());
+}
+
 //---------------------------------------------------------------------------//
 // DERIVED INTERFACE
 //---------------------------------------------------------------------------//
@@ -85,20 +135,34 @@ void Mesh_Tally<Geometry>::set_mesh(SP_Mesh mesh)
 template <class Geometry>
 void Mesh_Tally<Geometry>::end_history()
 {
-    REQUIRE( d_tally.size() == d_mesh->num_cells() );
-    REQUIRE( d_hist.size()  == d_mesh->num_cells() );
+    REQUIRE( profugus::thread_id() < static_cast<int>(d_thread.size()) );
+
+    // Get the accumulators for this thread
+    auto &thread = d_thread[profugus::thread_id()];
+    CHECK( thread.hist.size() == d_tally.size() );
+
+    const int Nr = d_bins.num_responses();
 
-    // Iterate through local tally results and add them to the permanent
-    // results
-    for (int cell = 0; cell < d_mesh->num_cells(); ++cell )
+    // Add the bins scored in this history to the thread's results and clear
+    // them
+    for (int offset : thread.touched)
     {
-        d_tally[cell].first  += d_hist[cell];
-        d_tally[cell].second += d_hist[cell]*d_hist[cell];
-        d_cycle_tally[cell] += d_hist[cell];
-    }
+        CHECK( offset >= 0 &&
+               offset + Nr <= static_cast<int>(thread.hist.size()) );
 
-    // Clear the local tally
-    clear_local();
+        for (int i = offset; i < offset + Nr; ++i)
+        {
+            double &hist = thread.hist[i];
+
+            thread.moments[i].first  += hist;
+            thread.moments[i].second += hist * hist;
+            thread.cycle[i] += hist;
+
+            hist = 0.0;
+        }
+        thread.scored[offset / Nr] = false;
+    }
+    thread.touched.clear();
 }
 
 //---------------------------------------------------------------------------//
@@ -108,9 +172,11 @@ void Mesh_Tally<Geometry>::end_history()
 template <class Geometry>
 void Mesh_Tally<Geometry>::begin_cycle()
 {
-    REQUIRE( d_cycle_tally.size() == d_mesh->num_cells() );
+    REQUIRE( d_cycle_tally.size() == d_tally.size() );
 
     std::fill(d_cycle_tally.begin(),d_cycle_tally.end(),0.0);
+    for (auto &thread : d_thread)
+        std::fill(thread.cycle.begin(),thread.cycle.end(),0.0);
 }
 
 //---------------------------------------------------------------------------//
@@ -120,36 +186,39 @@ void Mesh_Tally<Geometry>::begin_cycle()
 template <class Geometry>
 void Mesh_Tally<Geometry>::end_cycle(double num_particles)
 {
+    // Reduce results from all threads
+    reduce_threads();
+
     if (d_cycle_output)
     {
-        REQUIRE( d_cycle_tally.size() == d_mesh->num_cells() );
+        REQUIRE( d_cycle_tally.size() == d_tally.size() );
         REQUIRE( num_particles > 0.0 );
 
-        profugus::global_sum(&d_cycle_tally[0], d_cycle_tally.size());
+        const int B = d_bins.size();
 
-        for (int cell = 0; cell < d_cycle_tally.size(); ++cell)
+        std::vector<double> flux(d_cycle_tally.size(), 0.0);
+        for (int i = 0, N = d_cycle_tally.size(); i < N; ++i)
         {
-            CHECK(cell<d_mesh->num_cells());
-            double nrm_factor = num_particles * d_mesh->volume(cell);
+            CHECK(i / B < static_cast<int>(d_mesh->num_cells()));
+            double nrm_factor = num_particles * d_mesh->volume(i / B);
             CHECK(nrm_factor>0.0);
-            d_cycle_tally[cell] /= nrm_factor;
+            flux[i] = d_cycle_tally[i] / nrm_factor;
         }
 
-#ifdef USE_HDF5
-        Serial_HDF5_Writer writer;
-        writer.open(d_filename,HDF5_IO::APPEND);
-
-        std::ostringstream m;
-        m << "cycle_" << d_cycle;
-        writer.begin_group(m.str());
-
-        writer.write("cycle_flux",d_cycle_tally);
-
-        writer.end_group();
-        writer.close();
-#endif
+        // Reduce and append to the cycle_flux dataset while the next cycle
+        // runs
+        if (!d_cycle_writer)
+        {
+            d_cycle_writer = std::make_shared<Cycle_Output>(
+                d_filename, "cycle_flux");
+        }
+        d_cycle_writer->write(flux);
     }
 
+    // Each cycle is a batch
+    if (d_statistics == tally::BATCH)
+        end_batch(num_particles);
+
     d_cycle++;
 }
 
@@ -162,15 +231,24 @@ void Mesh_Tally<Geometry>::finalize(double num_particles)
 {
     REQUIRE(num_particles > 1);
 
+    // Reduce results from all threads
+    reduce_threads();
+
+    // The error of the mean cannot be estimated from fewer than two batches
+    VALIDATE(d_statistics != tally::BATCH || d_num_batches > 1,
+             "Batch tally statistics need at least two batches (cycles), but "
+             << d_num_batches << " were tallied; run fixed-source problems "
+             << "in cycles or use history tally_statistics.");
+
     // Do a global reduction on moments
     std::vector<double> first( d_tally.size(),  0.0);
     std::vector<double> second(d_tally.size(), 0.0);
 
     // Write tally results into separate arrays for reduction
-    for( int cell = 0; cell < d_tally.size(); ++cell )
+    for( int i = 0, N = d_tally.size(); i < N; ++i )
     {
-        first[cell]  = d_tally[cell].first;
-        second[cell] = d_tally[cell].second;
+        first[i]  = d_tally[i].first;
+        second[i] = d_tally[i].second;
     }
 
     // Do global reductions on the moments
@@ -180,32 +258,53 @@ void Mesh_Tally<Geometry>::finalize(double num_particles)
     // Store 1/N
     double inv_N = 1.0 / num_particles;
 
-    for( int cell = 0; cell < d_tally.size(); ++cell )
+    const int B = d_bins.size();
+
+    for( int i = 0, N = d_tally.size(); i < N; ++i )
     {
-        double inv_V = 1.0 / d_mesh->volume(cell);
+        double inv_V = 1.0 / d_mesh->volume(i / B);
         CHECK( inv_V > 0.0 );
 
-        // Calculate means for this cell
-        double avg_l  = first[cell]  * inv_N;
-        double avg_l2 = second[cell] * inv_N;
+        // Calculate means for this bin
+        double avg_l  = first[i]  * inv_N;
+        double avg_l2 = second[i] * inv_N;
 
         // Get a reference to the moments
-        auto &moments = d_tally[cell];
+        auto &moments = d_tally[i];
 
         // Store the sample mean
         moments.first = avg_l * inv_V;
 
         // Calculate the variance
-        double var = (avg_l2 - avg_l * avg_l) / (num_particles - 1);
+        double var = 0.0;
+        if (d_statistics == tally::BATCH)
+        {
+            // Variance of the mean from the batch means
+            double inv_B  = 1.0 / d_num_batches;
+            double avg_b  = d_batch[i].first  * inv_B;
+            double avg_b2 = d_batch[i].second * inv_B;
+            var = std::max(avg_b2 - avg_b * avg_b, 0.0) /
+                  (d_num_batches - 1);
+        }
+        else
+        {
+            var = (avg_l2 - avg_l * avg_l) / (num_particles - 1);
+        }
 
         // Store the error of the sample mean
         moments.second = std::sqrt(var) * inv_V;
 
         // Store individual vectors for output purposes
-        first[cell]  = moments.first;
-        second[cell] = moments.second;
+        first[i]  = moments.first;
+        second[i] = moments.second;
     }
 
+    // Finish any cycle output before the file is written, and wait for the
+    // cycle output of other tallies (HDF5 is not called concurrently)
+    if (d_cycle_writer)
+        d_cycle_writer->close();
+    Cycle_Output::drain_all();
+
 #ifdef USE_HDF5
     Serial_HDF5_Writer writer;
     writer.open(d_filename,HDF5_IO::APPEND);
@@ -225,44 +324,92 @@ void Mesh_Tally<Geometry>::reset()
     // Clear the local tally
     clear_local();
 
+    // Clear the batch moments
+    std::fill(d_batch.begin(), d_batch.end(), Moments(0.0, 0.0));
+    d_num_batches = 0;
+
+    // Finish any cycle output from the previous solve
+    if (d_cycle_writer)
+        d_cycle_writer->close();
+
     d_cycle = 0;
 }
 
 //---------------------------------------------------------------------------//
 /*
- * \brief Track particle and tally..
+ * \brief Size thread-private accumulators.
+ */
+template <class Geometry>
+void Mesh_Tally<Geometry>::set_num_threads(int num_threads)
+{
+    REQUIRE( num_threads > 0 );
+
+    // Keep any results that are pending on the current threads
+    reduce_threads();
+    init_threads(num_threads);
+
+    ENSURE( static_cast<int>(d_thread.size()) == num_threads );
+}
+
+//---------------------------------------------------------------------------//
+/*
+ * \brief Trace the step through the mesh and tally.
  */
 template <class Geometry>
 void Mesh_Tally<Geometry>::accumulate(double            step,
                                          const Particle_t &p)
 {
-    using def::I; using def::J; using def::K;
+    REQUIRE( d_mesh );
+    CHECK( profugus::thread_id() < static_cast<int>(d_thread.size()) );
 
-    // Get the cell index
-    Mesh::Dim_Vector ijk;
-    const Mesh::Space_Vector &xyz = p.geo_state().d_r;
-    d_mesh->find_upper(xyz,ijk);
+    // Get the accumulators for this thread
+    auto &thread = d_thread[profugus::thread_id()];
 
-    // Check boundaries for particles pushed just outside domain
-    using profugus::soft_equiv;
-    constexpr double tol = 1e-12;
-    for (auto dir : {I, J, K})
-    {
-        if (soft_equiv(xyz[dir],d_mesh->low_corner(dir),tol))
-            ijk[dir] = 0;
-        else if (soft_equiv(xyz[dir],d_mesh->high_corner(dir),tol))
-            ijk[dir] = d_mesh->num_cells_along(dir)-1;
-    }
+    // Weight of the contribution, constant along the step
+    double wt = p.wt();
 
-    Mesh::size_type cell;
-    bool found = d_mesh->index( ijk[I], ijk[J], ijk[K], cell );
-    if( found )
-    {
-        REQUIRE( cell >= 0 && cell < d_mesh->num_cells() );
+    // Response multipliers and the offset of the particle's group bin, both
+    // constant along the step
+    d_bins.evaluate(*b_physics, p, thread.response.data());
+    const double *response = thread.response.data();
+    const int     block    = d_bins.offset(p);
+    const int     B        = d_bins.size();
+    const int     Nr       = d_bins.num_responses();
+
+    const auto &geo_state = p.geo_state();
 
-        // Tally for the history
-        d_hist[cell] += p.wt() * step;
+    // With batch statistics, tally straight into the cycle
+    if (d_statistics == tally::BATCH)
+    {
+        d_mesh->segment(d_geometry->position(geo_state),
+                        d_geometry->direction(geo_state), step,
+                        [&](Mesh::size_type cell, double d)
+                        {
+                            double *cycle = &thread.cycle[cell * B + block];
+                            for (int r = 0; r < Nr; ++r)
+                                cycle[r] += wt * d * response[r];
+                        });
+        return;
     }
+
+    // Trace the step through the mesh and tally the pathlength in each cell
+    // that it crosses, recording each block of bins on its first score
+    d_mesh->segment(d_geometry->position(geo_state),
+                    d_geometry->direction(geo_state), step,
+                    [&](Mesh::size_type cell, double d)
+                    {
+                        const int offset = cell * B + block;
+                        double   *hist   = &thread.hist[offset];
+
+                        if (!thread.scored[offset / Nr])
+                        {
+                            thread.scored[offset / Nr] = true;
+                            thread.touched.push_back(offset);
+                        }
+
+                        for (int r = 0; r < Nr; ++r)
+                            hist[r] += wt * d * response[r];
+                    });
 }
 
 //---------------------------------------------------------------------------//
@@ -274,8 +421,96 @@ void Mesh_Tally<Geometry>::accumulate(double            step,
 template <class Geometry>
 void Mesh_Tally<Geometry>::clear_local()
 {
-    // Clear the local tally
-    std::fill(d_hist.begin(), d_hist.end(), 0.0);
+    // Clear the local tally on every thread
+    for (auto &thread : d_thread)
+    {
+        std::fill(thread.hist.begin(), thread.hist.end(), 0.0);
+        std::fill(thread.scored.begin(), thread.scored.end(), false);
+        thread.touched.clear();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*
+ * \brief Make empty thread-private accumulators for the current mesh.
+ */
+template <class Geometry>
+void Mesh_Tally<Geometry>::init_threads(int num_threads)
+{
+    REQUIRE( num_threads > 0 );
+
+    Thread_Tally empty;
+    empty.hist.resize(d_tally.size(), 0.0);
+    empty.scored.resize(d_tally.size() / d_bins.num_responses(), false);
+    empty.moments.resize(d_tally.size(), {0.0, 0.0});
+    empty.cycle.resize(d_tally.size(), 0.0);
+    empty.response.resize(d_bins.num_responses(), 0.0);
+    d_thread.assign(num_threads, empty);
+
+    ENSURE( static_cast<int>(d_thread.size()) == num_threads );
+}
+
+//---------------------------------------------------------------------------//
+/*
+ * \brief Reduce thread-private accumulators into the results.
+ *
+ * This must be called outside of a threaded region.
+ */
+template <class Geometry>
+void Mesh_Tally<Geometry>::reduce_threads()
+{
+    REQUIRE( !profugus::in_thread_parallel_region() );
+
+    for (auto &thread : d_thread)
+    {
+        CHECK( thread.moments.size() == d_tally.size() );
+        CHECK( thread.cycle.size() == d_cycle_tally.size() );
+
+        for (int i = 0, N = d_tally.size(); i < N; ++i)
+        {
+            d_tally[i].first  += thread.moments[i].first;
+            d_tally[i].second += thread.moments[i].second;
+            d_cycle_tally[i]  += thread.cycle[i];
+        }
+
+        std::fill(thread.moments.begin(), thread.moments.end(),
+                  Moments(0.0, 0.0));
+        std::fill(thread.cycle.begin(), thread.cycle.end(), 0.0);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*
+ * \brief Add the cycle tally to the batch moments.
+ *
+ * The cycle tally is added to the first moments and the batch mean, summed
+ * over all domains, to the batch moments.  The cycle tally is cleared.
+ */
+template <class Geometry>
+void Mesh_Tally<Geometry>::end_batch(double num_particles)
+{
+    REQUIRE( d_statistics == tally::BATCH );
+    REQUIRE( num_particles > 0.0 );
+    REQUIRE( d_cycle_tally.size() == d_tally.size() );
+
+    // Add the local first moments
+    for (int i = 0, N = d_tally.size(); i < N; ++i)
+        d_tally[i].first += d_cycle_tally[i];
+
+    // Sum the batch over all domains
+    profugus::global_sum(d_cycle_tally.data(), d_cycle_tally.size());
+
+    // Accumulate the batch means
+    double inv_N = 1.0 / num_particles;
+    for (int i = 0, N = d_tally.size(); i < N; ++i)
+    {
+        double mean = d_cycle_tally[i] * inv_N;
+        d_batch[i].first  += mean;
+        d_batch[i].second += mean * mean;
+    }
+
+    std::fill(d_cycle_tally.begin(), d_cycle_tally.end(), 0.0);
+    ++d_num_batches;
 }
 
 } // end namespace profugus
@@ -57,7 +57,7 @@ class Particle
     // Particle weight.
     double d_wt;
 
-    // Random number generator (reference counted).
+    // Random number generator (reference counted SPRNG or counter-based).
     RNG d_rng;
 
     // Alive/dead status.
@@ -102,6 +102,9 @@ class Particle
     //! Set particle status to alive.
     void live() { d_alive = true; }
 
+    //! Get a handle to the random number generator of the particle.
+    RNG& rng() { return d_rng; }
+
     //@{
     //! Get a handle to the geometric state of the particle.
     Geo_State_t& geo_state() { return d_geo_state; }
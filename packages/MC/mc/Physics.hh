@@ -19,7 +19,6 @@
 
 #include "harness/DBC.hh"
 #include "utils/Definitions.hh"
-#include "utils/Static_Map.hh"
 #include "xs/XS.hh"
 #include "Definitions.hh"
 #include "Group_Bounds.hh"
@@ -42,6 +41,23 @@ namespace profugus
  *
  * \arg \c check_balance (bool) check for balanced scattering tables (default:
  * false)
+ *
+ * \section physics_tables Cross section tables
+ *
+ * The cross sections needed during transport are copied out of the XS
+ * database at construction into flat tables indexed by a dense local
+ * material index, \e m, and group, \e g.  Total, scattering, fission and
+ * nu-fission cross sections are stored together at \c [m*Ng+g], the scattering
+ * CDFs at \c [(m*Ng+g)*Ng+g'], and the fission spectrum CDFs at \c [m*Ng+g].
+ * Material ids are mapped to local indices by a direct-indexed table, so a
+ * cross section lookup is two array loads and no hashing.
+ *
+ * Outgoing scattering groups and fission spectrum groups are sampled with
+ * guide tables.  Each CDF has a table of \c Ng guides where guide \e k is the
+ * first group whose CDF is \f$\ge k/N_g\f$; sampling starts the CDF search at
+ * the guide for \f$\lfloor\xi N_g\rfloor\f$, so the expected number of
+ * comparisons is less than two regardless of the number of groups.  The
+ * sampled group is the same as a linear search of the CDF.
  */
 /*!
  * \example mc_physics/test/tstPhysics.cc
@@ -140,7 +156,7 @@ class Physics
     // Return whether a given material is fissionable
     bool is_fissionable(unsigned int matid) const
     {
-        return d_fissionable[d_mid2l[matid]];
+        return d_fissionable[local(matid)];
     }
 
     // >>> FISSION SITE CONTAINER OPERATIONS
@@ -168,7 +184,6 @@ class Physics
     // Private types.
     typedef def::Vec_Dbl         Vec_Dbl;
     typedef def::Vec_Int         Vec_Int;
-    typedef std::vector<Vec_Dbl> Vec_Vec_Dbl;
 
     // Boolean for implicit capture.
     bool d_implicit_capture;
@@ -182,23 +197,61 @@ class Physics
     // Group boundaries.
     Group_Bounds d_gb;
 
-    // Matid-to-local hash such that d_mid2l[matid] = [0,N).
-    Static_Map<unsigned int, unsigned int> d_mid2l;
+    // Matid-to-local table such that d_mid2l[matid] = [0,N) (-1 for matids
+    // that are not in the database).
+    Vec_Int d_mid2l;
+
+    // Cross sections for a material and group.
+    struct Group_XS
+    {
+        double total;
+        double scatter;
+        double fission;
+        double nu_fission;
+    };
+
+    // Cross sections indexed [m * Ng + g].
+    std::vector<Group_XS> d_xs;
+
+    // Outscatter CDFs indexed [(m * Ng + g) * Ng + g'].
+    Vec_Dbl d_scatter_cdf;
 
-    // Total scattering for each group and material.
-    Vec_Vec_Dbl d_scatter;
+    // Fission spectrum CDFs indexed [m * Ng + g].
+    Vec_Dbl d_chi_cdf;
+
+    // Guide tables for the outscatter and fission spectrum CDFs (same
+    // layout as the CDFs).
+    Vec_Int d_scatter_guide, d_chi_guide;
 
     // Fissionable bool by local matid.
     std::vector<bool> d_fissionable;
 
-    // Material id of current region.
-    int d_matid;
+    //! Local material index for a matid.
+    int local(unsigned int matid) const
+    {
+        REQUIRE(matid < d_mid2l.size());
+        REQUIRE(d_mid2l[matid] >= 0);
+        return d_mid2l[matid];
+    }
+
+    //! Cross sections for a matid and group.
+    const Group_XS& group_xs(unsigned int matid, int g) const
+    {
+        REQUIRE(g >= 0 && g < d_Ng);
+        return d_xs[local(matid) * d_Ng + g];
+    }
 
     // Sample a group.
     int sample_group(int matid, int g, double rnd) const;
 
     // Sample a fission group.
     int sample_fission_group(unsigned int matid, double rnd) const;
+
+    // Build the guide table for a CDF.
+    void build_guide(const double *cdf, int *guide) const;
+
+    // Sample a CDF using its guide table.
+    int sample_cdf(const double *cdf, const int *guide, double rnd) const;
 };
 
 } // end namespace profugus
@@ -37,7 +37,11 @@ Physics<Geometry>::Physics(RCP_Std_DB db,
     , d_Nm(d_mat->num_mat())
     , d_gb(Vec_Dbl(mat->bounds().values(),
                    mat->bounds().values() + mat->bounds().length()))
-    , d_scatter(d_Nm)
+    , d_xs(d_Nm * d_Ng)
+    , d_scatter_cdf(d_Nm * d_Ng * d_Ng, 0.0)
+    , d_chi_cdf(d_Nm * d_Ng, 0.0)
+    , d_scatter_guide(d_Nm * d_Ng * d_Ng, 0)
+    , d_chi_guide(d_Nm * d_Ng, 0)
     , d_fissionable(d_Nm)
 {
     REQUIRE(!db.is_null());
@@ -62,73 +66,101 @@ Physics<Geometry>::Physics(RCP_Std_DB db,
     d_mat->get_matids(matids);
     CHECK(matids.size() == d_Nm);
 
-    // make the matid-to-local has map
-    for (unsigned int l = 0; l < d_Nm; ++l)
+    // make the matid-to-local table
+    CHECK(*std::min_element(matids.begin(), matids.end()) >= 0);
+    d_mid2l.resize(*std::max_element(matids.begin(), matids.end()) + 1, -1);
+    for (int l = 0; l < d_Nm; ++l)
     {
-        d_mid2l.insert(Static_Map<unsigned int, unsigned int>::value_type(
-                           static_cast<unsigned int>(matids[l]), l));
+        CHECK(d_mid2l[matids[l]] == -1);
+        d_mid2l[matids[l]] = l;
     }
-    d_mid2l.complete();
-    CHECK(d_mid2l.size() == d_Nm);
 
-    // calculate total scattering over all groups for each material and
-    // determine if fission is available for a given material
+    // build the cross section tables for each material and determine if
+    // fission is available for a given material
     for (auto matid : matids)
     {
         // get the local index in the range [0, N)
-        int m = d_mid2l[static_cast<unsigned int>(matid)];
+        int m = d_mid2l[matid];
         CHECK(m < d_Nm);
 
-        // size the group vector for this material
-        d_scatter[m].resize(d_Ng, 0.0);
+        // cross section data for this material
+        const auto &sig_t  = d_mat->vector(matid, XS_t::TOTAL);
+        const auto &sig_f  = d_mat->vector(matid, XS_t::SIG_F);
+        const auto &nusigf = d_mat->vector(matid, XS_t::NU_SIG_F);
+        const auto &chi    = d_mat->vector(matid, XS_t::CHI);
+        CHECK(chi.length() == d_Ng);
 
         // get the P0 scattering matrix for this material
         const auto &sig_s = d_mat->matrix(matid, 0);
         CHECK(sig_s.numRows() == d_Ng);
         CHECK(sig_s.numCols() == d_Ng);
 
-        // loop over all groups and calculate the in-scatter from other
-        // groups and add them to the group OUT-SCATTER; remember, we
-        // store data as inscatter for the deterministic code
+        // running chi cdf
+        double chi_cdf = 0.0;
+
         for (int g = 0; g < d_Ng; g++)
         {
-            // get the g column (g->g' scatter stored as g'g in the matrix)
+            Group_XS &xs = d_xs[m * d_Ng + g];
+            xs.total      = sig_t[g];
+            xs.fission    = sig_f[g];
+            xs.nu_fission = nusigf[g];
+            xs.scatter    = 0.0;
+
+            // get the g column (g->g' scatter stored as g'g in the matrix);
+            // remember, we store data as inscatter for the deterministic
+            // code
             const auto *column = sig_s[g];
 
-            // add up the scattering
+            // add up the scattering to get the group OUT-SCATTER
             for (int gp = 0; gp < d_Ng; ++gp)
             {
-                d_scatter[m][g] += column[gp];
+                xs.scatter += column[gp];
             }
-        }
 
-        // check scattering correctness if needed
-        if (d_check_balance)
-        {
-            for (int g = 0; g < d_Ng; g++)
+            // make the outscatter cdf (if there is any scattering)
+            if (xs.scatter > 0.0)
             {
-                if (d_scatter[m][g] > d_mat->vector(matid, XS_t::TOTAL)[g])
+                double *cdf   = &d_scatter_cdf[(m * d_Ng + g) * d_Ng];
+                double  total = 1.0 / xs.scatter;
+                double  sum   = 0.0;
+                for (int gp = 0; gp < d_Ng; ++gp)
                 {
-                    std::ostringstream mm;
-                    mm << "Scattering greater than total "
-                       << "for material" << m << " in group " << g
-                       << ". Total xs is "
-                       << d_mat->vector(matid, XS_t::TOTAL)[g]
-                       << " and scatter is " << d_scatter[m][g];
-
-                    // terminate if we are running analog
-                    if (!d_implicit_capture)
-                        VALIDATE(false, mm.str());
-                    // else add to warnings
-                    else
-                        ADD_WARNING(mm.str());
+                    sum    += column[gp] * total;
+                    cdf[gp] = sum;
                 }
+                CHECK(soft_equiv(sum, 1.0));
+
+                build_guide(cdf, &d_scatter_guide[(m * d_Ng + g) * d_Ng]);
+            }
+
+            // make the fission spectrum cdf
+            chi_cdf += chi[g];
+            d_chi_cdf[m * d_Ng + g] = chi_cdf;
+
+            // check scattering correctness if needed
+            if (d_check_balance && xs.scatter > xs.total)
+            {
+                std::ostringstream mm;
+                mm << "Scattering greater than total "
+                   << "for material" << m << " in group " << g
+                   << ". Total xs is " << xs.total
+                   << " and scatter is " << xs.scatter;
+
+                // terminate if we are running analog
+                if (!d_implicit_capture)
+                    VALIDATE(false, mm.str());
+                // else add to warnings
+                else
+                    ADD_WARNING(mm.str());
             }
         }
 
         // see if this material is fissionable by checking Chi
-        d_fissionable[m] = d_mat->vector(matid, XS_t::CHI).normOne() > 0.0 ?
-                           true : false;
+        d_fissionable[m] = chi.normOne() > 0.0 ? true : false;
+
+        // make the fission spectrum guide table
+        if (d_fissionable[m])
+            build_guide(&d_chi_cdf[m * d_Ng], &d_chi_guide[m * d_Ng]);
     }
 
     ENSURE(d_Nm > 0);
@@ -179,16 +211,16 @@ void Physics<Geometry>::collide(Particle_t &particle,
     REQUIRE(particle.group() < d_Ng);
 
     // get the material id of the current region
-    d_matid = particle.matid();
-    CHECK(d_mid2l[static_cast<unsigned int>(d_matid)] < d_Nm);
-    CHECK(d_geometry->matid(particle.geo_state()) == d_matid);
+    int matid = particle.matid();
+    CHECK(local(matid) < d_Nm);
+    CHECK(static_cast<int>(d_geometry->matid(particle.geo_state())) == matid);
 
     // get the group index
     int group = particle.group();
 
     // calculate the scattering cross section ratio
-    double c = d_scatter[d_mid2l[d_matid]][group] /
-               d_mat->vector(d_matid, XS_t::TOTAL)[group];
+    const Group_XS &xs = group_xs(matid, group);
+    double c = xs.scatter / xs.total;
     CHECK(!d_implicit_capture ? c <= 1.0 : c >= 0.0);
 
     // we need to do analog transport if the particle is c = 0.0 regardless of
@@ -227,7 +259,7 @@ void Physics<Geometry>::collide(Particle_t &particle,
     if (particle.event() != events::ABSORPTION)
     {
         // determine new group of particle
-        group = sample_group(d_matid, group, particle.rng().ran());
+        group = sample_group(matid, group, particle.rng().ran());
         CHECK(group >= 0 && group < d_Ng);
 
         // set the group
@@ -258,20 +290,26 @@ double Physics<Geometry>::total(physics::Reaction_Type  type,
     unsigned int matid = p.matid();
     CHECK(d_mat->has(matid));
 
+    // get the cross sections for this material and group
+    const Group_XS &xs = group_xs(matid, p.group());
+
     // return the approprate reaction type
     switch (type)
     {
         case physics::TOTAL:
-            return d_mat->vector(matid, XS_t::TOTAL)[p.group()];
+            return xs.total;
+
+        case physics::ABSORPTION:
+            return xs.total - xs.scatter;
 
         case physics::SCATTERING:
-            return d_scatter[d_mid2l[matid]][p.group()];
+            return xs.scatter;
 
         case physics::FISSION:
-            return d_mat->vector(matid, XS_t::SIG_F)[p.group()];
+            return xs.fission;
 
         case physics::NU_FISSION:
-            return d_mat->vector(matid, XS_t::NU_SIG_F)[p.group()];
+            return xs.nu_fission;
 
         default:
             return 0.0;
@@ -358,16 +396,13 @@ int Physics<Geometry>::sample_fission_site(const Particle_t       &p,
 
     // otherwise make a fission site and sample
 
-    // get the group from the particle
-    int group = p.group();
+    // get the cross sections for the particle's group
+    const Group_XS &xs = group_xs(matid, p.group());
 
     // calculate the number of fission sites (random number samples to nearest
     // integer)
     int n = static_cast<int>(
-        p.wt() *
-        d_mat->vector(matid, XS_t::NU_SIG_F)[group] /
-        d_mat->vector(matid, XS_t::TOTAL)[group] /
-        keff + p.rng().ran());
+        p.wt() * xs.nu_fission / xs.total / keff + p.rng().ran());
 
     // add sites to the fission site container
     for (int i = 0; i < n; ++i)
@@ -428,42 +463,21 @@ int Physics<Geometry>::sample_group(int    matid,
     REQUIRE(g >= 0 && g < d_Ng);
     REQUIRE(rnd >= 0.0 && rnd < 1.0);
     REQUIRE(d_mat->has(matid));
-    REQUIRE(d_mid2l.exists(matid));
+    REQUIRE(group_xs(matid, g).scatter > 0.0);
 
-    // running cdf
-    double cdf = 0.0;
-
-    // total out-scattering for this cell and group
-    double total = 1.0 / d_scatter[d_mid2l[matid]][g];
-
-    // get the P0 scattering cross section matrix the g column (which is the
-    // outscatter) for this group (g->g' is the {A_(g'g) g'=0,Ng} entries of
-    // the inscatter matrix
-    const auto *scat_g = d_mat->matrix(matid, 0)[g];
+    // outscatter cdf and guide table for this material and group
+    int index = (local(matid) * d_Ng + g) * d_Ng;
 
     // sample g'
-    for (int gp = 0; gp < d_Ng; ++gp)
-    {
-        // calculate the cdf for scattering to this group
-        cdf += scat_g[gp] * total;
+    int gp = sample_cdf(&d_scatter_cdf[index], &d_scatter_guide[index], rnd);
 
-        // see if we have sampled this group
-        if (rnd <= cdf)
-            return gp;
-    }
-    CHECK(soft_equiv(cdf, 1.0));
-
-    // we failed to sample
-    VALIDATE(false, "Failed to sample group.");
-    return -1;
+    VALIDATE(gp >= 0, "Failed to sample group.");
+    return gp;
 }
 
 //---------------------------------------------------------------------------//
 /*!
  * \brief Sample a fission group.
- *
- * This function is optimized based on the assumption that nearly all of the
- * fission emission is in the first couple of groups.
  */
 template <class Geometry>
 int Physics<Geometry>::sample_fission_group(unsigned int matid,
@@ -472,31 +486,70 @@ int Physics<Geometry>::sample_fission_group(unsigned int matid,
     REQUIRE(d_mat->has(matid));
     REQUIRE(is_fissionable(matid));
 
-    // running cdf; we make the cdf on the fly because nearly all of the
-    // emission is in the first couple of groups so its not worth storing for
-    // a binary search
-    double cdf = 0.0;
+    // chi cdf and guide table for this material
+    int index = local(matid) * d_Ng;
+
+    // sample g
+    int g = sample_cdf(&d_chi_cdf[index], &d_chi_guide[index], rnd);
+
+    VALIDATE(g >= 0, "Failed to sample fission group.");
+    return g;
+}
 
-    // get the fission chi
-    const auto &chi = d_mat->vector(matid, XS_t::CHI);
-    CHECK(chi.length() == d_Ng);
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Build the guide table for a CDF over groups.
+ *
+ * Guide \e k is the first group whose CDF is at least \f$k/N_g\f$ (or the
+ * last group if there is none).
+ */
+template <class Geometry>
+void Physics<Geometry>::build_guide(const double *cdf,
+                                    int          *guide) const
+{
+    REQUIRE(cdf);
+    REQUIRE(guide);
 
-    // sample cdf
-    for (int g = 0; g < d_Ng; ++g)
+    int g = 0;
+    for (int k = 0; k < d_Ng; ++k)
     {
-        // update cdf
-        cdf += chi[g];
+        double bound = static_cast<double>(k) / d_Ng;
+        while (g < d_Ng - 1 && cdf[g] < bound)
+            ++g;
+        guide[k] = g;
+    }
+}
 
-        // check for sampling; update particle's physics state and return
-        if (rnd <= cdf)
-        {
-            // update the group in the particle
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Sample a CDF over groups using its guide table.
+ *
+ * Because \f$\xi \ge k/N_g\f$ for \f$k = \lfloor\xi N_g\rfloor\f$, the
+ * search can start at guide \e k and returns the first group with \f$\xi
+ * \le \mathrm{cdf}_g\f$, exactly as a linear search from group 0 would.
+ *
+ * \return sampled group, or -1 if \f$\xi\f$ is greater than the CDF in
+ * every group
+ */
+template <class Geometry>
+int Physics<Geometry>::sample_cdf(const double *cdf,
+                                  const int    *guide,
+                                  double        rnd) const
+{
+    REQUIRE(rnd >= 0.0 && rnd < 1.0);
+
+    // start at the guide for this random number (rnd * Ng can round up to
+    // Ng when rnd is within an ulp of 1)
+    int g = guide[std::min(static_cast<int>(rnd * d_Ng), d_Ng - 1)];
+    CHECK(g >= 0 && g < d_Ng);
+
+    // search forward
+    for (; g < d_Ng; ++g)
+    {
+        if (rnd <= cdf[g])
             return g;
-        }
     }
 
-    // we failed to sample
-    VALIDATE(false, "Failed to sample fission group.");
     return -1;
 }
 
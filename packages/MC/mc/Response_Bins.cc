@@ -0,0 +1,113 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   MC/mc/Response_Bins.cc
+ * \author Thomas M. Evans
+ * \date   Fri Oct 16 09:12:44 2026
+ * \brief  Response_Bins member definitions.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "Response_Bins.hh"
+
+namespace profugus
+{
+
+//---------------------------------------------------------------------------//
+// CONSTRUCTOR
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Constructor.
+ *
+ * The bins are initialized to a single group bin with the flux response.
+ *
+ * \param num_groups number of energy groups
+ */
+Response_Bins::Response_Bins(int num_groups)
+    : d_first_groups(1, 0)
+    , d_group_bin(num_groups, 0)
+    , d_responses(1, physics::FLUX)
+{
+    REQUIRE(num_groups > 0);
+}
+
+//---------------------------------------------------------------------------//
+// PUBLIC FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Set the group bins and responses.
+ *
+ * \param first_groups first group of each group bin; the bins must start at
+ * group 0 and be increasing
+ * \param responses responses scored in each group bin
+ */
+void Response_Bins::set(const Vec_Int      &first_groups,
+                        const Vec_Response &responses)
+{
+    VALIDATE(!first_groups.empty(), "At least one group bin is required.");
+    VALIDATE(!responses.empty(), "At least one response is required.");
+    VALIDATE(first_groups.front() == 0, "The first group bin must start "
+             "at group 0, not " << first_groups.front() << ".");
+
+    for (int b = 1, Nb = first_groups.size(); b < Nb; ++b)
+    {
+        VALIDATE(first_groups[b] > first_groups[b-1] &&
+                 first_groups[b] < num_groups(),
+                 "Group bin " << b << " starts at group " << first_groups[b]
+                 << ", which is not increasing or is not in [0, "
+                 << num_groups() << ").");
+    }
+
+    for (auto r : responses)
+    {
+        VALIDATE(r == physics::FLUX || r == physics::TOTAL ||
+                 r == physics::ABSORPTION || r == physics::SCATTERING ||
+                 r == physics::FISSION || r == physics::NU_FISSION,
+                 "Unsupported tally response " << r << ".");
+    }
+
+    d_first_groups = first_groups;
+    d_responses    = responses;
+
+    // bin of each group
+    for (int b = 0, g = 0; g < num_groups(); ++g)
+    {
+        if (b + 1 < num_group_bins() && g == d_first_groups[b + 1])
+            ++b;
+        d_group_bin[g] = b;
+    }
+
+    ENSURE(d_group_bin.back() == num_group_bins() - 1);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Get a response from its name.
+ *
+ * \param name one of \c "flux", \c "total", \c "absorption", \c
+ * "scattering", \c "fission", or \c "nu_fission"
+ */
+physics::Reaction_Type Response_Bins::response(const std::string &name)
+{
+    if (name == "flux")
+        return physics::FLUX;
+    else if (name == "total")
+        return physics::TOTAL;
+    else if (name == "absorption")
+        return physics::ABSORPTION;
+    else if (name == "scattering")
+        return physics::SCATTERING;
+    else if (name == "fission")
+        return physics::FISSION;
+    else if (name == "nu_fission")
+        return physics::NU_FISSION;
+
+    VALIDATE(false, "Unknown tally response '" << name << "'.");
+    return physics::END_REACTION_TYPE;
+}
+
+} // end namespace profugus
+
+//---------------------------------------------------------------------------//
+//                 end of Response_Bins.cc
+//---------------------------------------------------------------------------//
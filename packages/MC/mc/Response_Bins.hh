@@ -0,0 +1,146 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   MC/mc/Response_Bins.hh
+ * \author Thomas M. Evans
+ * \date   Fri Oct 16 09:12:44 2026
+ * \brief  Response_Bins class definition.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef MC_mc_Response_Bins_hh
+#define MC_mc_Response_Bins_hh
+
+#include <string>
+#include <vector>
+
+#include "harness/DBC.hh"
+#include "Definitions.hh"
+
+namespace profugus
+{
+
+//===========================================================================//
+/*!
+ * \class Response_Bins
+ * \brief Group bins and reaction-rate responses scored by a tally.
+ *
+ * The energy groups are collapsed into contiguous group bins, each defined by
+ * its first group, and every group bin scores the same list of responses.
+ * The responses are physics::Reaction_Type values; physics::FLUX scores the
+ * pathlength, and the others score the pathlength times the macroscopic cross
+ * section of the particle's material and group.
+ *
+ * Tallies store their results for each cell in a \c [group_bin][response]
+ * block of size() entries, with the response index running fastest.  The
+ * default bins are a single group bin with the flux response, which is the
+ * energy-integrated flux.
+ */
+/*!
+ * \example mc/test/tstResponse_Bins.cc
+ *
+ * Test of Response_Bins.
+ */
+//===========================================================================//
+
+class Response_Bins
+{
+  public:
+    //@{
+    //! Typedefs.
+    typedef std::vector<int>                    Vec_Int;
+    typedef std::vector<physics::Reaction_Type> Vec_Response;
+    //@}
+
+  private:
+    // >>> DATA
+
+    // First group of each group bin, and the bin of each group.
+    Vec_Int d_first_groups;
+    Vec_Int d_group_bin;
+
+    // Responses.
+    Vec_Response d_responses;
+
+  public:
+    // Constructor.
+    explicit Response_Bins(int num_groups);
+
+    // Set the group bins and responses.
+    void set(const Vec_Int &first_groups, const Vec_Response &responses);
+
+    // Get a response from its name.
+    static physics::Reaction_Type response(const std::string &name);
+
+    // >>> ACCESSORS
+
+    //! Number of energy groups.
+    int num_groups() const { return d_group_bin.size(); }
+
+    //! Number of group bins.
+    int num_group_bins() const { return d_first_groups.size(); }
+
+    //! Number of responses.
+    int num_responses() const { return d_responses.size(); }
+
+    //! Number of bins (group bins times responses).
+    int size() const { return num_group_bins() * num_responses(); }
+
+    //! First group of each group bin.
+    const Vec_Int& first_groups() const { return d_first_groups; }
+
+    //! Responses.
+    const Vec_Response& responses() const { return d_responses; }
+
+    //! Group bin of a group.
+    int group_bin(int group) const
+    {
+        REQUIRE(group >= 0 && group < num_groups());
+        return d_group_bin[group];
+    }
+
+    //! Offset of the block of responses for a particle's group bin.
+    template<class Particle_T>
+    int offset(const Particle_T &p) const
+    {
+        return group_bin(p.group()) * num_responses();
+    }
+
+    // Evaluate the response multipliers for a particle.
+    template<class Physics_T, class Particle_T>
+    inline void evaluate(Physics_T &physics, const Particle_T &p,
+                         double *values) const;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Evaluate the response multipliers for a particle.
+ *
+ * \param physics physics used to get the cross sections
+ * \param p particle
+ * \param values on return, the num_responses() factors that multiply a
+ * pathlength score
+ */
+template<class Physics_T, class Particle_T>
+void Response_Bins::evaluate(Physics_T        &physics,
+                             const Particle_T &p,
+                             double           *values) const
+{
+    REQUIRE(values);
+
+    for (int r = 0, Nr = d_responses.size(); r < Nr; ++r)
+    {
+        values[r] = d_responses[r] == physics::FLUX
+                    ? 1.0 : physics.total(d_responses[r], p);
+    }
+}
+
+} // end namespace profugus
+
+#endif // MC_mc_Response_Bins_hh
+
+//---------------------------------------------------------------------------//
+//                 end of Response_Bins.hh
+//---------------------------------------------------------------------------//
@@ -13,6 +13,7 @@
 
 #include <memory>
 #include <cmath>
+#include <string>
 
 #include "utils/Definitions.hh"
 #include "utils/Constants.hh"
@@ -26,6 +27,13 @@ namespace profugus
 /*!
  * \class Source
  * \brief Base class definition for Monte Carlo sources.
+ *
+ * Histories draw random numbers either from a single SPRNG stream per domain
+ * per cycle (\c rng_type = "sprng", the default) or from independent
+ * counter-based streams keyed by (seed, cycle, global history id) (\c
+ * rng_type = "counter").  Counter-based streams make each history
+ * reproducible independently of the decomposition, the number of threads,
+ * and the order in which histories are run.
  */
 //===========================================================================//
 
@@ -64,7 +72,7 @@ class Source
     SP_RNG_Control b_rng_control;
 
     // Sample isotropic angle.
-    void sample_angle(Space_Vector &omega, RNG_t rng)
+    void sample_angle(Space_Vector &omega, const RNG_t &rng)
     {
         using def::X; using def::Y; using def::Z;
 
@@ -79,6 +87,15 @@ class Source
     // Calculate random number offsets.
     void make_RNG();
 
+    // Set the random number stream type.
+    void set_rng_type(const std::string &type);
+
+    // Calculate global history ids on this domain for the current cycle.
+    void make_history_ids(size_type np_domain);
+
+    // Get the random number generator for a history on this domain.
+    RNG_t history_RNG(size_type local_history) const;
+
     // Node ids.
     int b_node, b_nodes;
 
@@ -96,6 +113,21 @@ class Source
     //! Get a particle from the source.
     virtual SP_Particle get_particle() = 0;
 
+    /*!
+     * \brief Emit the next source particle into an existing particle.
+     *
+     * This lets the transport loop reuse a single particle per thread so
+     * that no heap allocations are made per history.  The default copies
+     * the particle returned by get_particle(); derived sources should
+     * override it to initialize the particle in place.
+     */
+    virtual void emit_particle(Particle_t &p)
+    {
+        SP_Particle sp = get_particle();
+        CHECK(sp);
+        p = *sp;
+    }
+
     //! Whether the source has finished emitting all its particles.
     virtual bool empty() const = 0;
 
@@ -119,11 +151,21 @@ class Source
     //! Number of random number streams generated so far (inclusive).
     int num_streams() const { return d_rng_stream; }
 
+    //! Whether each history uses an independent counter-based stream.
+    bool counter_rng() const { return d_counter_rng; }
+
   private:
     // >>> DATA
 
     // Offsets used for random number generator selection.
     int d_rng_stream;
+
+    // Counter-based random number streams.
+    bool d_counter_rng;
+
+    // Current cycle and the global id of the first history on this domain.
+    int       d_cycle;
+    size_type d_history_offset;
 };
 
 } // end namespace profugus
@@ -11,6 +11,9 @@
 #ifndef MC_mc_Source_t_hh
 #define MC_mc_Source_t_hh
 
+#include <vector>
+#include <numeric>
+
 #include "Source.hh"
 #include "harness/DBC.hh"
 #include "comm/global.hh"
@@ -35,6 +38,9 @@ Source<Geometry>::Source(SP_Geometry    geometry,
     , b_node(profugus::node())
     , b_nodes(profugus::nodes())
     , d_rng_stream(0)
+    , d_counter_rng(false)
+    , d_cycle(-1)
+    , d_history_offset(0)
 {
     REQUIRE(b_geometry);
     REQUIRE(b_physics);
@@ -71,9 +77,76 @@ void Source<Geometry>::make_RNG()
     // advance to the next set of streams
     d_rng_stream += b_nodes;
 
+    // advance the cycle used to key counter-based streams
+    ++d_cycle;
+
     ENSURE(profugus::Global_RNG::d_rng.assigned());
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Set the random number stream type.
+ *
+ * \param type "sprng" (one stream per domain per cycle) or "counter" (one
+ * counter-based stream per history)
+ */
+template <class Geometry>
+void Source<Geometry>::set_rng_type(const std::string &type)
+{
+    VALIDATE(type == "sprng" || type == "counter", "Invalid rng_type '"
+             << type << "'; must be 'sprng' or 'counter'.");
+
+    d_counter_rng = (type == "counter");
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Calculate global history ids on this domain for the current cycle.
+ *
+ * Histories are numbered contiguously by domain.  This is a collective
+ * operation when counter-based streams are used; it must be called after
+ * make_RNG() each cycle.
+ */
+template <class Geometry>
+void Source<Geometry>::make_history_ids(size_type np_domain)
+{
+    d_history_offset = 0;
+
+    if (!d_counter_rng || b_nodes == 1)
+        return;
+
+    // gather the number of histories on every domain
+    std::vector<size_type> np(b_nodes, 0);
+    np[b_node] = np_domain;
+    profugus::global_sum(&np[0], b_nodes);
+
+    // the offset is the number of histories on all lower domains
+    d_history_offset = std::accumulate(np.begin(), np.begin() + b_node,
+                                       static_cast<size_type>(0));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Get the random number generator for a history on this domain.
+ *
+ * With counter-based streams a new, independent stream is returned for each
+ * history; otherwise the domain's SPRNG stream for this cycle is returned.
+ */
+template <class Geometry>
+auto Source<Geometry>::history_RNG(size_type local_history) const -> RNG_t
+{
+    REQUIRE(d_cycle >= 0);
+
+    if (d_counter_rng)
+    {
+        return b_rng_control->counter_rng(d_cycle,
+                                          d_history_offset + local_history);
+    }
+
+    REQUIRE(profugus::Global_RNG::d_rng.assigned());
+    return profugus::Global_RNG::d_rng;
+}
+
 } // end namespace profugus
 
 #endif // MC_mc_Source_t_hh
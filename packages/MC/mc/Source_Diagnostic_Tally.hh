@@ -96,6 +96,9 @@ class Source_Diagnostic_Tally : public Source_Tally<Geometry>
     // Clear/re-initialize all tally values.
     void reset();
 
+    //! The source density is a cycle estimate; no end-of-history work.
+    bool requires_end_history() const { return false; }
+
   private:
     // >>> IMPLEMENTATION
 
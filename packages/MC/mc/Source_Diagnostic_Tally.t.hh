@@ -19,6 +19,7 @@
 #include "harness/Warnings.hh"
 #include "comm/global.hh"
 #include "utils/Definitions.hh"
+#include "Cycle_Output.hh"
 #include "Source_Diagnostic_Tally.hh"
 
 namespace profugus
@@ -60,7 +61,8 @@ Source_Diagnostic_Tally<Geometry>::Source_Diagnostic_Tally(
     // make the source diagnostic output file
     d_filename = db->get<std::string>("problem_name") + "_fs.h5";
 
-    // make the initial file
+    // make the initial file (after any cycle output is written)
+    Cycle_Output::drain_all();
     d_writer.open(d_filename);
 
     // write the mesh
@@ -145,6 +147,9 @@ void Source_Diagnostic_Tally<Geometry>::end_cycle(double num_particles)
         s *= norm;
     }
 
+    // wait for any cycle output (HDF5 is not called concurrently)
+    Cycle_Output::drain_all();
+
     // open the file - writing is only on proc 0
     d_writer.open(d_filename, HDF5_IO::APPEND, 0);
 
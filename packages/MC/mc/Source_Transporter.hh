@@ -17,6 +17,7 @@
 #include "utils/Definitions.hh"
 #include "Source.hh"
 #include "Domain_Transporter.hh"
+#include "Event_Transporter.hh"
 
 namespace profugus
 {
@@ -33,6 +34,21 @@ namespace profugus
  *
  * It solves the fixed source problem using a domain replication (DR) parallel
  * strategy.  In DR the entire mesh is replicated across all domains.
+ *
+ * Within a domain, histories can be run concurrently on \c num_threads
+ * (default 1) OpenMP threads.  Each thread owns a copy of the domain
+ * transporter, a particle bank, a fission site container, and a random number
+ * stream spawned from the source; the tallier must only contain thread-safe
+ * tallies.  Fission sites are tagged with the index of the source history
+ * that produced them and are added to the fission site container in history
+ * order, so with counter-based random number streams the next fission
+ * source does not depend on the number of threads or on thread scheduling.
+ *
+ * Particles are transported history-by-history with Domain_Transporter (\c
+ * transport_type = "history", the default) or event-by-event with
+ * Event_Transporter (\c transport_type = "event"), which keeps up to \c
+ * event_batch_size (default 10000) particles per thread in flight and
+ * requires all tallies to use batch statistics.
  */
 /*!
  * \example mc/test/tstSource_Transporter.cc
@@ -53,10 +69,14 @@ class Source_Transporter
     typedef typename Transporter_t::Geometry_t            Geometry_t;
     typedef typename Transporter_t::SP_Physics            SP_Physics;
     typedef typename Transporter_t::SP_Geometry           SP_Geometry;
+    typedef typename Transporter_t::Particle_t            Particle_t;
     typedef typename Transporter_t::SP_Particle           SP_Particle;
     typedef typename Transporter_t::SP_Variance_Reduction SP_Variance_Reduction;
     typedef typename Transporter_t::SP_Fission_Sites      SP_Fission_Sites;
     typedef typename Transporter_t::SP_Tallier            SP_Tallier;
+    typedef typename Transporter_t::Bank_t                Bank_t;
+    typedef Event_Transporter<Geometry>                   Event_Transporter_t;
+    typedef std::shared_ptr<Event_Transporter_t>          SP_Event_Transporter;
     typedef std::shared_ptr<Source_t>                     SP_Source;
     typedef typename Physics_t::RCP_Std_DB                RCP_Std_DB;
     typedef def::size_type                                size_type;
@@ -83,6 +103,9 @@ class Source_Transporter
     // Domain transporter.
     Transporter_t d_transporter;
 
+    // Event-based transporter (null when transporting history-by-history).
+    SP_Event_Transporter d_event_transporter;
+
   public:
     // Constructor.
     Source_Transporter(RCP_Std_DB db, SP_Geometry geometry, SP_Physics physics);
@@ -113,6 +136,12 @@ class Source_Transporter
     //! Get the source.
     const Source_t& source() const { REQUIRE(d_source); return *d_source; }
 
+    //! Number of threads used to run histories on this domain.
+    int num_threads() const { return d_num_threads; }
+
+    //! Whether particles are transported event-by-event.
+    bool event_based() const { return static_cast<bool>(d_event_transporter); }
+
   private:
     // >>> IMPLEMENTATION
 
@@ -122,6 +151,45 @@ class Source_Transporter
     // Print out frequency for particle histories.
     double d_print_fraction;
     size_type d_print_count;
+
+    // Number of threads used to run histories.
+    int d_num_threads;
+
+    // Fission site container and keff iterate for fission site sampling.
+    SP_Fission_Sites d_fission_sites;
+    double           d_keff;
+
+    // Number of source particles drawn in the current solve.
+    size_type d_num_emitted;
+
+    // Thread-private fission sites and the source history of each site.
+    typedef std::vector<size_type> Vec_History;
+    std::vector<SP_Fission_Sites>  d_thread_sites;
+    std::vector<Vec_History>       d_site_histories;
+
+    // Solve on one thread or on multiple threads.
+    size_type solve_serial();
+    size_type solve_threaded();
+
+    // Solve with the event-based transporter.
+    size_type solve_events();
+
+    // Draw a particle from the source on a thread.
+    bool emit_on_thread(Particle_t &p, size_type &history,
+                        typename Source_t::RNG_t &rng, bool &has_rng);
+
+    // Make the thread-private fission site containers.
+    void make_thread_sites();
+
+    // Add thread-private fission sites to the container in history order.
+    void merge_thread_sites();
+
+    // Transport a source particle and all of its secondaries.
+    void transport_history(Particle_t &p, Transporter_t &transporter,
+                           Bank_t &bank);
+
+    // Print a progress message.
+    void print_progress(size_type counter) const;
 };
 
 } // end namespace profugus
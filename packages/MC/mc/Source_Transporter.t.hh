@@ -11,13 +11,19 @@
 #ifndef MC_mc_Source_Transporter_t_hh
 #define MC_mc_Source_Transporter_t_hh
 
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
 #include <cmath>
+#include <tuple>
+#include <vector>
 
 #include "harness/Diagnostics.hh"
+#include "harness/Warnings.hh"
 #include "comm/global.hh"
+#include "comm/OMP.hh"
 #include "comm/Timing.hh"
+#include "Event_Transporter.t.hh"
 #include "Source_Transporter.hh"
 
 namespace profugus
@@ -37,6 +43,8 @@ Source_Transporter<Geometry>::Source_Transporter(RCP_Std_DB  db,
     , d_physics(physics)
     , d_node(profugus::node())
     , d_nodes(profugus::nodes())
+    , d_keff(0.0)
+    , d_num_emitted(0)
 {
     REQUIRE(!db.is_null());
     REQUIRE(d_geometry);
@@ -47,6 +55,36 @@ Source_Transporter<Geometry>::Source_Transporter(RCP_Std_DB  db,
 
     // set the output frequency for particle transport diagnostics
     d_print_fraction = db->get("mc_diag_frac", 1.1);
+
+    // set the number of threads used to run histories on this domain
+    d_num_threads = db->get("num_threads", 1);
+    VALIDATE(d_num_threads > 0, "Number of threads must be positive, "
+             << d_num_threads << " requested.");
+    if (d_num_threads > 1 && !profugus::multithreading_available())
+    {
+        ADD_WARNING("Multithreading is not available in this build, "
+                    << "running histories on 1 thread instead of "
+                    << d_num_threads);
+        d_num_threads = 1;
+    }
+
+    // make the event-based transporter if requested
+    auto type = db->get("transport_type", std::string("history"));
+    VALIDATE(type == "history" || type == "event",
+             "Unknown transport_type " << type << "; must be history "
+             << "or event.");
+    if (type == "event")
+    {
+        int batch_size = db->get("event_batch_size", 10000);
+        VALIDATE(batch_size > 0, "Event batch size must be positive, "
+                 << batch_size << " requested.");
+
+        d_event_transporter = std::make_shared<Event_Transporter_t>(
+            batch_size);
+        d_event_transporter->set(d_geometry, d_physics);
+    }
+
+    ENSURE(d_num_threads > 0);
 }
 
 //---------------------------------------------------------------------------//
@@ -76,75 +114,25 @@ void Source_Transporter<Geometry>::assign_source(SP_Source source)
 template <class Geometry>
 void Source_Transporter<Geometry>::solve()
 {
-    using std::cout; using std::endl;
-
     REQUIRE(d_source);
+    REQUIRE(d_tallier);
+    REQUIRE(d_tallier->num_threads() == d_num_threads);
 
     // barrier at the start
     profugus::global_barrier();
 
     SCOPED_TIMER("MC::Source_Transporter.solve");
 
-    // particle counter
-    size_type counter = 0;
-
-    // get a base class reference to the source
-    Source_t &source = *d_source;
-
-    // make a particle bank
-    typename Transporter_t::Bank_t bank;
-    CHECK(bank.empty());
-
     // run all the local histories while the source exists, there is no need
     // to communicate particles because the problem is replicated
-    while (!source.empty())
-    {
-        // get a particle from the source
-        SP_Particle p = source.get_particle();
-        CHECK(p);
-        CHECK(p->alive());
-
-        // Do "source event" tallies on the particle
-        d_tallier->source(*p);
-
-        // transport the particle through this (replicated) domain
-        d_transporter.transport(*p, bank);
-        CHECK(!p->alive());
-
-        // transport any secondary particles that are part of this history
-        // (from splitting or physics) that get put into the bank
-        while (!bank.empty())
-        {
-            // get a particle from the bank
-            SP_Particle bank_particle = bank.pop();
-            CHECK(bank_particle);
-            CHECK(bank_particle->alive());
-
-            // make particle alive
-            bank_particle->live();
-
-            // transport it
-            d_transporter.transport(*bank_particle, bank);
-            CHECK(!bank_particle->alive());
-        }
-
-        // update the counter
-        ++counter;
-
-        // indicate completion of particle history
-        d_tallier->end_history();
-
-        // print message if needed
-        if (counter % d_print_count == 0)
-        {
-            double percent_complete
-                = (100. * counter) / source.num_to_transport();
-            cout << ">>> Finished " << counter << "("
-                 << std::setw(6) << std::fixed << std::setprecision(2)
-                 << percent_complete << "%) particles on domain "
-                 << d_node << endl;
-        }
-    }
+    size_type counter = 0;
+    d_num_emitted     = 0;
+    if (d_event_transporter)
+        counter = solve_events();
+    else if (d_num_threads == 1)
+        counter = solve_serial();
+    else
+        counter = solve_threaded();
 
     // barrier at the end
     profugus::global_barrier();
@@ -154,8 +142,7 @@ void Source_Transporter<Geometry>::solve()
 
 #ifdef REMEMBER_ON
     profugus::global_sum(counter);
-    ENSURE(counter == source.total_num_to_transport());
-    ENSURE(bank.empty());
+    ENSURE(counter == d_source->total_num_to_transport());
 #endif
 }
 
@@ -178,6 +165,12 @@ void Source_Transporter<Geometry>::sample_fission_sites(SP_Fission_Sites fis_sit
     // set the transporter with the fission site container and the latest keff
     // iterate
     d_transporter.set(fis_sites, keff);
+    if (d_event_transporter)
+        d_event_transporter->set(fis_sites, keff);
+
+    // store them for the thread-private transporters
+    d_fission_sites = fis_sites;
+    d_keff          = keff;
 }
 
 //---------------------------------------------------------------------------//
@@ -191,6 +184,8 @@ void Source_Transporter<Geometry>::set(SP_Variance_Reduction vr)
 
     // set the variance reduction in the domain transporter and locally
     d_transporter.set(vr);
+    if (d_event_transporter)
+        d_event_transporter->set(vr);
     d_var_reduction = vr;
 
     ENSURE(d_var_reduction);
@@ -207,9 +202,394 @@ void Source_Transporter<Geometry>::set(SP_Tallier tallier)
 
     // set the tally controller in the domain transporter and locally
     d_transporter.set(tallier);
+    if (d_event_transporter)
+        d_event_transporter->set(tallier);
     d_tallier = tallier;
 
+    // size the thread-private tally accumulators
+    d_tallier->set_num_threads(d_num_threads);
+
     ENSURE(d_tallier);
+    ENSURE(d_tallier->num_threads() == d_num_threads);
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Run all local histories on the calling thread.
+ */
+template <class Geometry>
+auto Source_Transporter<Geometry>::solve_serial() -> size_type
+{
+    // particle counter
+    size_type counter = 0;
+
+    // get a base class reference to the source
+    Source_t &source = *d_source;
+
+    // make a particle bank
+    Bank_t bank;
+    CHECK(bank.empty());
+
+    // particle that is reused for every history
+    Particle_t p;
+
+    while (!source.empty())
+    {
+        // get a particle from the source
+        source.emit_particle(p);
+        CHECK(p.alive());
+
+        // run the history
+        transport_history(p, d_transporter, bank);
+
+        // update the counter
+        ++counter;
+
+        // print message if needed
+        if (counter % d_print_count == 0)
+            print_progress(counter);
+    }
+
+    ENSURE(bank.empty());
+    return counter;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Run all local histories concurrently on multiple threads.
+ *
+ * The source is not thread-safe, so particles are drawn from it inside a
+ * critical section.  Each thread transports its particles with a private copy
+ * of the domain transporter, bank, and fission site container, and reuses a
+ * single particle for all of its histories.  When the source uses
+ * counter-based random number streams every history is independent and
+ * results do not depend on the number of threads.  Otherwise, every thread
+ * spawns an independent random number stream from the first particle it
+ * draws and uses it for the remainder of its histories.
+ *
+ * Fission sites are sampled into thread-private containers, tagged with the
+ * index of the history that produced them, and added to the fission site
+ * container in history order after all histories have run.
+ */
+template <class Geometry>
+auto Source_Transporter<Geometry>::solve_threaded() -> size_type
+{
+    REQUIRE(d_num_threads > 1);
+
+    // particle counter
+    size_type counter = 0;
+
+    // thread-private particles (constructed outside of the parallel region
+    // because particle metadata construction is not thread-safe)
+    std::vector<Particle_t> particles(d_num_threads);
+
+    // thread-private fission sites
+    if (d_fission_sites)
+        make_thread_sites();
+
+#pragma omp parallel num_threads(d_num_threads) reduction(+:counter)
+    {
+        const int thread = profugus::thread_id();
+
+        // thread-private transporter, bank, and particle
+        Transporter_t transporter(d_transporter);
+        Bank_t        bank;
+        Particle_t   &p = particles[thread];
+
+        if (d_fission_sites)
+            transporter.set(d_thread_sites[thread], d_keff);
+
+        // thread-private random number stream
+        typename Source_t::RNG_t rng;
+        bool has_rng = false;
+
+        size_type history = 0;
+        while (emit_on_thread(p, history, rng, has_rng))
+        {
+            CHECK(p.alive());
+
+            transport_history(p, transporter, bank);
+
+            // tag the fission sites sampled by this history
+            if (d_fission_sites)
+            {
+                d_site_histories[thread].resize(
+                    d_thread_sites[thread]->size(), history);
+            }
+
+            // update the counter
+            ++counter;
+        }
+        CHECK(bank.empty());
+    }
+
+    // add the fission sites to the global container in history order
+    if (d_fission_sites)
+        merge_thread_sites();
+
+    // print the final message
+    if (counter >= d_print_count)
+        print_progress(counter);
+
+    return counter;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Run all local histories with the event-based transporter.
+ *
+ * On multiple threads, each thread runs its own copy of the event
+ * transporter (with its own batch of particles in flight) and draws particles
+ * from the source exactly as in solve_threaded().  The event transporter
+ * tags fission sites with their source history, and they are added to the
+ * fission site container in history order as in solve_threaded().
+ */
+template <class Geometry>
+auto Source_Transporter<Geometry>::solve_events() -> size_type
+{
+    REQUIRE(d_event_transporter);
+
+    // particle counter
+    size_type counter = 0;
+
+    // get a base class reference to the source
+    Source_t &source = *d_source;
+
+    // transporter-private fission sites
+    if (d_fission_sites)
+        make_thread_sites();
+
+    if (d_num_threads == 1)
+    {
+        if (d_fission_sites)
+            d_event_transporter->set(d_thread_sites[0], d_keff);
+
+        counter = d_event_transporter->transport(
+            [this, &source](Particle_t &p, size_type &history) -> bool
+            {
+                if (source.empty())
+                    return false;
+                source.emit_particle(p);
+                history = d_num_emitted++;
+                return true;
+            });
+
+        if (d_fission_sites)
+            d_site_histories[0] = d_event_transporter->fission_site_histories();
+    }
+    else
+    {
+        // thread-private transporters (copied outside of the parallel region
+        // because particle metadata construction is not thread-safe)
+        std::vector<Event_Transporter_t> transporters(
+            d_num_threads, *d_event_transporter);
+
+#pragma omp parallel num_threads(d_num_threads) reduction(+:counter)
+        {
+            const int thread = profugus::thread_id();
+            Event_Transporter_t &transporter = transporters[thread];
+
+            if (d_fission_sites)
+                transporter.set(d_thread_sites[thread], d_keff);
+
+            // thread-private random number stream
+            typename Source_t::RNG_t rng;
+            bool has_rng = false;
+
+            counter += transporter.transport(
+                [&](Particle_t &p, size_type &history)
+                { return emit_on_thread(p, history, rng, has_rng); });
+
+            if (d_fission_sites)
+                d_site_histories[thread] = transporter.fission_site_histories();
+        }
+    }
+
+    // add the fission sites to the global container in history order
+    if (d_fission_sites)
+        merge_thread_sites();
+
+    // print the final message
+    if (counter >= d_print_count)
+        print_progress(counter);
+
+    return counter;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Draw a particle from the source on a thread.
+ *
+ * The source is not thread-safe, so this is done inside a critical section.
+ * Histories with counter-based streams are independent; otherwise, the
+ * particle is given this thread's stream, which is spawned from the first
+ * particle the thread draws.
+ *
+ * \param history set to the index of the history in this solve
+ *
+ * \return false if the source is empty
+ */
+template <class Geometry>
+bool Source_Transporter<Geometry>::emit_on_thread(
+    Particle_t               &p,
+    size_type                &history,
+    typename Source_t::RNG_t &rng,
+    bool                     &has_rng)
+{
+    bool emitted = false;
+
+#pragma omp critical(mc_source)
+    {
+        Source_t &source = *d_source;
+
+        if (!source.empty())
+        {
+            // get a particle from the source
+            source.emit_particle(p);
+            history = d_num_emitted++;
+            emitted = true;
+
+            if (!p.rng().counter_based())
+            {
+                // spawn this thread's stream the first time through
+                if (!has_rng)
+                {
+                    rng     = source.rng_control().spawn(p.rng());
+                    has_rng = true;
+                }
+
+                // this is done inside the critical section because the
+                // source stream's reference count is shared
+                p.set_rng(rng);
+            }
+        }
+    }
+
+    return emitted;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Make empty thread-private fission site containers.
+ *
+ * The containers are kept between solves so that their storage is reused.
+ */
+template <class Geometry>
+void Source_Transporter<Geometry>::make_thread_sites()
+{
+    REQUIRE(d_fission_sites);
+
+    d_thread_sites.resize(d_num_threads);
+    d_site_histories.resize(d_num_threads);
+
+    for (int t = 0; t < d_num_threads; ++t)
+    {
+        if (!d_thread_sites[t])
+        {
+            d_thread_sites[t] = std::make_shared<
+                typename Transporter_t::Fission_Site_Container>();
+        }
+        d_thread_sites[t]->clear();
+        d_site_histories[t].clear();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Add thread-private fission sites to the container in history order.
+ *
+ * Every history runs on a single thread, so ordering the sites by (history,
+ * position in the thread-private container) reproduces the order in which a
+ * single thread running the histories one after another would sample them.
+ */
+template <class Geometry>
+void Source_Transporter<Geometry>::merge_thread_sites()
+{
+    REQUIRE(d_fission_sites);
+    REQUIRE(d_thread_sites.size() == d_site_histories.size());
+
+    // (history, thread, site) of every thread-private fission site
+    std::vector<std::tuple<size_type, int, size_type>> order;
+    for (int t = 0, Nt = d_thread_sites.size(); t < Nt; ++t)
+    {
+        const auto &histories = d_site_histories[t];
+        CHECK(histories.size() == d_thread_sites[t]->size());
+
+        for (size_type n = 0; n < histories.size(); ++n)
+            order.emplace_back(histories[n], t, n);
+    }
+    std::sort(order.begin(), order.end());
+
+    // append the sites in history order
+    d_fission_sites->reserve(d_fission_sites->size() + order.size());
+    for (const auto &o : order)
+    {
+        d_fission_sites->push_back(
+            (*d_thread_sites[std::get<1>(o)])[std::get<2>(o)]);
+    }
+
+    for (int t = 0, Nt = d_thread_sites.size(); t < Nt; ++t)
+    {
+        d_thread_sites[t]->clear();
+        d_site_histories[t].clear();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Transport a source particle and all of its secondaries.
+ */
+template <class Geometry>
+void Source_Transporter<Geometry>::transport_history(Particle_t    &p,
+                                                     Transporter_t &transporter,
+                                                     Bank_t        &bank)
+{
+    REQUIRE(p.alive());
+
+    // Do "source event" tallies on the particle
+    d_tallier->source(p);
+
+    // transport the particle through this (replicated) domain
+    transporter.transport(p, bank);
+    CHECK(!p.alive());
+
+    // transport any secondary particles that are part of this history
+    // (from splitting or physics) that get put into the bank; the (dead)
+    // source particle is reused to hold them
+    while (!bank.empty())
+    {
+        // get a particle from the bank
+        bank.pop(p);
+        CHECK(p.alive());
+
+        // make particle alive
+        p.live();
+
+        // transport it
+        transporter.transport(p, bank);
+        CHECK(!p.alive());
+    }
+
+    // indicate completion of particle history
+    d_tallier->end_history();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Print a progress message.
+ */
+template <class Geometry>
+void Source_Transporter<Geometry>::print_progress(size_type counter) const
+{
+    using std::cout; using std::endl;
+
+    double percent_complete = (100. * counter) / d_source->num_to_transport();
+    cout << ">>> Finished " << counter << "("
+         << std::setw(6) << std::fixed << std::setprecision(2)
+         << percent_complete << "%) particles on domain "
+         << d_node << endl;
 }
 
 } // end namespace profugus
@@ -15,6 +15,7 @@
 #include <memory>
 
 #include "Tally.hh"
+#include "Keff_Tally.hh"
 #include "Physics.hh"
 
 namespace profugus
@@ -24,6 +25,12 @@ namespace profugus
 /*!
  * \class Tallier
  * \brief Do tally operations.
+ *
+ * The tally event functions are called for every particle step, collision,
+ * and surface crossing, so build() assembles dispatch tables of raw tally
+ * pointers for each event.  When the only pathlength tally is a Keff_Tally,
+ * as in inactive kcode cycles, path_length() calls it directly without
+ * virtual dispatch.
  */
 /*!
  * \example mc/test/tstTallier.cc
@@ -46,11 +53,14 @@ class Tallier
     typedef Source_Tally<Geometry_t>            Source_Tally_t;
     typedef Compound_Tally<Geometry_t>          Compound_Tally_t;
     typedef Surface_Tally<Geometry_t>           Surface_Tally_t;
+    typedef Collision_Tally<Geometry_t>         Collision_Tally_t;
+    typedef Keff_Tally<Geometry_t>              Keff_Tally_t;
     typedef std::shared_ptr<Tally_t>            SP_Tally;
     typedef std::shared_ptr<Pathlength_Tally_t> SP_Pathlength_Tally;
     typedef std::shared_ptr<Source_Tally_t>     SP_Source_Tally;
     typedef std::shared_ptr<Compound_Tally_t>   SP_Compound_Tally;
     typedef std::shared_ptr<Surface_Tally_t>    SP_Surface_Tally;
+    typedef std::shared_ptr<Collision_Tally_t>  SP_Collision_Tally;
     typedef std::shared_ptr<Geometry_t>         SP_Geometry;
     typedef std::shared_ptr<Physics_t>          SP_Physics;
     typedef std::vector<SP_Tally>               Vec_Tallies;
@@ -71,6 +81,18 @@ class Tallier
     std::vector<SP_Source_Tally>     d_src;
     std::vector<SP_Compound_Tally>   d_comp;
     std::vector<SP_Surface_Tally>    d_surf;
+    std::vector<SP_Collision_Tally>  d_coll;
+
+    // Tallies that do work at the end of every history.
+    Vec_Tallies d_hist;
+
+    // Event dispatch tables (assembled during build).
+    std::vector<Pathlength_Tally_t *> d_pl_events;
+    std::vector<Collision_Tally_t *>  d_coll_events;
+    std::vector<Surface_Tally_t *>    d_surf_events;
+
+    // Keff tally when it is the only pathlength tally, otherwise null.
+    Keff_Tally_t *d_keff;
 
   public:
     // Constructor.
@@ -90,6 +112,7 @@ class Tallier
     void add_source_tally(SP_Source_Tally tally);
     void add_compound_tally(SP_Compound_Tally tally);
     void add_surface_tally(SP_Surface_Tally tally);
+    void add_collision_tally(SP_Collision_Tally tally);
 
     //@{
     //! Number of tallies.
@@ -113,6 +136,14 @@ class Tallier
     {
         return d_surf.size();
     }
+    auto num_collision_tallies() const -> decltype(d_coll.size())
+    {
+        return d_coll.size();
+    }
+    auto num_history_tallies() const -> decltype(d_hist.size())
+    {
+        return d_hist.size();
+    }
     //@}
 
     //@{
@@ -124,6 +155,12 @@ class Tallier
     // Initialize internal data structures after adding tallies.
     void build();
 
+    // Set the number of threads that tally histories concurrently.
+    void set_num_threads(int num_threads);
+
+    //! Number of threads that tally histories concurrently.
+    int num_threads() const { return d_num_threads; }
+
     // >>> TALLY OPERATIONS
 
     // Process path-length tally events.
@@ -135,6 +172,9 @@ class Tallier
     // Tally any surface events.
     void surface(const Particle_t &p);
 
+    // Tally any collision events.
+    void collision(const Particle_t &p);
+
     // Tell the tallies to begin active kcode cycles
     void begin_active_cycles();
 
@@ -171,6 +211,15 @@ class Tallier
     template<class Vec_T>
     void prune(Vec_T &tallies);
 
+    // Size thread-private tally storage.
+    void build_threads();
+
+    // Assemble the event dispatch tables.
+    void build_dispatch();
+
+    // Number of threads tallying concurrently.
+    int d_num_threads;
+
     //! Phases of construction, for error checking
     enum Build_Phase
     {
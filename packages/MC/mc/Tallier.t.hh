@@ -68,6 +68,57 @@ void Tallier<Geometry>::prune(Vec_T &tallies)
     ENSURE(tallies.size() == size);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Size thread-private storage in all tallies.
+ */
+template <class Geometry>
+void Tallier<Geometry>::build_threads()
+{
+    REQUIRE(d_build_phase == BUILT);
+
+    for (const auto &t : d_tallies)
+    {
+        CHECK(t);
+        VALIDATE(d_num_threads == 1 || t->thread_safe(),
+                 "The " << t->name() << " tally does not support "
+                 << d_num_threads << " concurrent threads.");
+
+        t->set_num_threads(d_num_threads);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Assemble the event dispatch tables.
+ *
+ * The tables hold raw pointers to the tallies owned by the tally containers,
+ * so they must be rebuilt whenever the containers change.
+ */
+template <class Geometry>
+void Tallier<Geometry>::build_dispatch()
+{
+    d_pl_events.clear();
+    d_coll_events.clear();
+    d_surf_events.clear();
+
+    for (const auto &t : d_pl)
+        d_pl_events.push_back(t.get());
+    for (const auto &t : d_coll)
+        d_coll_events.push_back(t.get());
+    for (const auto &t : d_surf)
+        d_surf_events.push_back(t.get());
+
+    // call the keff tally directly when it is the only pathlength tally
+    d_keff = nullptr;
+    if (d_pl_events.size() == 1)
+        d_keff = dynamic_cast<Keff_Tally_t *>(d_pl_events.front());
+
+    ENSURE(d_pl_events.size() == d_pl.size());
+    ENSURE(d_coll_events.size() == d_coll.size());
+    ENSURE(d_surf_events.size() == d_surf.size());
+}
+
 //---------------------------------------------------------------------------//
 // CONSTRUCTOR
 //---------------------------------------------------------------------------//
@@ -76,7 +127,9 @@ void Tallier<Geometry>::prune(Vec_T &tallies)
  */
 template <class Geometry>
 Tallier<Geometry>::Tallier()
-    : d_build_phase(CONSTRUCTED)
+    : d_keff(nullptr)
+    , d_num_threads(1)
+    , d_build_phase(CONSTRUCTED)
 {
 }
 
@@ -166,6 +219,20 @@ void Tallier<Geometry>::add_surface_tally(SP_Surface_Tally tally)
     d_surf.push_back(tally);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Add a collision tally.
+ */
+template <class Geometry>
+void Tallier<Geometry>::add_collision_tally(SP_Collision_Tally tally)
+{
+    REQUIRE(tally);
+    REQUIRE(d_build_phase < BUILT);
+
+    // add the tally
+    d_coll.push_back(tally);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \brief Initialize internal data structures after adding tallies.
@@ -181,18 +248,36 @@ void Tallier<Geometry>::build()
     prune(d_src);
     prune(d_comp);
     prune(d_surf);
+    prune(d_coll);
 
-    // add pathlength, source, and compound tallies to the "totals"
+    // add pathlength, source, compound, surface, and collision tallies to
+    // the "totals"
     d_tallies.insert(d_tallies.end(), d_pl.begin(),   d_pl.end());
     d_tallies.insert(d_tallies.end(), d_src.begin(),  d_src.end());
     d_tallies.insert(d_tallies.end(), d_comp.begin(), d_comp.end());
     d_tallies.insert(d_tallies.end(), d_surf.begin(), d_surf.end());
+    d_tallies.insert(d_tallies.end(), d_coll.begin(), d_coll.end());
     CHECK(num_tallies() == num_source_tallies() + num_pathlength_tallies() +
-          num_compound_tallies() + num_surface_tallies());
+          num_compound_tallies() + num_surface_tallies() +
+          num_collision_tallies());
+
+    // assemble the event dispatch tables
+    build_dispatch();
+
+    // only call end_history() on tallies that need it
+    d_hist.clear();
+    for (const auto &t : d_tallies)
+    {
+        if (t->requires_end_history())
+            d_hist.push_back(t);
+    }
 
     // Set the build phase
     d_build_phase = BUILT;
 
+    // size thread-private storage in the tallies
+    build_threads();
+
     // Print warnings if applicable
     if (num_tallies() == 0)
     {
@@ -202,6 +287,29 @@ void Tallier<Geometry>::build()
     ENSURE(d_build_phase == BUILT);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Set the number of threads that tally histories concurrently.
+ *
+ * Each thread must run complete histories, ie. all of the tally events for a
+ * history, including end_history(), must be called from the same thread.
+ * Thread-private results are reduced when cycles end and when the tallies are
+ * finalized.  If the tallier is already built the tallies are updated
+ * immediately; otherwise, this is deferred to build().
+ */
+template <class Geometry>
+void Tallier<Geometry>::set_num_threads(int num_threads)
+{
+    REQUIRE(num_threads > 0);
+
+    d_num_threads = num_threads;
+
+    if (d_build_phase == BUILT)
+        build_threads();
+
+    ENSURE(d_num_threads == num_threads);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \brief Process path-length tally events.
@@ -221,8 +329,15 @@ void Tallier<Geometry>::path_length(double            step,
 
     SCOPED_TIMER_3("MC::Tallier.path_length");
 
+    // keff only; Keff_Tally::accumulate is final so this is a direct call
+    if (d_keff)
+    {
+        d_keff->accumulate(step, p);
+        return;
+    }
+
     // accumulate results for all pathlength tallies
-    for (auto t : d_pl)
+    for (auto t : d_pl_events)
     {
         t->accumulate(step, p);
     }
@@ -245,7 +360,7 @@ void Tallier<Geometry>::source(const Particle_t &p)
     SCOPED_TIMER_3("MC::Tallier.source");
 
     // accumulate results for all pathlength tallies
-    for (auto t : d_src)
+    for (const auto &t : d_src)
     {
         t->birth(p);
     }
@@ -267,13 +382,38 @@ void Tallier<Geometry>::surface(const Particle_t &p)
 
     SCOPED_TIMER_3("MC::Tallier.tally_surface");
 
-    // accumulate results for all pathlength tallies
-    for (auto t : d_surf)
+    // accumulate results for all surface tallies
+    for (auto t : d_surf_events)
     {
         t->tally_surface(p);
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Tally any collision events.
+ *
+ * This is called at the collision site before the collision is processed.
+ *
+ * \param p particle
+ */
+template <class Geometry>
+void Tallier<Geometry>::collision(const Particle_t &p)
+{
+    REQUIRE(d_build_phase == BUILT);
+
+    if (!num_collision_tallies())
+        return;
+
+    SCOPED_TIMER_3("MC::Tallier.collision");
+
+    // accumulate results for all collision tallies
+    for (auto t : d_coll_events)
+    {
+        t->collision(p);
+    }
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \brief Tell the tallies to begin active kcode cycles.
@@ -331,16 +471,22 @@ void Tallier<Geometry>::end_cycle(double num_particles)
 //---------------------------------------------------------------------------//
 /*!
  * \brief Perform all end-history tally tasks.
+ *
+ * Tallies that do not require end-of-history processing (for example,
+ * tallies using batch statistics) are skipped.
  */
 template <class Geometry>
 void Tallier<Geometry>::end_history()
 {
     REQUIRE(d_build_phase == BUILT);
 
+    if (!num_history_tallies())
+        return;
+
     SCOPED_TIMER_2("MC::Tallier.end_history");
 
-    // begin active for each tally
-    for (auto t : d_tallies)
+    // end the history for each tally
+    for (const auto &t : d_hist)
     {
         t->end_history();
     }
@@ -401,6 +547,11 @@ void Tallier<Geometry>::reset()
 
     // clear the list of tallies (need to call build again to get these)
     d_tallies.clear();
+    d_hist.clear();
+    d_pl_events.clear();
+    d_coll_events.clear();
+    d_surf_events.clear();
+    d_keff = nullptr;
 
     // set the build phase
     d_build_phase = ASSIGNED;
@@ -423,7 +574,15 @@ void Tallier<Geometry>::swap(Tallier<Geometry> &rhs)
     d_src.swap(rhs.d_src);
     d_comp.swap(rhs.d_comp);
     d_surf.swap(rhs.d_surf);
+    d_coll.swap(rhs.d_coll);
     d_tallies.swap(rhs.d_tallies);
+    d_hist.swap(rhs.d_hist);
+
+    // swap dispatch tables
+    d_pl_events.swap(rhs.d_pl_events);
+    d_coll_events.swap(rhs.d_coll_events);
+    d_surf_events.swap(rhs.d_surf_events);
+    std::swap(d_keff, rhs.d_keff);
 
     // swap geometry and physics
     std::swap(d_geometry, rhs.d_geometry);
@@ -77,6 +77,9 @@ class Tally
     //! Accumulate first and second moments
     virtual void end_history() { /* * */ }
 
+    //! Query if end_history() must be called after every history.
+    virtual bool requires_end_history() const { return true; }
+
     //! Do post-processing on first and second moments
     virtual void finalize(double num_particles) { /* * */ }
 
@@ -91,6 +94,15 @@ class Tally
 
     //! Clear/re-initialize all tally values between solves
     virtual void reset() { /* * */ }
+
+    // >>> THREADING INTERFACE
+
+    //! Size thread-private accumulators for concurrent histories (default
+    //! no-op)
+    virtual void set_num_threads(int num_threads) { /* * */ }
+
+    //! Query if histories can be tallied concurrently on multiple threads.
+    virtual bool thread_safe() const { return false; }
 };
 
 //---------------------------------------------------------------------------//
@@ -224,6 +236,38 @@ class Surface_Tally : public Tally<Geometry>
     virtual void tally_surface(const Particle_t &p) = 0;
 };
 
+/*!
+ * \class Collision_Tally
+ * \brief Defines collision tally interfaces.
+ *
+ * Collision tallies are called at each collision site before the collision
+ * is processed, so the particle has its pre-collision weight, group, and
+ * material.  A collision estimator scores \f$w/\Sigma_t\f$ times the
+ * response at each collision instead of scoring every path segment.
+ */
+template <class Geometry>
+class Collision_Tally : public Tally<Geometry>
+{
+    typedef Tally<Geometry>                 Base;
+    typedef Physics<Geometry>               Physics_t;
+    typedef typename Physics_t::Particle_t  Particle_t;
+    typedef std::shared_ptr<Physics_t>      SP_Physics;
+
+  public:
+    // Constructor.
+    Collision_Tally(SP_Physics physics, bool inactive)
+        : Base(physics, inactive)
+    { /*...*/ }
+
+    // Destructor.
+    virtual ~Collision_Tally() = 0;
+
+    // >>> TALLY INTERFACE
+
+    //! Tally at a collision site.
+    virtual void collision(const Particle_t &p) = 0;
+};
+
 
 } // end namespace profugus
 
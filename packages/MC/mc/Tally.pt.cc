@@ -30,6 +30,9 @@ template class Compound_Tally<Mesh_Geometry>;
 template class Surface_Tally<Core>;
 template class Surface_Tally<Mesh_Geometry>;
 
+template class Collision_Tally<Core>;
+template class Collision_Tally<Mesh_Geometry>;
+
 } // end namespace profugus
 
 //---------------------------------------------------------------------------//
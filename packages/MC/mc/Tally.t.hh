@@ -65,6 +65,15 @@ Surface_Tally<Geometry>::~Surface_Tally()
 {
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Pure virtual destructor definition.
+ */
+template <class Geometry>
+Collision_Tally<Geometry>::~Collision_Tally()
+{
+}
+
 } // end namespace profugus
 
 #endif // MC_mc_Tally_t_hh
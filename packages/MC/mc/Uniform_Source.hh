@@ -86,6 +86,9 @@ class Uniform_Source : public Source<Geometry>
     // Get a particle from the source.
     SP_Particle get_particle();
 
+    // Emit the next source particle into an existing particle.
+    void emit_particle(Particle_t &p);
+
     //! Boolean operator for source (true when source still has particles).
     bool empty() const { return d_np_left == 0; }
 
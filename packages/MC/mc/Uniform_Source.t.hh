@@ -53,6 +53,9 @@ Uniform_Source<Geometry>::Uniform_Source(RCP_Std_DB     db,
 {
     REQUIRE(!db.is_null());
 
+    // set the random number stream type
+    Base::set_rng_type(db->get("rng_type", std::string("sprng")));
+
     // store the total number of requested particles
     d_np_requested = static_cast<size_type>(db->get("Np", 1000));
     VALIDATE(d_np_requested > 0., "Number of source particles ("
@@ -118,6 +121,9 @@ void Uniform_Source<Geometry>::build_source(SP_Shape geometric_shape)
     d_np_left = d_np_domain;
     d_np_run  = 0;
 
+    // number the histories on this domain
+    Base::make_history_ids(d_np_domain);
+
     profugus::global_barrier();
 }
 
@@ -128,12 +134,6 @@ void Uniform_Source<Geometry>::build_source(SP_Shape geometric_shape)
 template <class Geometry>
 auto Uniform_Source<Geometry>::get_particle() -> SP_Particle
 {
-    using def::I; using def::J; using def::K;
-
-    REQUIRE(d_wt > 0.0);
-    REQUIRE(profugus::Global_RNG::d_rng.assigned());
-    REQUIRE(d_geo_shape);
-
     // unassigned particle
     SP_Particle p;
 
@@ -143,14 +143,32 @@ auto Uniform_Source<Geometry>::get_particle() -> SP_Particle
         return p;
     }
 
-    SCOPED_TIMER_2("MC::Uniform_Source.get_particle");
-
     // make a particle
     p = std::make_shared<Particle_t>();
+    emit_particle(*p);
 
-    // use the global rng on this domain for the random number generator
-    p->set_rng(profugus::Global_RNG::d_rng);
-    auto rng = p->rng();
+    return p;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Emit the next source particle into an existing particle.
+ */
+template <class Geometry>
+void Uniform_Source<Geometry>::emit_particle(Particle_t &p)
+{
+    using def::I; using def::J; using def::K;
+
+    REQUIRE(d_wt > 0.0);
+    REQUIRE(profugus::Global_RNG::d_rng.assigned());
+    REQUIRE(d_geo_shape);
+    REQUIRE(d_np_left);
+
+    SCOPED_TIMER_2("MC::Uniform_Source.get_particle");
+
+    // use the random number generator for this history
+    p.set_rng(Base::history_RNG(d_np_run));
+    auto &rng = p.rng();
 
     // material id
     int matid = 0;
@@ -166,32 +184,31 @@ auto Uniform_Source<Geometry>::get_particle() -> SP_Particle
     r = d_geo_shape->sample(rng);
 
     // intialize the geometry state
-    b_geometry->initialize(r, omega, p->geo_state());
+    b_geometry->initialize(r, omega, p.geo_state());
 
     // get the material id
-    matid = b_geometry->matid(p->geo_state());
+    matid = b_geometry->matid(p.geo_state());
 
     // initialize the physics state by manually sampling the group
     int group = sampler::sample_discrete_CDF(
         d_erg_cdf.size(), &d_erg_cdf[0], rng.ran());
     CHECK(group < b_physics->num_groups());
-    p->set_group(group);
+    p.set_group(group);
 
     // set the material id in the particle
-    p->set_matid(matid);
+    p.set_matid(matid);
 
     // set particle weight
-    p->set_wt(d_wt);
+    p.set_wt(d_wt);
 
     // make particle alive
-    p->live();
+    p.live();
 
     // update counters
     --d_np_left;
     ++d_np_run;
 
-    ENSURE(p->matid() == matid);
-    return p;
+    ENSURE(p.matid() == matid);
 }
 
 //---------------------------------------------------------------------------//
@@ -232,6 +232,16 @@ TEST_F(KernelTest, axial_kernel_bandwidth_calc)
 
         EXPECT_SOFTEQ(ref_bandwidth, kernel.bandwidth(cell), 1.0e-6);
     }
+
+    // Every cell has a bandwidth; cells without sites have zero bandwidth
+    const auto &bandwidths = kernel.get_bandwidths();
+    EXPECT_EQ(b_geometry->num_cells(), bandwidths.size());
+    for (cell_type cell = 0; cell < bandwidths.size(); ++cell)
+    {
+        double ref_bandwidth = ref_bandwidths.count(cell) ?
+                               ref_bandwidths[cell] : 0.0;
+        EXPECT_SOFTEQ(ref_bandwidth, bandwidths[cell], 1.0e-6);
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -70,7 +70,7 @@ TEST_F(BankTest, one_particle)
     p->set_wt(3.1415);
 
     // test the particle on top of the stack, see if it has the orig weight
-    EXPECT_EQ(1.23, b.top()->wt());
+    EXPECT_EQ(1.23, b.top().wt());
 
     // pop one particle
     auto popped = b.pop();
@@ -142,6 +142,51 @@ TEST_F(BankTest, two_copies_of_two)
     EXPECT_EQ(0, b.num_particles());
 }
 
+//---------------------------------------------------------------------------//
+
+TEST_F(BankTest, in_place)
+{
+    Particle p(*m_orig_p);
+
+    // push two unique particles by value
+    b.push(p, 2u);
+    p.set_matid(2);
+    b.push(p);
+
+    EXPECT_EQ(3, b.size());
+    EXPECT_EQ(2, b.num_unique());
+    EXPECT_EQ(2, b.capacity());
+    EXPECT_EQ(2, b.top().matid());
+
+    // pop into an existing particle
+    Particle q;
+    b.pop(q);
+    EXPECT_EQ(2, q.matid());
+    EXPECT_EQ(1.23, q.wt());
+    EXPECT_EQ(1, b.num_unique());
+
+    b.pop(q);
+    EXPECT_EQ(1, q.matid());
+    EXPECT_EQ(1, b.num_unique());
+    EXPECT_EQ(1, b.next_count());
+
+    // pushing reuses the released slot
+    p.set_matid(3);
+    b.push(p);
+    EXPECT_EQ(2, b.num_unique());
+    EXPECT_EQ(2, b.capacity());
+
+    b.pop(q);
+    EXPECT_EQ(3, q.matid());
+    b.pop(q);
+    EXPECT_EQ(1, q.matid());
+
+    // slots are retained after the bank is emptied
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(0, b.num_unique());
+    EXPECT_EQ(2, b.capacity());
+}
+
 //---------------------------------------------------------------------------//
 //                 end of tstBank.cc
 //---------------------------------------------------------------------------//
@@ -181,6 +181,7 @@ TEST_F(CellTallyTest, one_cell)
 
     Particle_t p;
     p.set_wt(1.0);
+    p.set_group(0);
 
     // History 1
 
@@ -284,6 +285,7 @@ TEST_F(CellTallyTest, multi_cell)
 
     Particle_t p;
     p.set_wt(1.0);
+    p.set_group(0);
 
     // History 1
 
@@ -390,6 +392,167 @@ TEST_F(CellTallyTest, multi_cell)
     }
 }
 
+//---------------------------------------------------------------------------//
+
+TEST_F(CellTallyTest, all_cells)
+{
+    // cells can only be listed once
+    EXPECT_THROW(tally->set_cells({1, 3, 1}), profugus::assertion);
+
+    tally->set_all_cells();
+
+    const auto &cells = tally->cells();
+    EXPECT_EQ(4, cells.size());
+    for (int cell = 0; cell < 4; ++cell)
+    {
+        EXPECT_EQ(cell, cells[cell]);
+    }
+
+    Particle_t p;
+    p.set_wt(1.0);
+    p.set_group(0);
+
+    // History 1; step c + 1 in cell c
+
+    double x[] = {5.0, 15.0, 5.0, 15.0};
+    double y[] = {5.0, 5.0, 15.0, 15.0};
+    for (int c = 0; c < 4; ++c)
+    {
+        geometry->initialize({x[c], y[c], 1.0}, {1.0, 1.0, 1.0},
+                             p.geo_state());
+        EXPECT_EQ(c, geometry->cell(p.geo_state()));
+        tally->accumulate(c + 1.0, p);
+    }
+    tally->end_history();
+
+    // History 2; no score
+
+    tally->end_history();
+
+    // Finalize
+    tally->finalize(2 * nodes);
+
+    // Get the results
+    auto results = tally->results();
+
+    EXPECT_EQ(4, results.size());
+    for (int c = 0; c < 4; ++c)
+    {
+        EXPECT_SOFTEQ((c + 1.0) / 2.0 / 2000.0, results[c].first, 1.0e-12);
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(CellTallyTest, batch)
+{
+    db->set("tally_statistics", std::string("batch"));
+    tally = std::make_shared<Cell_Tally>(db, physics);
+    tally->set_cells({3, 1});
+
+    EXPECT_EQ(profugus::tally::BATCH, tally->statistics());
+    EXPECT_FALSE(tally->requires_end_history());
+
+    Particle_t p;
+    p.set_wt(1.0);
+    p.set_group(0);
+
+    geometry->initialize({15.0, 15.0, 1.0}, {1.0, 1.0, 1.0}, p.geo_state());
+    EXPECT_EQ(3, geometry->cell(p.geo_state()));
+
+    // one history per domain in each cycle; the batch means in cell 3 are
+    // 1, 2, and 3 (before dividing by the volume)
+    for (int c = 0; c < 3; ++c)
+    {
+        tally->begin_cycle();
+        tally->accumulate(c + 1.0, p);
+        tally->end_cycle(nodes);
+    }
+    EXPECT_EQ(3, tally->num_batches());
+
+    // Finalize
+    tally->finalize(3 * nodes);
+
+    // Get the results
+    auto results = tally->results();
+
+    EXPECT_EQ(2, results.size());
+
+    const auto &r1 = results[1];
+    const auto &r3 = results[3];
+
+    EXPECT_EQ(0.0, r1.first);
+    EXPECT_EQ(0.0, r1.second);
+
+    EXPECT_SOFTEQ(2.0 / 2000.0,                 r3.first,  1.0e-12);
+    EXPECT_SOFTEQ(std::sqrt(1.0 / 3.0) / 2000.0, r3.second, 1.0e-12);
+
+    // a fixed-source solve outside of cycles has no batches to estimate the
+    // error from
+    tally->reset();
+    tally->accumulate(2.0, p);
+    tally->accumulate(4.0, p);
+    EXPECT_EQ(0, tally->num_batches());
+    EXPECT_THROW(tally->finalize(2 * nodes), profugus::assertion);
+
+    // nor does a single cycle
+    tally->reset();
+    tally->begin_cycle();
+    tally->accumulate(2.0, p);
+    tally->accumulate(4.0, p);
+    tally->end_cycle(2 * nodes);
+    EXPECT_EQ(1, tally->num_batches());
+    EXPECT_THROW(tally->finalize(2 * nodes), profugus::assertion);
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(CellTallyTest, response_bins)
+{
+    // group bins {0} and {1, 2} with flux, total, and nu-fission responses
+    profugus::Response_Bins bins(3);
+    bins.set({0, 1}, {profugus::physics::FLUX, profugus::physics::TOTAL,
+                      profugus::physics::NU_FISSION});
+
+    tally->set_cells({1, 3});
+    tally->set_bins(bins);
+    EXPECT_EQ(6, tally->bins().size());
+    EXPECT_EQ(2 * 6, tally->bin_results().size());
+
+    Particle_t p;
+    p.set_wt(1.0);
+
+    // mat 1 box
+    geometry->initialize({15.0, 5.0, 1.0}, {1.0, 1.0, 1.0}, p.geo_state());
+    EXPECT_EQ(1, geometry->cell(p.geo_state()));
+    p.set_matid(geometry->matid(p.geo_state()));
+
+    // step 1 in group 0 and 2 in group 2
+    p.set_group(0);
+    tally->accumulate(1.0, p);
+    p.set_group(2);
+    tally->accumulate(2.0, p);
+    tally->end_history();
+
+    // second history with no score
+    tally->end_history();
+
+    tally->finalize(2 * nodes);
+
+    // results for cell 1 are [group_bin][response]
+    double ref[] = {0.5, 5.0, 0.5*2.4*3.2, 1.0, 16.2, 0.0};
+
+    const auto &bin_results = tally->bin_results();
+    for (int i = 0; i < 6; ++i)
+    {
+        EXPECT_SOFTEQ(ref[i] / 2000.0, bin_results[i].first, 1.0e-12);
+        EXPECT_EQ(0.0, bin_results[6 + i].first);
+    }
+
+    // results() is the first bin
+    EXPECT_SOFTEQ(0.5 / 2000.0, tally->results().at(1).first, 1.0e-12);
+}
+
 //---------------------------------------------------------------------------//
 // end of MC/mc/test/tstCell_Tally.cc
 //---------------------------------------------------------------------------//
@@ -0,0 +1,253 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   MC/mc/test/tstCycle_Output.cc
+ * \author Thomas M. Evans
+ * \date   Fri Oct 16 09:12:44 2026
+ * \brief  Cycle_Output unit-test.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Cycle_Output.hh"
+
+#include "gtest/utils_gtest.hh"
+
+#include <cstdio>
+#include <vector>
+
+#include "comm/global.hh"
+#include "utils/Serial_HDF5_Writer.hh"
+
+#ifdef USE_HDF5
+#include "hdf5_hl.h"
+#endif
+
+//---------------------------------------------------------------------------//
+// Test fixture
+//---------------------------------------------------------------------------//
+
+class CycleOutputTest : public testing::Test
+{
+  protected:
+    typedef profugus::Cycle_Output Cycle_Output;
+    typedef std::vector<double>    Vec_Dbl;
+
+    void SetUp()
+    {
+        node  = profugus::node();
+        nodes = profugus::nodes();
+    }
+
+    // Remove a file left by a previous run.
+    void remove(const std::string &filename)
+    {
+        if (node == 0)
+            std::remove(filename.c_str());
+        profugus::global_barrier();
+    }
+
+    // Local row for a cycle on this node.
+    Vec_Dbl local(int cycle, int size)
+    {
+        Vec_Dbl row(size);
+        for (int i = 0; i < size; ++i)
+            row[i] = 100.0 * cycle + i + 0.5 * node;
+        return row;
+    }
+
+    // Expected reduced row for a cycle.
+    double expected(int cycle, int i)
+    {
+        return nodes * (100.0 * cycle + i) + 0.25 * nodes * (nodes - 1);
+    }
+
+    // Read a dataset of rows (node 0 only).
+    Vec_Dbl read(const std::string &filename, const std::string &dataset,
+                 int &num_rows, int &row_size)
+    {
+        Vec_Dbl data;
+        num_rows = row_size = 0;
+#ifdef USE_HDF5
+        hid_t file = H5Fopen(filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+
+        int         rank  = 0;
+        size_t      bytes = 0;
+        H5T_class_t dt_class;
+        hsize_t     dims[2] = {0, 0};
+        H5LTget_dataset_ndims(file, dataset.c_str(), &rank);
+        EXPECT_EQ(2, rank);
+        H5LTget_dataset_info(file, dataset.c_str(), dims, &dt_class, &bytes);
+
+        num_rows = dims[0];
+        row_size = dims[1];
+        data.resize(num_rows * row_size);
+        if (!data.empty())
+            H5LTread_dataset_double(file, dataset.c_str(), &data[0]);
+
+        H5Fclose(file);
+#endif
+        return data;
+    }
+
+  protected:
+    int node, nodes;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(CycleOutputTest, write)
+{
+    const int Nc = 5, Nr = 7;
+    remove("cycle_output.h5");
+
+    {
+        Cycle_Output output("cycle_output.h5", "cycle_flux");
+        EXPECT_EQ(0, output.num_cycles());
+
+        for (int c = 0; c < Nc; ++c)
+            output.write(local(c, Nr));
+        EXPECT_EQ(Nc, output.num_cycles());
+
+        output.close();
+    }
+
+#ifdef USE_HDF5
+    if (node == 0)
+    {
+        int num_rows = 0, row_size = 0;
+        Vec_Dbl data = read("cycle_output.h5", "cycle_flux", num_rows,
+                            row_size);
+        EXPECT_EQ(Nc, num_rows);
+        EXPECT_EQ(Nr, row_size);
+
+        for (int c = 0; c < num_rows; ++c)
+        {
+            for (int i = 0; i < row_size; ++i)
+            {
+                EXPECT_SOFTEQ(expected(c, i), data[c * Nr + i], 1.0e-12);
+            }
+        }
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(CycleOutputTest, reopen)
+{
+    const int Nr = 3;
+    remove("cycle_reopen.h5");
+
+#ifdef USE_HDF5
+    // make the file first with other data in it
+    {
+        profugus::Serial_HDF5_Writer writer;
+        writer.open("cycle_reopen.h5");
+        writer.write("cells", std::vector<int>(Nr, 1));
+        writer.close();
+    }
+#endif
+
+    // two outputs to the same file, written in turn, then appended to
+    // after the file is closed
+    Cycle_Output a("cycle_reopen.h5", "a");
+    Cycle_Output b("cycle_reopen.h5", "b");
+
+    a.write(local(0, Nr));
+    a.write(local(1, Nr));
+    a.close();
+
+    b.write(local(0, Nr));
+    b.close();
+
+    a.write(local(2, Nr));
+    a.flush();
+    a.close();
+
+    EXPECT_EQ(3, a.num_cycles());
+    EXPECT_EQ(1, b.num_cycles());
+
+#ifdef USE_HDF5
+    if (node == 0)
+    {
+        int num_rows = 0, row_size = 0;
+
+        Vec_Dbl data = read("cycle_reopen.h5", "a", num_rows, row_size);
+        EXPECT_EQ(3, num_rows);
+        EXPECT_EQ(Nr, row_size);
+        for (int n = 0; n < data.size(); ++n)
+        {
+            EXPECT_SOFTEQ(expected(n / Nr, n % Nr), data[n], 1.0e-12);
+        }
+
+        data = read("cycle_reopen.h5", "b", num_rows, row_size);
+        EXPECT_EQ(1, num_rows);
+        EXPECT_EQ(Nr, row_size);
+
+        // the existing data is kept
+        hid_t file = H5Fopen("cycle_reopen.h5", H5F_ACC_RDONLY, H5P_DEFAULT);
+        EXPECT_EQ(1, H5LTfind_dataset(file, "cells"));
+        H5Fclose(file);
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(CycleOutputTest, drain_all)
+{
+    const int Nr = 4;
+    remove("cycle_drain.h5");
+    remove("cycle_other.h5");
+
+    Cycle_Output output("cycle_drain.h5", "rows");
+#ifndef USE_HDF5
+    EXPECT_FALSE(output.asynchronous());
+#endif
+
+    output.write(local(0, Nr));
+    output.write(local(1, Nr));
+
+    // other HDF5 output on this thread while the cycle output is open
+    Cycle_Output::drain_all();
+#ifdef USE_HDF5
+    if (node == 0)
+    {
+        profugus::Serial_HDF5_Writer writer;
+        writer.open("cycle_other.h5");
+        writer.write("cells", std::vector<int>(Nr, 2));
+        writer.close();
+    }
+#endif
+
+    output.write(local(2, Nr));
+    output.close();
+    EXPECT_EQ(3, output.num_cycles());
+
+    // draining with no pending output is a no-op
+    Cycle_Output::drain_all();
+
+#ifdef USE_HDF5
+    if (node == 0)
+    {
+        int num_rows = 0, row_size = 0;
+        Vec_Dbl data = read("cycle_drain.h5", "rows", num_rows, row_size);
+        EXPECT_EQ(3, num_rows);
+        EXPECT_EQ(Nr, row_size);
+        for (int n = 0; n < data.size(); ++n)
+        {
+            EXPECT_SOFTEQ(expected(n / Nr, n % Nr), data[n], 1.0e-12);
+        }
+
+        hid_t file = H5Fopen("cycle_other.h5", H5F_ACC_RDONLY, H5P_DEFAULT);
+        EXPECT_EQ(1, H5LTfind_dataset(file, "cells"));
+        H5Fclose(file);
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------//
+//                 end of tstCycle_Output.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,220 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   MC/mc/test/tstEvent_Transporter.cc
+ * \author Thomas M. Evans
+ * \date   Fri Oct 16 09:12:44 2026
+ * \brief  Event_Transporter unit-test.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Event_Transporter.hh"
+
+#include "gtest/utils_gtest.hh"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "comm/P_Stream.hh"
+#include "../Source_Transporter.hh"
+#include "../Uniform_Source.hh"
+#include "../Box_Shape.hh"
+#include "../Cell_Tally.hh"
+
+#include "TransporterTestBase.hh"
+
+//---------------------------------------------------------------------------//
+// Test fixture
+//---------------------------------------------------------------------------//
+
+class EventTransporterTest : public TransporterTestBase
+{
+    typedef TransporterTestBase Base;
+
+  public:
+    typedef profugus::Source_Transporter<Geometry_t> Transporter_t;
+    typedef profugus::Uniform_Source<Geometry_t>     Uniform_Source_t;
+    typedef profugus::Cell_Tally<Geometry_t>         Cell_Tally_t;
+    typedef Cell_Tally_t::Result                     Result;
+
+  protected:
+    void init_db()
+    {
+        Base::init_db();
+
+        db->set("problem_name", std::string("event"));
+        db->set("Np", 200);
+        db->set("rng_type", std::string("counter"));
+    }
+
+    // Number of batches (cycles) in each run.
+    static constexpr int num_batches = 20;
+
+    // Run a fixed-source problem in batches and return the cell tally
+    // results.
+    Result run(int num_batches = 1)
+    {
+        // make a fresh tallier with a cell tally in every cell
+        auto tallies = std::make_shared<Tallier_t>();
+        tallies->set(geometry, physics);
+
+        auto cells = std::make_shared<Cell_Tally_t>(db, physics);
+        std::vector<int> ids(geometry->num_cells());
+        for (int n = 0; n < ids.size(); ++n)
+            ids[n] = n;
+        cells->set_cells(ids);
+        tallies->add_pathlength_tally(cells);
+        tallies->build();
+
+        // make the transporter
+        Transporter_t solver(db, geometry, physics);
+        solver.set(var_red);
+        solver.set(tallies);
+
+        // make the source over the whole core
+        auto source = std::make_shared<Uniform_Source_t>(
+            db, geometry, physics, rcon);
+        SP_Shape box(std::make_shared<profugus::Box_Shape>(
+                         0.0, 3.78, 0.0, 3.78, 0.0, 14.28));
+
+        // each batch is a cycle with new random number streams
+        double num_particles = 0.0;
+        for (int b = 0; b < num_batches; ++b)
+        {
+            source->build_source(box);
+            solver.assign_source(source);
+
+            tallies->begin_cycle();
+            profugus::pcout << profugus::endl;
+            solver.solve();
+            profugus::pcout << profugus::endl;
+            tallies->end_cycle(source->total_num_to_transport());
+
+            EXPECT_TRUE(source->empty());
+            EXPECT_EQ(source->num_to_transport(), source->num_run());
+
+            num_particles += source->total_num_to_transport();
+        }
+
+        tallies->finalize(num_particles);
+        return cells->results();
+    }
+
+    // Compare tally means and relative errors.
+    void compare(const Result &ref, const Result &test, double err_tol)
+    {
+        EXPECT_EQ(ref.size(), test.size());
+        for (const auto &r : ref)
+        {
+            auto t = test.find(r.first);
+            ASSERT_TRUE(t != test.end());
+            EXPECT_SOFTEQ(r.second.first, t->second.first, 1.0e-10);
+
+            // relative errors
+            ASSERT_GT(r.second.first, 0.0);
+            EXPECT_SOFTEQ(r.second.second / r.second.first,
+                          t->second.second / t->second.first, err_tol);
+        }
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(EventTransporterTest, construction)
+{
+    profugus::Event_Transporter<Geometry_t> transporter(16);
+    EXPECT_EQ(16, transporter.batch_size());
+    EXPECT_EQ(0, transporter.num_sampled_fission_sites());
+
+    db->set("transport_type", std::string("event"));
+    db->set("event_batch_size", 32);
+    Transporter_t solver(db, geometry, physics);
+    EXPECT_TRUE(solver.event_based());
+
+    db->set("transport_type", std::string("history"));
+    Transporter_t history(db, geometry, physics);
+    EXPECT_FALSE(history.event_based());
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(EventTransporterTest, matches_history)
+{
+    // history-based reference with history and batch statistics
+    Result ref = run(num_batches);
+    EXPECT_FALSE(ref.empty());
+
+    db->set("tally_statistics", std::string("batch"));
+    Result batch_ref = run(num_batches);
+
+    // event-based with all particles in flight at once; the trajectories are
+    // the same, so the batch statistics match exactly and agree with the
+    // history statistics to within the uncertainty of the batch estimate
+    db->set("transport_type", std::string("event"));
+    Result events = run(num_batches);
+    compare(batch_ref, events, 1.0e-10);
+    compare(ref, events, 0.5);
+
+    // event-based with a batch much smaller than the number of particles
+    db->set("event_batch_size", 7);
+    events = run(num_batches);
+    compare(batch_ref, events, 1.0e-10);
+    compare(ref, events, 0.5);
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(EventTransporterTest, threaded)
+{
+    db->set("tally_statistics", std::string("batch"));
+    Result ref = run(num_batches);
+
+    db->set("transport_type", std::string("event"));
+    db->set("event_batch_size", 13);
+    db->set("num_threads", 2);
+    compare(ref, run(num_batches), 1.0e-10);
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(EventTransporterTest, batch_statistics)
+{
+    db->set("transport_type", std::string("event"));
+
+    // batch statistics are the default for event-based transport
+    auto cells = std::make_shared<Cell_Tally_t>(db, physics);
+    EXPECT_EQ(profugus::tally::BATCH, cells->statistics());
+
+    // history statistics are rejected
+    db->set("tally_statistics", std::string("history"));
+    EXPECT_THROW(Cell_Tally_t tally(db, physics), profugus::assertion);
+
+    // tallies that need end_history() are rejected by the transporter
+    db->set("transport_type", std::string("history"));
+    auto tallies = std::make_shared<Tallier_t>();
+    tallies->set(geometry, physics);
+    cells = std::make_shared<Cell_Tally_t>(db, physics);
+    cells->set_all_cells();
+    tallies->add_pathlength_tally(cells);
+    tallies->build();
+    EXPECT_EQ(1, tallies->num_history_tallies());
+
+    db->set("transport_type", std::string("event"));
+    Transporter_t solver(db, geometry, physics);
+    solver.set(var_red);
+    solver.set(tallies);
+
+    auto source = std::make_shared<Uniform_Source_t>(
+        db, geometry, physics, rcon);
+    source->build_source(std::make_shared<profugus::Box_Shape>(
+                             0.0, 3.78, 0.0, 3.78, 0.0, 14.28));
+    solver.assign_source(source);
+    EXPECT_THROW(solver.solve(), profugus::assertion);
+}
+
+//---------------------------------------------------------------------------//
+//                 end of tstEvent_Transporter.cc
+//---------------------------------------------------------------------------//
@@ -446,6 +446,54 @@ TEST_F(Fission_RebalanceTest, Multi_Rebalance)
     EXPECT_EQ(26, bank.size());
 }
 
+//---------------------------------------------------------------------------//
+
+TEST_F(Fission_RebalanceTest, All_To_All)
+{
+    rebalance = std::make_shared<Rebalance>(Rebalance::ALL_TO_ALL);
+    EXPECT_EQ(Rebalance::ALL_TO_ALL, rebalance->algorithm());
+
+    // the example in the class documentation
+    setup(1003, 0, 559, 673, 823);
+    rebalance->rebalance(bank);
+
+    if (nodes == 1)
+    {
+        EXPECT_EQ(0, rebalance->num_iterations());
+        EXPECT_EQ(559, bank.size());
+        return;
+    }
+
+    if (nodes != 4) return;
+
+    check(1003);
+    EXPECT_EQ(1, rebalance->num_iterations());
+    EXPECT_EQ(1003, rebalance->num_global_fissions());
+
+    // the sites are in global order on each set
+    const Array_Bnds &tb = rebalance->target_array_bnds();
+    EXPECT_EQ(tb.second - tb.first + 1, bank.size());
+    for (int n = 0; n < bank.size(); ++n)
+    {
+        EXPECT_EQ(tb.first + n, bank[n].m);
+    }
+
+    int sends[]    = {2, 1, 1, 0};
+    int receives[] = {0, 1, 2, 1};
+    int sizes[]    = {251, 251, 251, 250};
+    EXPECT_EQ(sends[node], rebalance->num_sends());
+    EXPECT_EQ(receives[node], rebalance->num_receives());
+    EXPECT_EQ(sizes[node], bank.size());
+    EXPECT_EQ(sizes[node], rebalance->num_fissions());
+
+    // a bank that is empty on some sets
+    setup(10, 0, 0, 0, 10);
+    rebalance->rebalance(bank);
+    check(10);
+    EXPECT_EQ(1, rebalance->num_iterations());
+    EXPECT_EQ(node < 2 ? 3 : 2, bank.size());
+}
+
 //---------------------------------------------------------------------------//
 //                 end of tstFission_Rebalance.cc
 //---------------------------------------------------------------------------//
@@ -11,6 +11,7 @@
 #include <utility>
 #include <algorithm>
 #include <memory>
+#include <cmath>
 
 #include "Teuchos_ParameterList.hpp"
 #include "Teuchos_RCP.hpp"
@@ -224,6 +225,8 @@ TEST_F(FissionTallyTest, multi_cell)
     p.set_matid(geometry->matid(p.geo_state()));
 
     // no tally here
+    // the step crosses into cell 3 at x = 10 after sqrt(3); the remainder is
+    // tallied there
     tally->accumulate(3.0, p);
 
     tally->end_history();
@@ -239,6 +242,9 @@ TEST_F(FissionTallyTest, multi_cell)
     // no tally here
     tally->accumulate(3.0, p);
     tally->accumulate(6.0, p);
+
+    // this step leaves the mesh through the corner at (10, 20) after
+    // 5 sqrt(3); the remainder is not tallied
     tally->accumulate(9.0, p);
 
     geometry->initialize({15.0, 15.0, 1.0}, {1.0, 1.0, 1.0}, p.geo_state());
@@ -286,25 +292,81 @@ TEST_F(FissionTallyTest, multi_cell)
     const auto &r2 = results[2];
     const auto &r3 = results[3];
 
-    // Cells 0 and 3 have no fissionable material
+    // Cell 0 has no fissionable material; cell 3 only has the part of the
+    // step from cell 2 that crosses into it
     EXPECT_SOFTEQ( 0.0, r0.first,  tol );
     EXPECT_SOFTEQ( 0.0, r0.second, tol );
-    EXPECT_SOFTEQ( 0.0, r3.first,  tol );
-    EXPECT_SOFTEQ( 0.0, r3.second, tol );
+
+    const double sqrt3 = std::sqrt(3.0);
+    const double nuf0  = 2.4 * 3.2;
+    const double nuf1  = 2.4 * 4.2;
 
     EXPECT_SOFTEQ(3.840e-3,  r1.first, tol);
-    EXPECT_SOFTEQ(5.456e-2,  r2.first, tol);
+    EXPECT_SOFTEQ(((16.0 + sqrt3) * nuf0 + (9.0 + 5.0 * sqrt3) * nuf1)
+                  / 3.0 / 2000.0, r2.first, tol);
+    EXPECT_SOFTEQ((3.0 - sqrt3) * nuf0 / 3.0 / 2000.0, r3.first, tol);
 
     if( nodes == 1 )
     {
-        EXPECT_SOFTEQ(3.840e-3,          r1.second, tol);
-        EXPECT_SOFTEQ(0.019674796059934, r2.second, tol);
+        EXPECT_SOFTEQ(3.840e-3,              r1.second, tol);
+        EXPECT_SOFTEQ(2.048531402240435e-02, r2.second, tol);
+        EXPECT_SOFTEQ(1.622974966311837e-03, r3.second, tol);
     }
     if( nodes == 4 )
     {
-        EXPECT_SOFTEQ(0.001637381501611, r1.second, tol);
-        EXPECT_SOFTEQ(0.008389361228257, r2.second, tol);
+        EXPECT_SOFTEQ(0.001637381501611,     r1.second, tol);
+        EXPECT_SOFTEQ(8.734967248692476e-03, r2.second, tol);
+        EXPECT_SOFTEQ(6.920388508898128e-04, r3.second, tol);
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(FissionTallyTest, batch)
+{
+    tally = std::make_shared<Fission_Tally>(physics, profugus::tally::BATCH);
+
+    std::vector<double> xy_edges = {0.0, 10.0, 20.0};
+    std::vector<double> z_edges  = {0.0, 20.0};
+    tally->set_mesh(std::make_shared<profugus::Cartesian_Mesh>(
+                        xy_edges, xy_edges, z_edges));
+
+    EXPECT_FALSE(tally->requires_end_history());
+
+    Particle_t p;
+    p.set_wt(1.0);
+    p.set_group(0);
+
+    geometry->initialize({11.0, 1.0, 1.0}, {1.0, 1.0, 1.0}, p.geo_state());
+    EXPECT_EQ(1, geometry->cell(p.geo_state()));
+    p.set_matid(geometry->matid(p.geo_state()));
+
+    // one history per domain in each cycle; the batch means are 1, 2, and 3
+    // times nu-fission (before dividing by the volume)
+    for (int c = 0; c < 3; ++c)
+    {
+        tally->begin_cycle();
+        tally->accumulate(c + 1.0, p);
+        tally->end_cycle(nodes);
     }
+    EXPECT_EQ(3, tally->num_batches());
+
+    // Finalize
+    tally->finalize(3 * nodes);
+
+    const auto &r1   = tally->results()[1];
+    const double nuf0 = 2.4 * 3.2;
+
+    EXPECT_SOFTEQ(2.0 * nuf0 / 2000.0,                  r1.first,  1.0e-12);
+    EXPECT_SOFTEQ(std::sqrt(1.0 / 3.0) * nuf0 / 2000.0, r1.second, 1.0e-12);
+
+    // a fixed-source solve outside of cycles has no batches to estimate the
+    // error from
+    tally->reset();
+    tally->accumulate(2.0, p);
+    tally->accumulate(4.0, p);
+    EXPECT_EQ(0, tally->num_batches());
+    EXPECT_THROW(tally->finalize(2 * nodes), profugus::assertion);
 }
 
 //---------------------------------------------------------------------------//
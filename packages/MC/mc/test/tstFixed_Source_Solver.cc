@@ -17,6 +17,7 @@
 #include "../Box_Shape.hh"
 #include "../Uniform_Source.hh"
 #include "../VR_Roulette.hh"
+#include "../Cell_Tally.hh"
 
 #include "TransporterTestBase.hh"
 
@@ -175,6 +176,30 @@ TEST_F(FixedSourceSolverTest, inf_med)
 #endif
 }
 
+//---------------------------------------------------------------------------//
+
+TEST_F(FixedSourceSolverTest, event_batch_statistics)
+{
+    // event-based transport uses batch statistics, and a fixed-source solve
+    // is a single batch, so the error of a cell tally cannot be estimated
+    db->set("problem_name", std::string("fixed"));
+    db->set("transport_type", std::string("event"));
+
+    auto cells = std::make_shared<profugus::Cell_Tally<Geometry_t>>(
+        db, physics);
+    cells->set_all_cells();
+    EXPECT_EQ(profugus::tally::BATCH, cells->statistics());
+    tallier->add_pathlength_tally(cells);
+
+    transporter = std::make_shared<Transporter_t>(db, geometry, physics);
+    transporter->set(tallier);
+    transporter->set(var_red);
+
+    Solver_t solver;
+    solver.set(transporter, source);
+    EXPECT_THROW(solver.solve(), profugus::assertion);
+}
+
 //---------------------------------------------------------------------------//
 //                 end of tstFixed_Source_Solver.cc
 //---------------------------------------------------------------------------//
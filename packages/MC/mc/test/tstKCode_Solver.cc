@@ -12,6 +12,7 @@
 
 #include "gtest/utils_gtest.hh"
 
+#include <cmath>
 #include <string>
 #include <vector>
 #include <memory>
@@ -25,6 +26,7 @@
 #include "../Tally.hh"
 #include "../Group_Bounds.hh"
 #include "../VR_Roulette.hh"
+#include "../Cell_Tally.hh"
 
 //---------------------------------------------------------------------------//
 // Helpers
@@ -119,6 +121,8 @@ class KCode_SolverTest : public testing::Test
     typedef Solver_t::SP_Fission_Source             SP_Fission_Source;
     typedef Solver_t::SP_Source_Transporter         SP_Transporter;
     typedef std::shared_ptr<Var_Reduction_t>        SP_Var_Reduction;
+    typedef profugus::Cell_Tally<Geometry_t>        Cell_Tally_t;
+    typedef Cell_Tally_t::Result                    Result;
 
   protected:
     void SetUp()
@@ -181,6 +185,93 @@ class KCode_SolverTest : public testing::Test
         geometry = std::make_shared<Geometry_t>(core);
     }
 
+    //! Replace the geometry with a reflected 3x3 c5g7 mini-assembly.
+    void init_lattice()
+    {
+        typedef Geometry_t::SP_Array SP_Core;
+        typedef Geometry_t::Array_t  Core_t;
+        typedef Core_t::SP_Object    SP_Lattice;
+        typedef Core_t::Object_t     Lattice_t;
+        typedef Lattice_t::SP_Object SP_Pin_Cell;
+        typedef Lattice_t::Object_t  Pin_Cell_t;
+
+        // UO2, MOX 4.3%, MOX 7.0% and guide-tube pin cells
+        SP_Pin_Cell uo2(std::make_shared<Pin_Cell_t>(1, 0.54, 8, 1.26, 1.0));
+        SP_Pin_Cell m43(std::make_shared<Pin_Cell_t>(2, 0.54, 8, 1.26, 1.0));
+        SP_Pin_Cell m70(std::make_shared<Pin_Cell_t>(3, 0.54, 8, 1.26, 1.0));
+        SP_Pin_Cell gt(std::make_shared<Pin_Cell_t>(6, 0.54, 8, 1.26, 1.0));
+
+        // make lattice
+        SP_Lattice lat(std::make_shared<Lattice_t>(3, 3, 1, 4));
+        lat->assign_object(uo2, 0);
+        lat->assign_object(m43, 1);
+        lat->assign_object(m70, 2);
+        lat->assign_object(gt,  3);
+
+        // UO2 pins on one side of a guide tube, MOX on the other
+        lat->id(0, 0, 0) = 0;
+        lat->id(1, 0, 0) = 0;
+        lat->id(2, 0, 0) = 1;
+        lat->id(0, 1, 0) = 0;
+        lat->id(1, 1, 0) = 3;
+        lat->id(2, 1, 0) = 2;
+        lat->id(0, 2, 0) = 1;
+        lat->id(1, 2, 0) = 2;
+        lat->id(2, 2, 0) = 2;
+        lat->complete(0.0, 0.0, 0.0);
+
+        // make the reflected core
+        SP_Core core(std::make_shared<Core_t>(1, 1, 1, 1));
+        core->assign_object(lat, 0);
+        core->id(0, 0, 0) = 0;
+
+        Core_t::Vec_Int reflect(6, 1);
+        core->set_reflecting(reflect);
+        core->complete(0.0, 0.0, 0.0);
+
+        geometry = std::make_shared<Geometry_t>(core);
+        physics->set_geometry(geometry);
+
+        // uniform initial source over the lattice
+        OneDArray fs(6, 0.0);
+        fs[1] = 3.78; fs[3] = 3.78; fs[5] = 1.0;
+        db->set("init_fission_src", fs);
+        db->set("problem_name", std::string("c5g7"));
+    }
+
+    //! Solve the eigenvalue problem with a cell tally in every cell; the
+    //! keff mean and variance of the mean are returned in keff.
+    Result solve_cells(std::pair<double, double> &keff)
+    {
+        // make the source transporter and variance reduction
+        transporter = std::make_shared<Transporter_t>(db, geometry, physics);
+        var_reduction = std::make_shared<Var_Reduction_t>(db);
+
+        // make the tallier with a cell tally in every cell
+        auto cells = std::make_shared<Cell_Tally_t>(db, physics);
+        cells->set_all_cells();
+
+        tallier = std::make_shared<Tallier_t>();
+        tallier->set(geometry, physics);
+        tallier->add_pathlength_tally(cells);
+
+        transporter->set(tallier);
+        transporter->set(var_reduction);
+
+        // solve
+        Solver_t solver(db);
+        SP_Fission_Source fsrc(std::make_shared<Fission_Source_t>(
+                                   db, geometry, physics, rcon));
+        solver.set(transporter, fsrc);
+        solver.solve();
+
+        const auto &keff_tally = *solver.keff_tally();
+        keff.first  = keff_tally.mean();
+        keff.second = keff_tally.variance();
+
+        return cells->results();
+    }
+
     //! Set the physics
     void init_physics()
     {
@@ -375,6 +466,58 @@ TEST_F(KCode_SolverTest, active_cycle_test)
     EXPECT_SOFTEQ(17790.0, static_cast<double>(dummytally->pl_counter()), 0.25);
 }
 
+//---------------------------------------------------------------------------//
+
+TEST_F(KCode_SolverTest, c5g7_event_matches_history)
+{
+    init_lattice();
+
+    db->set("Np", 2000);
+    db->set("num_cycles", 30);
+    db->set("num_inactive_cycles", 10);
+    db->set("tally_statistics", std::string("batch"));
+
+    // history-based reference
+    std::pair<double, double> k_history;
+    Result history = solve_cells(k_history);
+
+    // event-based transport
+    db->set("transport_type", std::string("event"));
+    db->set("event_batch_size", 256);
+
+    std::pair<double, double> k_event;
+    Result event = solve_cells(k_event);
+
+    profugus::pcout << "History keff = " << profugus::fixed
+                    << k_history.first << " +/- "
+                    << std::sqrt(k_history.second) << profugus::endl;
+    profugus::pcout << "Event   keff = " << profugus::fixed
+                    << k_event.first << " +/- "
+                    << std::sqrt(k_event.second) << profugus::endl;
+
+    // keff agrees within statistics
+    EXPECT_GT(k_history.second, 0.0);
+    EXPECT_GT(k_event.second, 0.0);
+    EXPECT_LT(std::fabs(k_history.first - k_event.first),
+              4.0 * std::sqrt(k_history.second + k_event.second));
+
+    // the cell tally means agree within statistics
+    EXPECT_FALSE(history.empty());
+    EXPECT_EQ(history.size(), event.size());
+    for (const auto &h : history)
+    {
+        auto e = event.find(h.first);
+        ASSERT_TRUE(e != event.end());
+        ASSERT_GT(h.second.second, 0.0);
+        ASSERT_GT(e->second.second, 0.0);
+
+        double sigma = std::sqrt(h.second.second * h.second.second +
+                                 e->second.second * e->second.second);
+        EXPECT_LT(std::fabs(h.second.first - e->second.first), 4.0 * sigma)
+            << "cell " << h.first;
+    }
+}
+
 //---------------------------------------------------------------------------//
 //                 end of tstKCode_Solver.cc
 //---------------------------------------------------------------------------//
@@ -11,6 +11,7 @@
 #include <utility>
 #include <algorithm>
 #include <memory>
+#include <cmath>
 
 #include "Teuchos_ParameterList.hpp"
 #include "Teuchos_RCP.hpp"
@@ -224,6 +225,8 @@ TEST_F(MeshTallyTest, multi_cell)
     p.set_matid(geometry->matid(p.geo_state()));
 
     // no tally here
+    // the step crosses into cell 3 at x = 10 after sqrt(3); the remainder is
+    // tallied there
     tally->accumulate(3.0, p);
 
     tally->end_history();
@@ -239,6 +242,9 @@ TEST_F(MeshTallyTest, multi_cell)
     // no tally here
     tally->accumulate(3.0, p);
     tally->accumulate(6.0, p);
+
+    // this step leaves the mesh through the corner at (10, 20) after
+    // 5 sqrt(3); the remainder is not tallied
     tally->accumulate(9.0, p);
 
     geometry->initialize({15.0, 15.0, 1.0}, {1.0, 1.0, 1.0}, p.geo_state());
@@ -288,22 +294,126 @@ TEST_F(MeshTallyTest, multi_cell)
 
     EXPECT_SOFTEQ(3.0 / 3.0 / 2000.0,  r0.first, tol);
     EXPECT_SOFTEQ(3.0 / 3.0 / 2000.0,  r1.first, tol);
-    EXPECT_SOFTEQ(37.0 / 3.0 / 2000.0, r2.first, tol);
-    EXPECT_SOFTEQ(17.0 / 3.0 / 2000.0, r3.first, tol);
+    const double sqrt3 = std::sqrt(3.0);
+    EXPECT_SOFTEQ((25.0 + 6.0 * sqrt3) / 3.0 / 2000.0, r2.first, tol);
+    EXPECT_SOFTEQ((20.0 - sqrt3) / 3.0 / 2000.0,       r3.first, tol);
 
     if( nodes == 1 )
     {
         EXPECT_SOFTEQ(5.0e-4,                r0.second, tol);
         EXPECT_SOFTEQ(5.0e-4,                r1.second, tol);
-        EXPECT_SOFTEQ(0.001740051084818,     r2.second, tol);
-        EXPECT_SOFTEQ(7.264831572567789e-04, r3.second, tol);
+        EXPECT_SOFTEQ(1.890088880586386e-03, r2.second, tol);
+        EXPECT_SOFTEQ(7.795234360923102e-04, r3.second, tol);
     }
     if( nodes == 4 )
     {
         EXPECT_SOFTEQ(2.132007163556105e-04, r0.second, tol);
         EXPECT_SOFTEQ(2.132007163556105e-04, r1.second, tol);
-        EXPECT_SOFTEQ(7.419602755572905e-04, r2.second, tol);
-        EXPECT_SOFTEQ(3.097734590948617e-04, r3.second, tol);
+        EXPECT_SOFTEQ(8.059366066335828e-04, r2.second, tol);
+        EXPECT_SOFTEQ(3.323899099817349e-04, r3.second, tol);
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(MeshTallyTest, batch)
+{
+    db->set("tally_statistics", std::string("batch"));
+    tally = std::make_shared<Mesh_Tally>(db, physics);
+
+    std::vector<double> xy_edges = {0.0, 10.0, 20.0};
+    std::vector<double> z_edges  = {0.0, 20.0};
+    tally->set_mesh(std::make_shared<profugus::Cartesian_Mesh>(
+                        xy_edges, xy_edges, z_edges));
+
+    EXPECT_EQ(profugus::tally::BATCH, tally->statistics());
+    EXPECT_FALSE(tally->requires_end_history());
+
+    Particle_t p;
+    p.set_wt(1.0);
+    p.set_group(0);
+
+    geometry->initialize({1.0, 1.0, 1.0}, {1.0, 1.0, 1.0}, p.geo_state());
+    EXPECT_EQ(0, geometry->cell(p.geo_state()));
+    p.set_matid(geometry->matid(p.geo_state()));
+
+    // one history per domain in each cycle; the steps stay in cell 0 and
+    // the batch means are 1, 2, and 3 (before dividing by the volume)
+    for (int c = 0; c < 3; ++c)
+    {
+        tally->begin_cycle();
+        tally->accumulate(c + 1.0, p);
+        tally->end_cycle(nodes);
+    }
+    EXPECT_EQ(3, tally->num_batches());
+
+    // Finalize
+    tally->finalize(3 * nodes);
+
+    // Get the results
+    auto results = tally->results();
+
+    EXPECT_EQ(4, results.size());
+
+    EXPECT_SOFTEQ(2.0 / 2000.0,                 results[0].first,  1.0e-12);
+    EXPECT_SOFTEQ(std::sqrt(1.0 / 3.0) / 2000.0, results[0].second, 1.0e-12);
+
+    for (int cell = 1; cell < 4; ++cell)
+    {
+        EXPECT_EQ(0.0, results[cell].first);
+        EXPECT_EQ(0.0, results[cell].second);
+    }
+
+    // a fixed-source solve outside of cycles has no batches to estimate the
+    // error from
+    tally->reset();
+    tally->accumulate(2.0, p);
+    tally->accumulate(4.0, p);
+    EXPECT_EQ(0, tally->num_batches());
+    EXPECT_THROW(tally->finalize(2 * nodes), profugus::assertion);
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(MeshTallyTest, response_bins)
+{
+    // the group-wise nu-fission rate in each mesh cell
+    profugus::Response_Bins bins(3);
+    bins.set({0, 1, 2}, {profugus::physics::NU_FISSION});
+    tally->set_bins(bins);
+    EXPECT_EQ(3, tally->bins().size());
+    EXPECT_EQ(4 * 3, tally->results().size());
+
+    Particle_t p;
+    p.set_wt(1.0);
+
+    // steps in group 0 and 1 that stay in cell 1 (mat 1)
+    geometry->initialize({11.0, 1.0, 1.0}, {1.0, 1.0, 1.0}, p.geo_state());
+    EXPECT_EQ(1, geometry->cell(p.geo_state()));
+    p.set_matid(geometry->matid(p.geo_state()));
+
+    p.set_group(0);
+    tally->accumulate(1.0, p);
+    p.set_group(1);
+    tally->accumulate(2.0, p);
+    tally->end_history();
+
+    // second history with no score
+    tally->end_history();
+
+    tally->finalize(2 * nodes);
+
+    // results are [cell][group]
+    const auto &results = tally->results();
+    EXPECT_SOFTEQ(0.5 * 2.4 * 3.2 / 2000.0, results[3].first, 1.0e-12);
+    EXPECT_SOFTEQ(2.4 * 4.2 / 2000.0,       results[4].first, 1.0e-12);
+
+    for (int i = 0; i < results.size(); ++i)
+    {
+        if (i < 3 || i > 4)
+        {
+            EXPECT_EQ(0.0, results[i].first);
+        }
     }
 }
 
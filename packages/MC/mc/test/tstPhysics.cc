@@ -511,6 +511,7 @@ TYPED_TEST(PhysicsTest, Access)
 
     using profugus::physics::TOTAL;
     using profugus::physics::SCATTERING;
+    using profugus::physics::ABSORPTION;
     using profugus::physics::FISSION;
 
     // make a particle
@@ -530,6 +531,7 @@ TYPED_TEST(PhysicsTest, Access)
         p->set_group(0);
         EXPECT_SOFTEQ(5.2, physics.total(TOTAL, *p), 1.e-12);
         EXPECT_SOFTEQ(2.6, physics.total(SCATTERING, *p), 1.e-12);
+        EXPECT_SOFTEQ(2.6, physics.total(ABSORPTION, *p), 1.e-12);
         EXPECT_SOFTEQ(0.0, physics.total(FISSION, *p), 1.e-12);
 
         p->set_group(1);
@@ -587,6 +589,103 @@ TYPED_TEST(PhysicsTest, Access)
 
 //---------------------------------------------------------------------------//
 
+TYPED_TEST(PhysicsTest, sparse_matids)
+{
+    typedef typename TestFixture::Particle  Particle;
+    typedef typename TestFixture::Physics_t Physics_t;
+    typedef typename TestFixture::XS_t      XS_t;
+    typedef typename TestFixture::RCP_XS    RCP_XS;
+
+    using profugus::physics::TOTAL;
+    using profugus::physics::SCATTERING;
+    using profugus::physics::NU_FISSION;
+
+    // make a database with non-contiguous matids
+    RCP_XS xs = Teuchos::rcp(new XS_t());
+    xs->set(0, 2);
+
+    vector<double> bnd = {100.0, 1.0, 0.01};
+    xs->set_bounds(bnd);
+
+    typename XS_t::OneDArray total(2), chi(2), nus(2);
+    typename XS_t::TwoDArray scat(2, 2);
+
+    total[0] = 1.0; total[1] = 2.0;
+    scat(0, 0) = 0.5; scat(1, 0) = 0.3; scat(1, 1) = 1.5;
+    xs->add(12, XS_t::TOTAL, total);
+    xs->add(12, 0, scat);
+
+    total[0] = 3.0; total[1] = 4.0;
+    chi[0] = 1.0;
+    nus[0] = 0.2; nus[1] = 0.6;
+    xs->add(5, XS_t::TOTAL, total);
+    xs->add(5, 0, scat);
+    xs->add(5, XS_t::CHI, chi);
+    xs->add(5, XS_t::NU_SIG_F, nus);
+
+    xs->complete();
+
+    Physics_t physics(this->db, xs);
+    EXPECT_TRUE(physics.is_fissionable(5));
+    EXPECT_FALSE(physics.is_fissionable(12));
+
+    Particle p;
+    p.set_matid(12);
+    p.set_group(0);
+    EXPECT_SOFTEQ(1.0, physics.total(TOTAL, p), 1.e-12);
+    EXPECT_SOFTEQ(0.8, physics.total(SCATTERING, p), 1.e-12);
+    EXPECT_SOFTEQ(0.0, physics.total(NU_FISSION, p), 1.e-12);
+
+    p.set_matid(5);
+    p.set_group(1);
+    EXPECT_SOFTEQ(4.0, physics.total(TOTAL, p), 1.e-12);
+    EXPECT_SOFTEQ(1.5, physics.total(SCATTERING, p), 1.e-12);
+    EXPECT_SOFTEQ(0.6, physics.total(NU_FISSION, p), 1.e-12);
+
+    // all fission neutrons are born in group 0
+    p.set_rng(this->rng);
+    p.set_group(1);
+    EXPECT_TRUE(physics.initialize_fission(5, p));
+    EXPECT_EQ(0, p.group());
+    EXPECT_FALSE(physics.initialize_fission(12, p));
+}
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(PhysicsTest, guided_group_sampling)
+{
+    typedef typename TestFixture::Particle  Particle;
+    typedef typename TestFixture::Physics_t Physics_t;
+
+    Physics_t physics(this->db, this->xs);
+
+    // the same stream is used for the physics samples and the reference
+    // linear search
+    profugus::RNG_Control control(2391);
+    Particle p;
+    p.set_rng(control.rng(4));
+    auto ref = control.rng(4);
+
+    double chi[5] = {0.3770, 0.4421, 0.1809, 0.0, 0.0};
+
+    for (int n = 0; n < 1000; ++n)
+    {
+        EXPECT_TRUE(physics.initialize_fission(1, p));
+
+        double rnd = ref.ran(), cdf = 0.0;
+        int    g   = 0;
+        for (; g < 5; ++g)
+        {
+            cdf += chi[g];
+            if (rnd <= cdf)
+                break;
+        }
+        EXPECT_EQ(g, p.group());
+    }
+}
+
+//---------------------------------------------------------------------------//
+
 TYPED_TEST(PhysicsTest, initialization)
 {
     typedef typename TestFixture::Particle      Particle;
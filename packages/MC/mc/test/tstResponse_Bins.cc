@@ -0,0 +1,112 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   MC/mc/test/tstResponse_Bins.cc
+ * \author Thomas M. Evans
+ * \date   Fri Oct 16 09:12:44 2026
+ * \brief  Response_Bins unit test.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Response_Bins.hh"
+
+#include "gtest/utils_gtest.hh"
+
+using profugus::Response_Bins;
+namespace physics = profugus::physics;
+
+//---------------------------------------------------------------------------//
+// Helpers
+//---------------------------------------------------------------------------//
+
+// Minimal particle and physics for evaluating responses.
+struct Mock_Particle
+{
+    int g;
+    int group() const { return g; }
+};
+
+struct Mock_Physics
+{
+    double total(physics::Reaction_Type type, const Mock_Particle &p)
+    {
+        return 10.0 * type + p.g;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(ResponseBins, defaults)
+{
+    Response_Bins bins(4);
+
+    EXPECT_EQ(4, bins.num_groups());
+    EXPECT_EQ(1, bins.num_group_bins());
+    EXPECT_EQ(1, bins.num_responses());
+    EXPECT_EQ(1, bins.size());
+    EXPECT_EQ(physics::FLUX, bins.responses()[0]);
+
+    for (int g = 0; g < 4; ++g)
+    {
+        EXPECT_EQ(0, bins.group_bin(g));
+        EXPECT_EQ(0, bins.offset(Mock_Particle{g}));
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(ResponseBins, set)
+{
+    Response_Bins bins(5);
+    bins.set({0, 2, 3}, {physics::FLUX, physics::NU_FISSION});
+
+    EXPECT_EQ(3, bins.num_group_bins());
+    EXPECT_EQ(2, bins.num_responses());
+    EXPECT_EQ(6, bins.size());
+
+    int ref[] = {0, 0, 1, 2, 2};
+    for (int g = 0; g < 5; ++g)
+    {
+        EXPECT_EQ(ref[g], bins.group_bin(g));
+        EXPECT_EQ(2 * ref[g], bins.offset(Mock_Particle{g}));
+    }
+
+    // flux is 1, other responses come from the physics
+    Mock_Physics physics;
+    double values[2] = {0.0, 0.0};
+    bins.evaluate(physics, Mock_Particle{3}, values);
+    EXPECT_EQ(1.0, values[0]);
+    EXPECT_EQ(10.0 * physics::NU_FISSION + 3, values[1]);
+
+    // bad bins
+    EXPECT_THROW(bins.set({}, {physics::FLUX}), profugus::assertion);
+    EXPECT_THROW(bins.set({0}, {}), profugus::assertion);
+    EXPECT_THROW(bins.set({1, 2}, {physics::FLUX}), profugus::assertion);
+    EXPECT_THROW(bins.set({0, 2, 2}, {physics::FLUX}), profugus::assertion);
+    EXPECT_THROW(bins.set({0, 5}, {physics::FLUX}), profugus::assertion);
+    EXPECT_THROW(bins.set({0}, {physics::END_REACTION_TYPE}),
+                 profugus::assertion);
+
+    // the bins are unchanged
+    EXPECT_EQ(6, bins.size());
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(ResponseBins, names)
+{
+    EXPECT_EQ(physics::FLUX,       Response_Bins::response("flux"));
+    EXPECT_EQ(physics::TOTAL,      Response_Bins::response("total"));
+    EXPECT_EQ(physics::ABSORPTION, Response_Bins::response("absorption"));
+    EXPECT_EQ(physics::SCATTERING, Response_Bins::response("scattering"));
+    EXPECT_EQ(physics::FISSION,    Response_Bins::response("fission"));
+    EXPECT_EQ(physics::NU_FISSION, Response_Bins::response("nu_fission"));
+
+    EXPECT_THROW(Response_Bins::response("heating"), profugus::assertion);
+}
+
+//---------------------------------------------------------------------------//
+// end of MC/mc/test/tstResponse_Bins.cc
+//---------------------------------------------------------------------------//
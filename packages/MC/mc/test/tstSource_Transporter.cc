@@ -14,10 +14,15 @@
 
 #include <cmath>
 #include <memory>
+#include <string>
+#include <vector>
 
+#include "comm/OMP.hh"
 #include "comm/P_Stream.hh"
 #include "comm/global.hh"
 #include "utils/Definitions.hh"
+#include "../Fission_Source.hh"
+#include "../Keff_Tally.hh"
 
 #include "TransporterTestBase.hh"
 
@@ -39,6 +44,51 @@ class DRSourceTransporterTest : public TransporterTestBase
         // no tallies have been added
         tallier->build();
     }
+
+    // Run k-code cycles and return the keff estimate of each cycle.
+    std::vector<double> kcode(int num_threads, const std::string &type)
+    {
+        typedef profugus::Keff_Tally<Geometry_t>     Keff_Tally_t;
+        typedef profugus::Fission_Source<Geometry_t> Fission_Source_t;
+
+        db->set("num_threads", num_threads);
+        db->set("transport_type", type);
+        db->set("event_batch_size", 17);
+        db->set("rng_type", std::string("counter"));
+        db->set("Np", 300);
+
+        // keff tally
+        auto keff    = std::make_shared<Keff_Tally_t>(1.0, physics);
+        auto tallies = std::make_shared<Tallier_t>();
+        tallies->set(geometry, physics);
+        tallies->add_pathlength_tally(keff);
+        tallies->build();
+
+        Transporter_t solver(db, geometry, physics);
+        solver.set(var_red);
+        solver.set(tallies);
+
+        // fission source with the same random number seed for every run
+        auto source = std::make_shared<Fission_Source_t>(
+            db, geometry, physics,
+            std::make_shared<RNG_Control_t>(349832));
+        auto fission_sites = source->create_fission_site_container();
+        source->build_initial_source();
+
+        for (int cycle = 0; cycle < 5; ++cycle)
+        {
+            solver.sample_fission_sites(fission_sites, keff->latest());
+            solver.assign_source(source);
+
+            tallies->begin_cycle();
+            solver.solve();
+            tallies->end_cycle(source->total_num_to_transport());
+
+            source->build_source(fission_sites);
+        }
+
+        return keff->all_keff();
+    }
 };
 
 //---------------------------------------------------------------------------//
@@ -185,6 +235,64 @@ TEST_F(DRSourceTransporterTest, Heuristic)
     profugus::pcout << profugus::endl;
 }
 
+//---------------------------------------------------------------------------//
+
+TEST_F(DRSourceTransporterTest, Threaded)
+{
+    db->set("mc_diag_frac", 0.2);
+    db->set("num_threads", 2);
+
+    // make the fixed source Transporter_t
+    Transporter_t solver(db, geometry, physics);
+
+    if (profugus::multithreading_available())
+    {
+        EXPECT_EQ(2, solver.num_threads());
+    }
+    else
+    {
+        EXPECT_EQ(1, solver.num_threads());
+    }
+
+    // set the variance reduction
+    solver.set(var_red);
+
+    // set the tally
+    solver.set(tallier);
+    EXPECT_EQ(solver.num_threads(), tallier->num_threads());
+
+    // make the source
+    std::shared_ptr<DR_Source> source(std::make_shared<DR_Source>(
+                                          geometry, physics, rcon));
+    source->set_Np(50);
+
+    // assign the source
+    solver.assign_source(source);
+
+    // solve
+    profugus::pcout << profugus::endl;
+    solver.solve();
+    profugus::pcout << profugus::endl;
+
+    EXPECT_TRUE(source->empty());
+    EXPECT_EQ(50, source->num_run());
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(DRSourceTransporterTest, Reproducible_Keff)
+{
+    // history-based reference on 1 thread
+    std::vector<double> ref = kcode(1, "history");
+    EXPECT_EQ(5, ref.size());
+
+    // keff is bitwise identical on any number of threads and with either
+    // transporter
+    EXPECT_EQ(ref, kcode(4, "history"));
+    EXPECT_EQ(ref, kcode(1, "event"));
+    EXPECT_EQ(ref, kcode(3, "event"));
+}
+
 //---------------------------------------------------------------------------//
 //                 end of tstSource_Transporter.cc
 //---------------------------------------------------------------------------//
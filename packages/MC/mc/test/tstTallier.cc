@@ -157,6 +157,35 @@ class C_Tally : public profugus::Compound_Tally<Geometry>
     }
 };
 
+//---------------------------------------------------------------------------//
+
+template <class Geometry>
+class X_Tally : public profugus::Collision_Tally<Geometry>
+{
+    typedef profugus::Collision_Tally<Geometry> Base;
+    typedef profugus::Physics<Geometry>         Physics_t;
+    typedef std::shared_ptr<Physics_t>          SP_Physics;
+    typedef typename Physics_t::Particle_t      Particle_t;
+
+  public:
+    X_Tally(SP_Physics physics)
+        : Base(physics, true)
+        , num_collisions(0)
+        , weight(0.0)
+    {
+        this->set_name("x_col_tally");
+    }
+
+    void collision(const Particle_t &p)
+    {
+        ++num_collisions;
+        weight += p.wt();
+    }
+
+    int    num_collisions;
+    double weight;
+};
+
 //---------------------------------------------------------------------------//
 // Test fixture
 //---------------------------------------------------------------------------//
@@ -760,6 +789,71 @@ TYPED_TEST(TallierTest, add)
     EXPECT_EQ(1, tallier.num_compound_tallies());
 }
 
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(TallierTest, dispatch)
+{
+    typedef typename TestFixture::Tallier_t     Tallier_t;
+    typedef typename TestFixture::Geometry_t    Geometry_t;
+    typedef typename TestFixture::Keff_Tally_t  Keff_Tally_t;
+    typedef typename TestFixture::Particle_t    Particle_t;
+
+    Tallier_t tallier, inactive_tallier;
+    tallier.set(this->geometry, this->physics);
+    inactive_tallier.set(this->geometry, this->physics);
+
+    auto keff(std::make_shared<Keff_Tally_t>(1.0, this->physics));
+    auto x(std::make_shared<X_Tally<Geometry_t> >(this->physics));
+
+    // keff only in the inactive tallier
+    inactive_tallier.add_pathlength_tally(keff);
+    inactive_tallier.build();
+
+    // keff, another pathlength tally, and a collision tally
+    tallier.add_pathlength_tally(keff);
+    tallier.add_pathlength_tally(
+        std::make_shared<A_Tally<Geometry_t> >(this->physics));
+    tallier.add_collision_tally(x);
+    tallier.add_collision_tally(x);
+
+    EXPECT_EQ(2, tallier.num_collision_tallies());
+    tallier.build();
+    EXPECT_EQ(3, tallier.num_tallies());
+    EXPECT_EQ(2, tallier.num_pathlength_tallies());
+    EXPECT_EQ(1, tallier.num_collision_tallies());
+
+    Particle_t p;
+    p.set_wt(0.5);
+    p.set_matid(1);
+    p.set_group(1);
+
+    // the keff tally is scored through either dispatch path
+    inactive_tallier.begin_cycle();
+    inactive_tallier.path_length(1.0, p);
+    inactive_tallier.collision(p);
+    EXPECT_SOFTEQ(0.5 * 2.4 * 4.2, keff->latest(), 1.0e-12);
+
+    tallier.path_length(1.0, p);
+    EXPECT_SOFTEQ(2.0 * 0.5 * 2.4 * 4.2, keff->latest(), 1.0e-12);
+
+    tallier.collision(p);
+    p.set_wt(0.25);
+    tallier.collision(p);
+    EXPECT_EQ(2, x->num_collisions);
+    EXPECT_SOFTEQ(0.75, x->weight, 1.0e-12);
+
+    // the dispatch tables follow the tallies when swapped
+    swap(tallier, inactive_tallier);
+    tallier.collision(p);
+    EXPECT_EQ(2, x->num_collisions);
+    inactive_tallier.collision(p);
+    EXPECT_EQ(3, x->num_collisions);
+
+    tallier.path_length(2.0, p);
+    EXPECT_SOFTEQ(2.0 * 0.5 * 2.4 * 4.2 + 0.5 * 2.4 * 4.2, keff->latest(),
+                  1.0e-12);
+}
+
 //---------------------------------------------------------------------------//
 //                 end of tstTallier.cc
 //---------------------------------------------------------------------------//
@@ -151,6 +151,83 @@ TEST_F(UniformSourceTest, build_and_run)
     EXPECT_EQ(source.num_to_transport(), ctr);
 }
 
+//---------------------------------------------------------------------------//
+
+TEST_F(UniformSourceTest, counter_rng)
+{
+    b_db->set("Np", 48);
+    b_db->set("rng_type", std::string("counter"));
+
+    // make two uniform sources
+    Source source_a(b_db, b_geometry, b_physics, b_rcon);
+    Source source_b(b_db, b_geometry, b_physics, b_rcon);
+    EXPECT_TRUE(source_a.counter_rng());
+
+    // make a sampling shape (uniform)
+    SP_Shape box(std::make_shared<profugus::Box_Shape>(
+                     0.0, 2.52, 0.0, 2.52, 0.0, 14.28));
+
+    // build the sources; the second source advances the SPRNG stream index,
+    // which does not change the counter-based streams
+    source_a.build_source(box);
+    source_b.build_source(box);
+
+    // every history gets the same, independent stream from both sources
+    while (!source_a.empty())
+    {
+        SP_Particle a = source_a.get_particle();
+        SP_Particle b = source_b.get_particle();
+
+        EXPECT_TRUE(a->rng().counter_based());
+
+        const auto &ra = a->geo_state().d_r;
+        const auto &rb = b->geo_state().d_r;
+        EXPECT_EQ(ra[0], rb[0]);
+        EXPECT_EQ(ra[1], rb[1]);
+        EXPECT_EQ(ra[2], rb[2]);
+        EXPECT_EQ(a->group(), b->group());
+        EXPECT_EQ(a->rng().ran(), b->rng().ran());
+    }
+    EXPECT_TRUE(source_b.empty());
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(UniformSourceTest, emit_in_place)
+{
+    b_db->set("Np", 48);
+    b_db->set("rng_type", std::string("counter"));
+
+    // make two uniform sources
+    Source source_a(b_db, b_geometry, b_physics, b_rcon);
+    Source source_b(b_db, b_geometry, b_physics, b_rcon);
+
+    SP_Shape box(std::make_shared<profugus::Box_Shape>(
+                     0.0, 2.52, 0.0, 2.52, 0.0, 14.28));
+    source_a.build_source(box);
+    source_b.build_source(box);
+
+    // a single particle is reused for every emission from the first source
+    Source::Particle_t p;
+
+    while (!source_a.empty())
+    {
+        source_a.emit_particle(p);
+        SP_Particle b = source_b.get_particle();
+
+        EXPECT_TRUE(p.alive());
+        EXPECT_EQ(b->wt(), p.wt());
+        EXPECT_EQ(b->matid(), p.matid());
+        EXPECT_EQ(b->group(), p.group());
+        EXPECT_EQ(b->geo_state().d_r[2], p.geo_state().d_r[2]);
+        EXPECT_EQ(b->rng().ran(), p.rng().ran());
+
+        p.kill();
+    }
+    EXPECT_TRUE(source_b.empty());
+    EXPECT_EQ(source_a.num_to_transport(), source_a.num_run());
+}
+
 //---------------------------------------------------------------------------//
 //                 end of tstUniform_Source.cc
 //---------------------------------------------------------------------------//
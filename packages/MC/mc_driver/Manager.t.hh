@@ -22,6 +22,7 @@
 #include "utils/Serial_HDF5_Writer.hh"
 #include "utils/Parallel_HDF5_Writer.hh"
 #include "solvers/LinAlgTypedefs.hh"
+#include "mc/Cycle_Output.hh"
 #include "mc/Fission_Source.hh"
 #include "mc/KDE_Fission_Source.hh"
 #include "mc/Uniform_Source.hh"
@@ -305,7 +306,8 @@ void Manager<Geometry>::output()
         auto keff = d_keff_solver->keff_tally();
         CHECK(keff);
 
-        // make the hdf5 file
+        // make the hdf5 file after any cycle output is written
+        profugus::Cycle_Output::drain_all();
         profugus::Serial_HDF5_Writer writer;
         writer.open(outfile);
 
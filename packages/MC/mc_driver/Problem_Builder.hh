@@ -139,6 +139,10 @@ class Problem_Builder
     void build_tallies();
     void build_spn_problem();
 
+    // Set group bins and responses on a tally.
+    template<class Tally_T>
+    void set_response_bins(const ParameterList &tally_db, Tally_T &tally);
+
     RCP_ParameterList d_matdb;
 };
 
@@ -382,19 +382,30 @@ void Problem_Builder<Geometry>::build_tallies()
         // get the database
         const ParameterList &sdb = d_db->sublist("cell_tally_db");
 
-        // validate that cells are listed
-        VALIDATE(sdb.isParameter("cells"),
-                 "Failed to define cells for cell tally.");
-
-        // get the list of cells
-        auto cells = sdb.get<OneDArray_int>("cells").toVector();
-
         // build the tally
         auto cell_tally = std::make_shared<Cell_Tally_t>(d_db,d_physics);
         CHECK(cell_tally);
 
-        // set it
-        cell_tally->set_cells(cells);
+        // tally all cells or the listed cells
+        if (sdb.isParameter("all_cells") && sdb.get<bool>("all_cells"))
+        {
+            cell_tally->set_all_cells();
+        }
+        else
+        {
+            // validate that cells are listed
+            VALIDATE(sdb.isParameter("cells"),
+                     "Failed to define cells for cell tally.");
+
+            // get the list of cells
+            auto cells = sdb.get<OneDArray_int>("cells").toVector();
+
+            // set it
+            cell_tally->set_cells(cells);
+        }
+
+        // set the group bins and responses
+        set_response_bins(sdb, *cell_tally);
 
         // add this to the tallier
         d_tallier->add_pathlength_tally(cell_tally);
@@ -428,6 +439,9 @@ void Problem_Builder<Geometry>::build_tallies()
             x_edges,y_edges,z_edges);
         mesh_tally->set_mesh(mesh);
 
+        // set the group bins and responses
+        set_response_bins(sdb, *mesh_tally);
+
         // add this to the tallier
         d_tallier->add_pathlength_tally(mesh_tally);
     }
@@ -463,6 +477,52 @@ void Problem_Builder<Geometry>::build_tallies()
     ENSURE(d_tallier);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Set group bins and responses on a tally.
+ *
+ * The optional \c group_bins entry lists the first group of each group bin,
+ * and the optional \c responses entry lists the response names (see
+ * profugus::Response_Bins).  The defaults are a single group bin and the
+ * flux response.
+ */
+template <class Geometry>
+template <class Tally_T>
+void Problem_Builder<Geometry>::set_response_bins(
+    const ParameterList &tally_db,
+    Tally_T             &tally)
+{
+    if (!tally_db.isParameter("group_bins") &&
+        !tally_db.isParameter("responses"))
+        return;
+
+    profugus::Response_Bins bins(d_physics->num_groups());
+
+    // group bins
+    auto first_groups = bins.first_groups();
+    if (tally_db.isParameter("group_bins"))
+    {
+        first_groups = tally_db.get<OneDArray_int>("group_bins").toVector();
+    }
+
+    // responses
+    auto responses = bins.responses();
+    if (tally_db.isParameter("responses"))
+    {
+        const auto &names = tally_db.get<OneDArray_str>("responses");
+
+        responses.clear();
+        for (const auto &name : names)
+        {
+            responses.push_back(profugus::Response_Bins::response(
+                                    profugus::lower(name)));
+        }
+    }
+
+    bins.set(first_groups, responses);
+    tally.set_bins(bins);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \build the SPN problem
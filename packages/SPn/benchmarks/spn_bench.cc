@@ -0,0 +1,309 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/benchmarks/spn_bench.cc
+ * \author Thomas M. Evans
+ * \date   Fri Oct 16 09:12:44 2026
+ * \brief  SPn matrix-assembly benchmark executable.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+
+#include "harness/DBC.hh"
+#include "comm/global.hh"
+#include "comm/P_Stream.hh"
+#include "comm/Timer.hh"
+#include "utils/Definitions.hh"
+#include "solvers/LinAlgTypedefs.hh"
+#include "spn/Dimensions.hh"
+#include "spn/Linear_System_FV.hh"
+#include "spn_driver/Problem_Builder.hh"
+
+//---------------------------------------------------------------------------//
+// TYPES
+//---------------------------------------------------------------------------//
+
+typedef profugus::Linear_System_FV<profugus::EpetraTypes> Linear_System_t;
+typedef Teuchos::RCP<Linear_System_t>                     RCP_Linear_System;
+
+// Parallel specs.
+int node  = 0;
+int nodes = 0;
+
+//---------------------------------------------------------------------------//
+// Benchmark options
+
+struct Options
+{
+    // Problem inputs.
+    def::Vec_String problems;
+
+    // JSON output file (stdout if empty).
+    std::string output;
+
+    // Number of timed repetitions of each phase.
+    int repetitions = 3;
+
+    // Number of assembly threads.
+    int threads = 1;
+};
+
+//---------------------------------------------------------------------------//
+// Timing of one assembly phase
+
+struct Result
+{
+    std::string problem;
+    int         threads;
+    std::string name;
+    double      count;
+    double      seconds;
+
+    //! Rows (cell-equations) assembled per second.
+    double rate() const { return seconds > 0.0 ? count / seconds : 0.0; }
+};
+
+//---------------------------------------------------------------------------//
+// Print instructions on how to run the benchmark executable
+
+void print_usage()
+{
+    if (node == 0)
+    {
+        std::cout << "Usage: xspn_bench [-i XMLFILE]... [-o JSONFILE] "
+                  << "[-r REPETITIONS] [-t THREADS]\n"
+                  << "  -i   SPn problem input\n"
+                  << "  -o   JSON results file (default stdout)\n"
+                  << "  -r   timed repetitions of each phase (default 3)\n"
+                  << "  -t   assembly threads on each domain (default 1)"
+                  << std::endl;
+    }
+    profugus::finalize();
+    exit(1);
+}
+
+//---------------------------------------------------------------------------//
+// Parse the input arguments
+
+Options parse_input_arguments(const def::Vec_String &arguments)
+{
+    Options opts;
+
+    for (int n = 0, N = arguments.size(); n < N; ++n)
+    {
+        const std::string &arg = arguments[n];
+
+        if (arg == "-h" || arg == "--help")
+            print_usage();
+
+        // all remaining options take a value
+        if (n + 1 == N || arguments[n + 1].empty())
+        {
+            if (node == 0)
+            {
+                std::cout << std::endl << "ERROR: Missing value for "
+                          << arg << "." << std::endl << std::endl;
+            }
+            print_usage();
+        }
+        const std::string &value = arguments[++n];
+
+        if (arg == "-i")
+            opts.problems.push_back(value);
+        else if (arg == "-o")
+            opts.output = value;
+        else if (arg == "-r")
+            opts.repetitions = std::atoi(value.c_str());
+        else if (arg == "-t")
+            opts.threads = std::atoi(value.c_str());
+        else
+        {
+            if (node == 0)
+            {
+                std::cout << std::endl << "ERROR: Unknown option "
+                          << arg << "." << std::endl << std::endl;
+            }
+            print_usage();
+        }
+    }
+
+    if (opts.problems.empty() || opts.repetitions < 1 || opts.threads < 1)
+        print_usage();
+
+    return opts;
+}
+
+//---------------------------------------------------------------------------//
+// Time the assembly of a problem
+//
+// Each phase is timed separately and the fastest of the repetitions is
+// reported; the setup phase is the Linear_System_FV constructor, which builds
+// the Moment_Coefficients blocks.
+
+void bench_assembly(const std::string   &file,
+                    const Options       &opts,
+                    std::vector<Result> &results)
+{
+    spn::Problem_Builder builder;
+    builder.setup(file);
+
+    auto db  = builder.problem_db();
+    db->set("num_threads", opts.threads);
+    auto dim = Teuchos::rcp(new profugus::Dimensions(db->get("SPn_order", 1)));
+    auto mat = builder.mat_db();
+
+    // rows assembled on all domains
+    double rows = builder.mesh()->num_cells() * dim->num_equations();
+    profugus::global_sum(rows);
+
+    // best time of each phase
+    double setup = 0.0, matrix = 0.0, fission = 0.0;
+
+    for (int r = 0; r < opts.repetitions; ++r)
+    {
+        profugus::Timer timer;
+
+        profugus::global_barrier();
+        timer.start();
+        RCP_Linear_System system = Teuchos::rcp(new Linear_System_t(
+            db, dim, mat, builder.mesh(), builder.indexer(),
+            builder.global_data()));
+        profugus::global_barrier();
+        timer.stop();
+        double t_setup = timer.wall_clock();
+
+        profugus::global_barrier();
+        timer.start();
+        system->build_Matrix();
+        profugus::global_barrier();
+        timer.stop();
+        double t_matrix = timer.wall_clock();
+
+        profugus::global_barrier();
+        timer.start();
+        system->build_fission_matrix();
+        profugus::global_barrier();
+        timer.stop();
+        double t_fission = timer.wall_clock();
+
+        setup   = r ? std::min(setup, t_setup) : t_setup;
+        matrix  = r ? std::min(matrix, t_matrix) : t_matrix;
+        fission = r ? std::min(fission, t_fission) : t_fission;
+    }
+
+    int nt = opts.threads;
+    results.push_back({file, nt, "Linear_System_FV::setup", rows, setup});
+    results.push_back(
+        {file, nt, "Linear_System_FV::build_Matrix", rows, matrix});
+    results.push_back(
+        {file, nt, "Linear_System_FV::build_fission_matrix", rows, fission});
+}
+
+//---------------------------------------------------------------------------//
+// Write the results as JSON
+
+void write_json(std::ostream &out, const std::vector<Result> &results)
+{
+    out << "{\n"
+        << "  \"nodes\": " << nodes << ",\n"
+        << "  \"results\": [\n";
+
+    for (int n = 0, N = results.size(); n < N; ++n)
+    {
+        const Result &r = results[n];
+        out << "    {\n"
+            << "      \"suite\": \"assembly\",\n"
+            << "      \"name\": \"" << r.name << "\",\n"
+            << "      \"params\": {\"problem\": \"" << r.problem
+            << "\", \"threads\": " << r.threads << "},\n"
+            << "      \"count\": " << r.count << ",\n"
+            << "      \"seconds\": " << r.seconds << ",\n"
+            << "      \"rate\": " << r.rate() << "\n"
+            << "    }" << (n + 1 < N ? "," : "") << "\n";
+    }
+
+    out << "  ]\n"
+        << "}" << std::endl;
+}
+
+//---------------------------------------------------------------------------//
+
+int main(int argc, char *argv[])
+{
+    profugus::initialize(argc, argv);
+
+    // nodes
+    node  = profugus::node();
+    nodes = profugus::nodes();
+
+    // process input arguments
+    def::Vec_String arguments(argc - 1);
+    for (int c = 1; c < argc; c++)
+    {
+        arguments[c - 1] = argv[c];
+    }
+    Options opts = parse_input_arguments(arguments);
+
+    try
+    {
+        std::vector<Result> results;
+
+        for (const auto &file : opts.problems)
+        {
+            profugus::pcout << "Benchmarking assembly of " << file
+                            << profugus::endl;
+
+            bench_assembly(file, opts, results);
+        }
+
+        // summary
+        for (const auto &r : results)
+        {
+            profugus::pcout << profugus::setw(40) << r.name << " "
+                            << profugus::scientific
+                            << profugus::setprecision(4) << r.seconds
+                            << " s " << r.rate() << " rows/s"
+                            << profugus::endl;
+        }
+
+        // write the results
+        if (node == 0)
+        {
+            if (opts.output.empty())
+            {
+                write_json(std::cout, results);
+            }
+            else
+            {
+                std::ofstream out(opts.output.c_str());
+                VALIDATE(out, "Unable to open " << opts.output);
+                write_json(out, results);
+            }
+        }
+    }
+    catch (const profugus::assertion &a)
+    {
+        std::cout << "Caught profugus assertion " << a.what() << std::endl;
+        exit(1);
+    }
+    catch (const std::exception &a)
+    {
+        std::cout << "Caught standard assertion " << a.what() << std::endl;
+        exit(1);
+    }
+
+    profugus::finalize();
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
+//                 end of spn_bench.cc
+//---------------------------------------------------------------------------//
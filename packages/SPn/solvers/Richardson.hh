@@ -33,6 +33,10 @@ namespace profugus
  * The memory requirement for this solver is three vectors (including the
  * solution vector and rhs, which are allocated outside of this class).
  * One additional vector is required if a preconditioner is used.
+ * Multivectors are iterated as a block until the relative residual of every
+ * column is below the tolerance.  A column is no longer updated once it has
+ * converged, so each column of a block gets the same solution as when it is
+ * solved alone.
  *
  * \sa Richardson.t.hh for detailed descriptions.
  */
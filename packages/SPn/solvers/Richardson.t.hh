@@ -11,6 +11,7 @@
 #ifndef SPn_solvers_Richardson_t_hh
 #define SPn_solvers_Richardson_t_hh
 
+#include <algorithm>
 #include <vector>
 
 #include "comm/P_Stream.hh"
@@ -47,20 +48,26 @@ void Richardson<T>::solve( Teuchos::RCP<MV>       x,
     REQUIRE( x   != Teuchos::null );
     REQUIRE( b   != Teuchos::null );
 
+    // each column is an independent system
+    int num_vecs = MVT::GetNumberVecs(*x);
+    REQUIRE( MVT::GetNumberVecs(*b) == num_vecs );
+
     // Allocate necessary vectors
-    Teuchos::RCP<MV> r = MVT::Clone(*x,1);
+    Teuchos::RCP<MV> r = MVT::Clone(*x,num_vecs);
 
     Teuchos::RCP<MV> tmp;
     if( d_P != Teuchos::null )
     {
-        tmp = MVT::Clone(*x,1);
+        tmp = MVT::Clone(*x,num_vecs);
     }
 
-    std::vector<double> tmp_nrm(1); // Temp storage for vector norm.
+    std::vector<double> tmp_nrm(num_vecs); // Temp storage for vector norms.
 
-    MVT::MvNorm(*b,tmp_nrm);
-    double b_norm = tmp_nrm[0];
-    double res_norm;
+    // The residual of each column is relative to its RHS norm
+    std::vector<double> b_nrm(num_vecs);
+    MVT::MvNorm(*b,b_nrm);
+    double b_norm = *std::max_element(b_nrm.begin(), b_nrm.end());
+    double res_norm = 0.0;
 
     b_converged = false;
     b_num_iters = 0;
@@ -73,6 +80,22 @@ void Richardson<T>::solve( Teuchos::RCP<MV>       x,
         return;
     }
 
+    // Damping of each column; columns stop being updated once they have
+    // converged, so every column takes the same iterates that it would if
+    // it were solved alone.  Columns with a zero RHS are solved already.
+    std::vector<double> omega(num_vecs, d_damping);
+    std::vector<double> scale(num_vecs, 1.0);
+    for( int v = 0; v < num_vecs; ++v )
+    {
+        if( b_nrm[v] == 0.0 )
+        {
+            omega[v] = 0.0;
+            scale[v] = 0.0;
+        }
+    }
+    if( std::find(scale.begin(), scale.end(), 0.0) != scale.end() )
+        MVT::MvScale(*x,scale);
+
     while( true )
     {
         // Compute residual
@@ -88,10 +111,21 @@ void Richardson<T>::solve( Teuchos::RCP<MV>       x,
             MVT::MvAddMv(1.0,*b,-1.0,*r,*r);
         }
 
-        // Check for convergence
+        // Check for convergence of each column that is still iterating
         MVT::MvNorm(*r,tmp_nrm);
-        res_norm = tmp_nrm[0];
-        if( res_norm/b_norm < b_tolerance )
+        res_norm = 0.0;
+        for( int v = 0; v < num_vecs; ++v )
+        {
+            if( omega[v] == 0.0 )
+                continue;
+
+            double col_norm = tmp_nrm[v] / b_nrm[v];
+            if( col_norm < b_tolerance )
+                omega[v] = 0.0;
+            else
+                res_norm = std::max(res_norm, col_norm);
+        }
+        if( res_norm == 0.0 )
         {
             b_converged = true;
             break;
@@ -103,11 +137,12 @@ void Richardson<T>::solve( Teuchos::RCP<MV>       x,
             profugus::pout << b_label << " residual norm at iteration "
                            << b_num_iters << " is "
                            << profugus::scientific << profugus::setprecision(3)
-                           << res_norm/b_norm << profugus::endl;
+                           << res_norm << profugus::endl;
         }
 
-        // x = x + omega*r
-        MVT::MvAddMv(1.0,*x,d_damping,*r,*x);
+        // x = x + omega*r on the columns that have not converged
+        MVT::MvScale(*r,omega);
+        MVT::MvAddMv(1.0,*x,1.0,*r,*x);
 
         b_num_iters++;
 
@@ -128,7 +163,7 @@ void Richardson<T>::solve( Teuchos::RCP<MV>       x,
         {
             profugus::pout << b_label << " terminated after " << b_num_iters
                            << " iterations."  << profugus::endl
-                           << " Final residual norm is " << res_norm/b_norm
+                           << " Final residual norm is " << res_norm
                            << "." << profugus::endl
                            << " Requested tolerance is " << b_tolerance << "."
                            << profugus::endl;
@@ -75,7 +75,8 @@ void Eigenvalue_Solver<T>::setup(RCP_Dimensions  dim,
     std::string &eqn_type =
         b_db->template get<std::string>("eqn_type", std::string("fv"));
 
-    if (profugus::lower(eqn_type) == "fv")
+    if (profugus::lower(eqn_type) == "fv" ||
+        profugus::lower(eqn_type) == "fv_mf")
     {
         b_system = Teuchos::rcp(
             new Linear_System_FV<T>(
@@ -88,6 +89,11 @@ void Eigenvalue_Solver<T>::setup(RCP_Dimensions  dim,
     }
     CHECK(!b_system.is_null());
 
+    // matrix-free operators cannot be transposed
+    INSIST(!adjoint || profugus::lower(eqn_type) != "fv_mf",
+           "Adjoint eigenvalue problems are not supported with eqn_type "
+           "fv_mf; use fv.");
+
     // build the SPN matrix and build the fission matrix
     b_system->build_Matrix();
     b_system->build_fission_matrix();
@@ -563,8 +569,19 @@ Eigenvalue_Solver<T>::build_preconditioner(RCP_Dimensions  dim,
     }
     else
     {
-        prec = PreconditionerBuilder<T>::build_preconditioner(
-            b_system->get_Operator(),edb);
+        // the algebraic preconditioners are built from the matrix, which
+        // matrix-free systems (eqn_type fv_mf) do not have
+        VALIDATE(prec_type == "none" ||
+                 b_system->get_Matrix() != Teuchos::null,
+                 "Preconditioner '" << prec_type << "' requires an assembled "
+                 "matrix; use Multigrid, Stratimikos, or None with eqn_type "
+                 "fv_mf.");
+
+        if (prec_type != "none")
+        {
+            prec = PreconditionerBuilder<T>::build_preconditioner(
+                b_system->get_Operator(),edb);
+        }
     }
 
     return prec;
@@ -38,6 +38,14 @@ namespace profugus
  * \class Energy_Multigrid
  * \brief Multigrid in energy preconditioner for SPN
  *
+ * By default each coarse level is rediscretized: the cross sections are
+ * collapsed with Energy_Collapse and a new Linear_System_FV is assembled.
+ * If the \c "Coarse Operator" entry of the preconditioner database is \c
+ * "Galerkin" the coarse matrices are instead made algebraically from the
+ * fine matrix as \f$\mathbf{R}\mathbf{A}\mathbf{P}\f$ with the
+ * Energy_Restriction and Energy_Prolongation operators, which needs an
+ * assembled fine matrix.
+ *
  * \sa Energy_Multigrid.cc for detailed descriptions.
  */
 /*!
@@ -56,6 +64,7 @@ class Energy_Multigrid : public OperatorAdapter<T>
     typedef typename T::OP                             OP;
     typedef typename T::MV                             MV;
     typedef typename T::MAP                            MAP;
+    typedef typename T::MATRIX                         Matrix_t;
     typedef Anasazi::OperatorTraits<double,MV,OP>      OPT;
     typedef Anasazi::MultiVecTraits<double,MV>         MVT;
     typedef LinearSolver<T>                            LinearSolver_t;
@@ -74,19 +83,49 @@ class Energy_Multigrid : public OperatorAdapter<T>
                       Teuchos::RCP<Global_Mesh_Data>  data,
                       Teuchos::RCP<Linear_System<T> > fine_system );
 
+    //! Number of levels.
+    int num_levels() const { return d_num_levels; }
+
+    //! Operator on a level.
+    Teuchos::RCP<OP> get_operator(int level) const
+    {
+        REQUIRE(level >= 0 && level < d_num_levels);
+        return d_operators[level];
+    }
+
+    //! Map of a level.
+    Teuchos::RCP<const MAP> get_map(int level) const
+    {
+        REQUIRE(level >= 0 && level < d_num_levels);
+        return d_maps[level];
+    }
+
   private:
 
     void ApplyImpl(const MV &x, MV &y) const;
 
+    // Size the work vectors for a block of vectors.
+    void allocate_vectors(int num_vectors) const;
+
+    // Build and set the preconditioner of the last smoother.
+    void add_preconditioner(Teuchos::RCP<OP> matrix, RCP_ParameterList db);
+
+    // Build a Galerkin (R*A*P) coarse-level matrix.
+    Teuchos::RCP<Matrix_t> build_galerkin_matrix(
+        Teuchos::RCP<const Matrix_t>  fine,
+        Teuchos::RCP<const MAP>       fine_map,
+        const std::vector<int>       &collapse,
+        Teuchos::RCP<const MAP>      &coarse_map) const;
+
     int d_num_levels;
     std::vector< Teuchos::RCP<const MAP> >      d_maps;
     std::vector< Teuchos::RCP<OP> >             d_operators;
     std::vector< Teuchos::RCP<OP> >             d_restrictions;
     std::vector< Teuchos::RCP<OP> >             d_prolongations;
     std::vector< Teuchos::RCP<OP> >             d_preconditioners;
-    std::vector< Teuchos::RCP<MV> >             d_solutions;
-    std::vector< Teuchos::RCP<MV> >             d_residuals;
-    std::vector< Teuchos::RCP<MV> >             d_rhss;
+    mutable std::vector< Teuchos::RCP<MV> >     d_solutions;
+    mutable std::vector< Teuchos::RCP<MV> >     d_residuals;
+    mutable std::vector< Teuchos::RCP<MV> >     d_rhss;
     std::vector< Teuchos::RCP<LinearSolver_t> > d_smoothers;
 };
 
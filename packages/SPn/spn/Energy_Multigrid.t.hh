@@ -11,11 +11,18 @@
 #ifndef SPn_spn_Energy_Multigrid_t_hh
 #define SPn_spn_Energy_Multigrid_t_hh
 
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <utility>
+
+#include "utils/String_Functions.hh"
 #include "solvers/PreconditionerBuilder.hh"
 #include "solvers/LinAlgTypedefs.hh"
 #include "xs/Energy_Collapse.hh"
 #include "Linear_System_FV.hh"
 #include "Energy_Multigrid.hh"
+#include "MatrixTraits.hh"
 #include "VectorTraits.hh"
 
 namespace profugus
@@ -45,12 +52,25 @@ Energy_Multigrid<T>::Energy_Multigrid(RCP_ParameterList              main_db,
     int max_depth     = prec_db->get("Max Depth", 10);
     int fine_groups   = mat_db->xs().num_groups();
 
+    // coarse operators are either rediscretized from collapsed cross
+    // sections or made algebraically from the fine matrix
+    std::string coarse_op = profugus::lower(
+        prec_db->get("Coarse Operator", std::string("rediscretize")));
+    VALIDATE(coarse_op == "rediscretize" || coarse_op == "galerkin",
+             "Coarse Operator must be 'Rediscretize' or 'Galerkin'.");
+    bool galerkin = (coarse_op == "galerkin");
+
     // old and new groups
     int old_groups = 0, new_groups = fine_groups;
 
     // material databases for preconditioner
     Teuchos::RCP<Mat_DB> old_mat, new_mat = mat_db;
 
+    // matrix on the current level (null for matrix-free operators)
+    RCP<Matrix_t> matrix = fine_system->get_Matrix();
+    VALIDATE(!galerkin || matrix != Teuchos::null,
+             "Galerkin coarse operators require an assembled fine matrix.");
+
     // Fill vectors with fine level objects, don't build new matrix
     d_operators.push_back(fine_system->get_Operator());
     d_maps.push_back( fine_system->get_Map() );
@@ -63,16 +83,7 @@ Energy_Multigrid<T>::Energy_Multigrid(RCP_ParameterList              main_db,
     d_smoothers.push_back(
         LinearSolverBuilder<T>::build_solver(smoother_db));
     d_smoothers.back()->set_operator(d_operators.back());
-    d_preconditioners.push_back(PreconditionerBuilder<T>::
-        build_preconditioner(fine_system->get_Matrix(),smoother_db) );
-    if (d_preconditioners.back() != Teuchos::null)
-    {
-        d_smoothers.back()->set_preconditioner(d_preconditioners.back());
-    }
-    else
-    {
-        d_smoothers.back()->set_preconditioner(fine_system->get_Matrix());
-    }
+    add_preconditioner(matrix, smoother_db);
 
     // loop through levels
     int level = 0;
@@ -91,25 +102,37 @@ Energy_Multigrid<T>::Energy_Multigrid(RCP_ParameterList              main_db,
             collapse.push_back(extra_grps);
         }
 
-        // Create new Mat_DB
-        std::vector<double> weights(old_groups,1.0);
-        old_mat = new_mat;
-        new_mat = Energy_Collapse::collapse_all_mats(
-            old_mat, collapse, weights);
-        CHECK( !new_mat.is_null() );
-
-        // Build linear system
-        RCP<Linear_System<T> > system = rcp(
-            new Linear_System_FV<T>(
-                main_db, dim, new_mat, mesh, indexer, data));
-
-        system->build_Matrix();
-        d_operators.push_back( system->get_Operator() );
+        if (galerkin)
+        {
+            // Build R*A*P from the previous level matrix
+            RCP<const MAP> coarse_map;
+            matrix = build_galerkin_matrix(matrix, d_maps[level-1], collapse,
+                                           coarse_map);
+            d_operators.push_back( matrix );
+            d_maps.push_back( coarse_map );
+        }
+        else
+        {
+            // Create new Mat_DB
+            std::vector<double> weights(old_groups,1.0);
+            old_mat = new_mat;
+            new_mat = Energy_Collapse::collapse_all_mats(
+                old_mat, collapse, weights);
+            CHECK( !new_mat.is_null() );
+
+            // Build linear system
+            RCP<Linear_System<T> > system = rcp(
+                new Linear_System_FV<T>(
+                    main_db, dim, new_mat, mesh, indexer, data));
+
+            system->build_Matrix();
+            d_operators.push_back( system->get_Operator() );
+            d_maps.push_back( system->get_Map() );
+            matrix = system->get_Matrix();
+        }
         CHECK( d_operators.back() != Teuchos::null );
 
         // Allocate vectors
-        RCP<MV> tmp_vec = system->get_RHS();
-        d_maps.push_back( system->get_Map() );
         d_solutions.push_back( VectorTraits<T>::build_vector(d_maps[level]));
         d_rhss.push_back(      VectorTraits<T>::build_vector(d_maps[level]));
         d_residuals.push_back( VectorTraits<T>::build_vector(d_maps[level]));
@@ -132,16 +155,7 @@ Energy_Multigrid<T>::Energy_Multigrid(RCP_ParameterList              main_db,
         d_smoothers.back()->set_operator(d_operators.back());
 
         // Store and set preconditioner
-        d_preconditioners.push_back(PreconditionerBuilder<T>::
-            build_preconditioner(system->get_Matrix(),smoother_db) );
-        if( d_preconditioners.back() != Teuchos::null )
-        {
-            d_smoothers.back()->set_preconditioner(d_preconditioners.back());
-        }
-        else
-        {
-            d_smoothers.back()->set_preconditioner(system->get_Matrix());
-        }
+        add_preconditioner(matrix, smoother_db);
 
     } while( new_groups!=1 && level!=max_depth );
 
@@ -170,70 +184,277 @@ Energy_Multigrid<T>::Energy_Multigrid(RCP_ParameterList              main_db,
 }
 
 //---------------------------------------------------------------------------//
-// APPLY MULTIGRID V-CYCLE
+// PRIVATE IMPLEMENTATION
 //---------------------------------------------------------------------------//
+/*!
+ * \brief Build the preconditioner of the last smoother.
+ *
+ * Matrix-free operators (eqn_type "fv_mf") have no matrix, so their
+ * smoothers are not preconditioned and a null preconditioner is stored.
+ */
+template <class T>
+void Energy_Multigrid<T>::add_preconditioner(Teuchos::RCP<OP>  matrix,
+                                             RCP_ParameterList db)
+{
+    REQUIRE(!d_smoothers.empty());
+
+    if (matrix == Teuchos::null)
+    {
+        d_preconditioners.push_back(Teuchos::null);
+        return;
+    }
+
+    d_preconditioners.push_back(
+        PreconditionerBuilder<T>::build_preconditioner(matrix, db));
+    if (d_preconditioners.back() != Teuchos::null)
+    {
+        d_smoothers.back()->set_preconditioner(d_preconditioners.back());
+    }
+    else
+    {
+        d_smoothers.back()->set_preconditioner(matrix);
+    }
+}
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Build a Galerkin coarse-level matrix.
+ *
+ * The coarse matrix is \f$\mathbf{R}\mathbf{A}\mathbf{P}\f$, where
+ * \f$\mathbf{R}\f$ averages the fine groups in each coarse group
+ * (Energy_Restriction) and \f$\mathbf{P}\f$ injects the coarse group into
+ * its fine groups (Energy_Prolongation).  Energy is the innermost index, so
+ * a fine unknown \f$g + N_g u\f$ maps to the coarse unknown
+ * \f$c(g) + N_c u\f$ and the coarse matrix has the fine block sparsity
+ * pattern with \f$N_c\times N_c\f$ blocks.  Each coarse row is made from
+ * the local fine rows of its groups, so no communication is needed beyond
+ * the fill of the matrix.
+ *
+ * This relies on the global ordering of the fine map, not only the local
+ * one.  The \f$N_f\f$ groups of each local unknown must have the
+ * consecutive global ids \f$g + N_f U\f$, as in the Linear_System_FV maps
+ * and the coarse maps made here.  That is what lets the coarse global ids
+ * and the coarse columns of off-domain entries be computed without
+ * communication.  The ordering is validated for every local fine row.
+ *
+ * \param fine matrix on the fine level
+ * \param fine_map map of the fine level
+ * \param collapse number of fine groups in each coarse group
+ * \param coarse_map on return, the map of the coarse level
+ */
 template <class T>
-void Energy_Multigrid<T>::ApplyImpl(const MV &x,
-                                          MV &y ) const
+Teuchos::RCP<typename Energy_Multigrid<T>::Matrix_t>
+Energy_Multigrid<T>::build_galerkin_matrix(
+    Teuchos::RCP<const Matrix_t>  fine,
+    Teuchos::RCP<const MAP>       fine_map,
+    const std::vector<int>       &collapse,
+    Teuchos::RCP<const MAP>      &coarse_map) const
 {
-    int num_vectors = MVT::GetNumberVecs(x);
-    REQUIRE(MVT::GetNumberVecs(y) == num_vectors);
+    typedef MatrixTraits<T>                   MT;
+    typedef typename MT::Graph_t              Graph_t;
+    typedef std::pair<int, double>            Entry;
+
+    REQUIRE(fine != Teuchos::null);
+
+    // fine and coarse groups
+    int Nf = std::accumulate(collapse.begin(), collapse.end(), 0);
+    int Nc = collapse.size();
+    CHECK(Nf > Nc);
+
+    // coarse group of each fine group and first fine group of each coarse
+    // group
+    std::vector<int> coarse_group(Nf), first(Nc + 1, 0);
+    for (int c = 0; c < Nc; ++c)
+    {
+        first[c + 1] = first[c] + collapse[c];
+        std::fill(coarse_group.begin() + first[c],
+                  coarse_group.begin() + first[c + 1], c);
+    }
 
-    // Process each vector in multivec individually (all of the
-    //  multivecs have been allocated for a single vec)
-    for( int ivec=0; ivec<num_vectors; ++ivec )
+    // number of energy-independent unknowns
+    int N_fine = MT::local_rows(fine);
+    CHECK(N_fine % Nf == 0);
+    int Nu = N_fine / Nf;
+
+    // make the coarse map with the same unknown ordering
+    std::vector<int> coarse_gids(Nu * Nc);
+    for (int u = 0; u < Nu; ++u)
     {
-        std::vector<int> ind(1,ivec);
-        Teuchos::RCP<const MV> xi = MVT::CloneView(x,ind);
-        MVT::Assign(*xi,*d_residuals[0]);
-        MVT::Assign(*xi,*d_rhss[0]);
-        MVT::MvInit(*d_solutions[0],0.0);
-
-        // In a true multigrid V-cycle, the first operation is a
-        //  restriction rather than smoothing.  Smoothing on the finest
-        //  level is only done at the end of the cycle.  This way if two
-        //  V-cycles are stacked back-to-back, only a single smoothing
-        //  step is done in the middle.
-
-        for( int ilevel=1; ilevel<d_num_levels; ++ilevel )
+        int global_u = MT::global_row_id(fine_map, u * Nf) / Nf;
+        for (int g = 0; g < Nf; ++g)
+        {
+            VALIDATE(MT::global_row_id(fine_map, g + u * Nf) ==
+                     g + global_u * Nf,
+                     "Galerkin coarse operators require the groups of each "
+                     << "unknown to be contiguous in the global ordering; "
+                     << "local row " << g + u * Nf << " has global id "
+                     << MT::global_row_id(fine_map, g + u * Nf));
+        }
+        for (int c = 0; c < Nc; ++c)
         {
-            // Restrict residual from previous level
-            OPT::Apply(*d_restrictions[ilevel-1],
-                       *d_residuals[ilevel-1],
-                       *d_rhss[ilevel]);
+            coarse_gids[c + u * Nc] = c + global_u * Nc;
+        }
+    }
+    coarse_map = MT::build_map(Nu * Nc, MT::global_rows(fine) / Nf * Nc,
+                               coarse_gids);
+
+    // restricted rows in compressed-row storage
+    std::vector<int>    count(Nu * Nc, 0), offset(Nu * Nc + 1, 0);
+    std::vector<int>    columns;
+    std::vector<double> values;
+    std::vector<Entry>  entries;
 
-            // Apply smoother
-            MVT::MvInit(*d_solutions[ilevel],0.0);
-            d_smoothers[ilevel]->solve(d_solutions[ilevel],d_rhss[ilevel]);
+    Teuchos::ArrayView<const int>    inds;
+    Teuchos::ArrayView<const double> vals;
 
-            // Compute residual (except on coarsest level)
-            if( ilevel != d_num_levels-1 )
+    for (int row = 0; row < Nu * Nc; ++row)
+    {
+        int u = row / Nc;
+        int c = row % Nc;
+
+        // sum the fine rows in the coarse group, mapping the columns to
+        // coarse unknowns
+        entries.clear();
+        double r = 1.0 / static_cast<double>(collapse[c]);
+        for (int g = first[c]; g < first[c + 1]; ++g)
+        {
+            MT::get_local_row_view(fine, g + u * Nf, inds, vals);
+            for (int n = 0; n < inds.size(); ++n)
             {
-                OPT::Apply(*d_operators[ilevel],
-                           *d_solutions[ilevel],
-                           *d_residuals[ilevel]);
+                int col = MT::global_col_id(fine, inds[n]);
+                entries.push_back(
+                    Entry(coarse_group[col % Nf] + (col / Nf) * Nc,
+                          r * vals[n]));
+            }
+        }
+        std::sort(entries.begin(), entries.end());
 
-                MVT::MvAddMv(1.0,*d_rhss[ilevel],-1.0,*d_residuals[ilevel],
-                             *d_residuals[ilevel]);
+        // combine the entries in each coarse column
+        for (int n = 0, N = entries.size(); n < N; ++n)
+        {
+            if (n == 0 || entries[n].first != entries[n - 1].first)
+            {
+                columns.push_back(entries[n].first);
+                values.push_back(0.0);
+                ++count[row];
             }
+            values.back() += entries[n].second;
         }
+        offset[row + 1] = columns.size();
+    }
 
-        for( int ilevel=d_num_levels-2; ilevel>=0; --ilevel )
+    // make the static graph and fill the matrix
+    Teuchos::RCP<Graph_t> graph = MT::construct_graph(coarse_map, count);
+    for (int row = 0; row < Nu * Nc; ++row)
+    {
+        MT::add_to_graph(*graph, coarse_gids[row], count[row],
+                         &columns[offset[row]]);
+    }
+    MT::finalize_graph(graph);
+
+    Teuchos::RCP<Matrix_t> matrix =
+        MT::construct_matrix(Teuchos::RCP<const Graph_t>(graph));
+    for (int row = 0; row < Nu * Nc; ++row)
+    {
+        MT::sum_into_matrix(*matrix, coarse_gids[row], count[row],
+                            &columns[offset[row]], &values[offset[row]]);
+    }
+    MT::finalize_matrix(matrix);
+
+    ENSURE(MT::local_rows(matrix) == Nu * Nc);
+    return matrix;
+}
+
+//---------------------------------------------------------------------------//
+// APPLY MULTIGRID V-CYCLE
+//---------------------------------------------------------------------------//
+
+template <class T>
+void Energy_Multigrid<T>::ApplyImpl(const MV &x,
+                                          MV &y ) const
+{
+    int num_vectors = MVT::GetNumberVecs(x);
+    REQUIRE(MVT::GetNumberVecs(y) == num_vectors);
+
+    // The whole multivector is processed as a block on each level, so the
+    // operators and smoothers are applied once per level to all vectors
+    allocate_vectors(num_vectors);
+
+    MVT::Assign(x,*d_residuals[0]);
+    MVT::Assign(x,*d_rhss[0]);
+    MVT::MvInit(*d_solutions[0],0.0);
+
+    // In a true multigrid V-cycle, the first operation is a
+    //  restriction rather than smoothing.  Smoothing on the finest
+    //  level is only done at the end of the cycle.  This way if two
+    //  V-cycles are stacked back-to-back, only a single smoothing
+    //  step is done in the middle.
+
+    for( int ilevel=1; ilevel<d_num_levels; ++ilevel )
+    {
+        // Restrict residual from previous level
+        OPT::Apply(*d_restrictions[ilevel-1],
+                   *d_residuals[ilevel-1],
+                   *d_rhss[ilevel]);
+
+        // Apply smoother
+        MVT::MvInit(*d_solutions[ilevel],0.0);
+        d_smoothers[ilevel]->solve(d_solutions[ilevel],d_rhss[ilevel]);
+
+        // Compute residual (except on coarsest level)
+        if( ilevel != d_num_levels-1 )
         {
-            // Prolong solution vector to next level: x[l] = x[l] + P*x[l-1]
-            // Residual is used for tmp storage here
-            OPT::Apply(*d_prolongations[ilevel],*d_solutions[ilevel+1],
+            OPT::Apply(*d_operators[ilevel],
+                       *d_solutions[ilevel],
                        *d_residuals[ilevel]);
-            MVT::MvAddMv(1.0,*d_residuals[ilevel],1.0,*d_solutions[ilevel],
-                         *d_solutions[ilevel]);
 
-            // Apply smoother
-            d_smoothers[ilevel]->solve(d_solutions[ilevel],d_rhss[ilevel]);
+            MVT::MvAddMv(1.0,*d_rhss[ilevel],-1.0,*d_residuals[ilevel],
+                         *d_residuals[ilevel]);
         }
+    }
+
+    for( int ilevel=d_num_levels-2; ilevel>=0; --ilevel )
+    {
+        // Prolong solution vector to next level: x[l] = x[l] + P*x[l-1]
+        // Residual is used for tmp storage here
+        OPT::Apply(*d_prolongations[ilevel],*d_solutions[ilevel+1],
+                   *d_residuals[ilevel]);
+        MVT::MvAddMv(1.0,*d_residuals[ilevel],1.0,*d_solutions[ilevel],
+                     *d_solutions[ilevel]);
+
+        // Apply smoother
+        d_smoothers[ilevel]->solve(d_solutions[ilevel],d_rhss[ilevel]);
+    }
+
+    MVT::Assign(*d_solutions[0],y);
+}
 
-        MVT::SetBlock(*d_solutions[0],ind,y);
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Size the work vectors on each level for a block of vectors.
+ *
+ * The vectors are only reallocated when the block size changes, so repeated
+ * applies with the same block size (e.g. in a block eigensolver) reuse them.
+ */
+template <class T>
+void Energy_Multigrid<T>::allocate_vectors(int num_vectors) const
+{
+    REQUIRE(num_vectors > 0);
+
+    if (MVT::GetNumberVecs(*d_solutions[0]) == num_vectors)
+        return;
+
+    for (int level = 0; level < d_num_levels; ++level)
+    {
+        d_solutions[level] =
+            VectorTraits<T>::build_vector(d_maps[level], num_vectors);
+        d_residuals[level] =
+            VectorTraits<T>::build_vector(d_maps[level], num_vectors);
+        d_rhss[level] =
+            VectorTraits<T>::build_vector(d_maps[level], num_vectors);
     }
+
+    ENSURE(MVT::GetNumberVecs(*d_solutions.back()) == num_vectors);
 }
 
 } // end namespace profugus
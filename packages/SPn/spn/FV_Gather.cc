@@ -8,6 +8,8 @@
  */
 //---------------------------------------------------------------------------//
 
+#include <algorithm>
+
 #include "Dimensions.hh"
 #include "FV_Gather.hh"
 
@@ -184,6 +186,99 @@ void FV_Gather::gather(int eqn)
     ENSURE(!d_request_J[HI].inuse());
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Gather the unknowns of the face cells on neighboring blocks.
+ *
+ * \param u local unknowns, stored contiguously for each local cell
+ * \param unknowns_per_cell number of unknowns in each cell
+ */
+void FV_Gather::gather(const double *u,
+                       int           unknowns_per_cell)
+{
+    using def::I; using def::J; using def::K; using def::PROBLEM_BOUNDARY;
+
+    REQUIRE(u);
+    REQUIRE(unknowns_per_cell > 0);
+
+    // return immediately if only running on 1 domain
+    if (d_domains == 1) return;
+
+    REQUIRE(!d_request_I[LO].inuse());
+    REQUIRE(!d_request_I[HI].inuse());
+    REQUIRE(!d_request_J[LO].inuse());
+    REQUIRE(!d_request_J[HI].inuse());
+
+    // size of the unknowns on I and J faces
+    int size_I = d_mesh->num_cells_dim(J) * d_mesh->num_cells_dim(K) *
+                 unknowns_per_cell;
+    int size_J = d_mesh->num_cells_dim(I) * d_mesh->num_cells_dim(K) *
+                 unknowns_per_cell;
+
+    // post receives
+    if (d_neighbor_I[LO] != PROBLEM_BOUNDARY)
+    {
+        d_incoming_u_I[LO].resize(size_I);
+        profugus::receive_async(d_request_I[LO], &d_incoming_u_I[LO][0],
+                                size_I, d_neighbor_I[LO], 454);
+    }
+    if (d_neighbor_J[LO] != PROBLEM_BOUNDARY)
+    {
+        d_incoming_u_J[LO].resize(size_J);
+        profugus::receive_async(d_request_J[LO], &d_incoming_u_J[LO][0],
+                                size_J, d_neighbor_J[LO], 455);
+    }
+    if (d_neighbor_I[HI] != PROBLEM_BOUNDARY)
+    {
+        d_incoming_u_I[HI].resize(size_I);
+        profugus::receive_async(d_request_I[HI], &d_incoming_u_I[HI][0],
+                                size_I, d_neighbor_I[HI], 456);
+    }
+    if (d_neighbor_J[HI] != PROBLEM_BOUNDARY)
+    {
+        d_incoming_u_J[HI].resize(size_J);
+        profugus::receive_async(d_request_J[HI], &d_incoming_u_J[HI][0],
+                                size_J, d_neighbor_J[HI], 457);
+    }
+
+    // send out data on low sides
+    if (d_neighbor_I[LO] != PROBLEM_BOUNDARY)
+    {
+        fill_I_face(u, unknowns_per_cell, d_outgoing_u_I[LO], 0);
+        profugus::send(&d_outgoing_u_I[LO][0], size_I, d_neighbor_I[LO], 456);
+    }
+    if (d_neighbor_J[LO] != PROBLEM_BOUNDARY)
+    {
+        fill_J_face(u, unknowns_per_cell, d_outgoing_u_J[LO], 0);
+        profugus::send(&d_outgoing_u_J[LO][0], size_J, d_neighbor_J[LO], 457);
+    }
+
+    // send out data on high sides
+    if (d_neighbor_I[HI] != PROBLEM_BOUNDARY)
+    {
+        fill_I_face(u, unknowns_per_cell, d_outgoing_u_I[HI],
+                    d_mesh->num_cells_dim(I) - 1);
+        profugus::send(&d_outgoing_u_I[HI][0], size_I, d_neighbor_I[HI], 454);
+    }
+    if (d_neighbor_J[HI] != PROBLEM_BOUNDARY)
+    {
+        fill_J_face(u, unknowns_per_cell, d_outgoing_u_J[HI],
+                    d_mesh->num_cells_dim(J) - 1);
+        profugus::send(&d_outgoing_u_J[HI][0], size_J, d_neighbor_J[HI], 455);
+    }
+
+    // wait on all of the posted receives
+    d_request_I[LO].wait();
+    d_request_I[HI].wait();
+    d_request_J[LO].wait();
+    d_request_J[HI].wait();
+
+    ENSURE(!d_request_I[LO].inuse());
+    ENSURE(!d_request_I[HI].inuse());
+    ENSURE(!d_request_J[LO].inuse());
+    ENSURE(!d_request_J[HI].inuse());
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \brief Get diffusion matrices from the low side neighbor.
@@ -230,6 +325,46 @@ FV_Gather::RCP_Face_Field FV_Gather::high_side_D(int face) const
     return d_incoming_J[HI];
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Get the unknowns of the face cells on the low side neighbor.
+ *
+ * \param face I or J enumeration indicating face direction
+ *
+ * \return pointer to the unknowns gathered by the last call to
+ * gather(const double *, int); it is null if the face is adjacent to a
+ * problem boundary
+ */
+const double* FV_Gather::low_side_u(int face) const
+{
+    using def::I; using def::K;
+
+    REQUIRE(face < K);
+
+    const Vec_Dbl &u = face == I ? d_incoming_u_I[LO] : d_incoming_u_J[LO];
+    return u.empty() ? nullptr : &u[0];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Get the unknowns of the face cells on the high side neighbor.
+ *
+ * \param face I or J enumeration indicating face direction
+ *
+ * \return pointer to the unknowns gathered by the last call to
+ * gather(const double *, int); it is null if the face is adjacent to a
+ * problem boundary
+ */
+const double* FV_Gather::high_side_u(int face) const
+{
+    using def::I; using def::K;
+
+    REQUIRE(face < K);
+
+    const Vec_Dbl &u = face == I ? d_incoming_u_I[HI] : d_incoming_u_J[HI];
+    return u.empty() ? nullptr : &u[0];
+}
+
 //---------------------------------------------------------------------------//
 // PRIVATE IMPLEMENTATION
 //---------------------------------------------------------------------------//
@@ -342,6 +477,64 @@ void FV_Gather::fill_J_face(int            eqn,
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Fill the unknowns on an I-face.
+ */
+void FV_Gather::fill_I_face(const double *u,
+                            int           upc,
+                            Vec_Dbl      &face,
+                            int           i)
+{
+    using def::J; using def::K;
+
+    int Nj = d_mesh->num_cells_dim(J);
+    int Nk = d_mesh->num_cells_dim(K);
+    face.resize(Nj * Nk * upc);
+
+    // copy the unknowns of each face cell
+    Vec_Dbl::iterator f = face.begin();
+    for (int k = 0; k < Nk; ++k)
+    {
+        for (int j = 0; j < Nj; ++j)
+        {
+            const double *cell = u + d_mesh->convert(i, j, k) * upc;
+            f = std::copy(cell, cell + upc, f);
+        }
+    }
+
+    ENSURE(f == face.end());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Fill the unknowns on a J-face.
+ */
+void FV_Gather::fill_J_face(const double *u,
+                            int           upc,
+                            Vec_Dbl      &face,
+                            int           j)
+{
+    using def::I; using def::K;
+
+    int Ni = d_mesh->num_cells_dim(I);
+    int Nk = d_mesh->num_cells_dim(K);
+    face.resize(Ni * Nk * upc);
+
+    // copy the unknowns of each face cell
+    Vec_Dbl::iterator f = face.begin();
+    for (int k = 0; k < Nk; ++k)
+    {
+        for (int i = 0; i < Ni; ++i)
+        {
+            const double *cell = u + d_mesh->convert(i, j, k) * upc;
+            f = std::copy(cell, cell + upc, f);
+        }
+    }
+
+    ENSURE(f == face.end());
+}
+
 } // end namespace profugus
 
 //---------------------------------------------------------------------------//
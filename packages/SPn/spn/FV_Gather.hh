@@ -27,6 +27,12 @@ namespace profugus
 /*!
  * \class FV_Gather
  * \brief Gather off-processor diffusion matrices.
+ *
+ * The unknowns of the cells on the faces of neighboring blocks can also be
+ * gathered, which is used to apply the SPN operator without a matrix.  The
+ * unknowns of a cell are stored contiguously in a face array, so unknown \c
+ * r of the face cell (abscissa, ordinate) is at
+ * \c r+unknowns_per_cell*(abscissa+ordinate*N_abscissa).
  */
 /*!
  * \example spn/test/tstFV_Gather.cc
@@ -46,6 +52,8 @@ class FV_Gather
     typedef profugus::Vector_Lite<RCP_Face_Field, 2> Face_Fields;
     typedef Teuchos::RCP<SDM_Face_Field::Mesh_t>     RCP_Mesh;
     typedef LG_Indexer                               Indexer_t;
+    typedef def::Vec_Dbl                             Vec_Dbl;
+    typedef profugus::Vector_Lite<Vec_Dbl, 2>        Face_Unknowns;
     //@}
 
     //! Low/High face enumeration.
@@ -68,6 +76,10 @@ class FV_Gather
     Face_Fields d_outgoing_I;
     Face_Fields d_outgoing_J;
 
+    // Incoming and outgoing face unknowns.
+    Face_Unknowns d_incoming_u_I, d_incoming_u_J;
+    Face_Unknowns d_outgoing_u_I, d_outgoing_u_J;
+
   public:
     // Constructor.
     FV_Gather(RCP_Mesh mesh, RCP_Moment_Coefficients coefficients,
@@ -76,12 +88,19 @@ class FV_Gather
     // Gather data for a given equation order.
     void gather(int eqn);
 
+    // Gather the unknowns of the face cells on neighboring blocks.
+    void gather(const double *u, int unknowns_per_cell);
+
     // >>> ACCESSORS
 
     // Get diffusion matrices on a given face.
     RCP_Face_Field low_side_D(int face) const;
     RCP_Face_Field high_side_D(int face) const;
 
+    // Get the unknowns on a given face (null if there is no neighbor).
+    const double* low_side_u(int face) const;
+    const double* high_side_u(int face) const;
+
   private:
     // >>> IMPLEMENTATION
 
@@ -121,6 +140,10 @@ class FV_Gather
     // Fill i,j face fields.
     void fill_I_face(int eqn, RCP_Face_Field field, int i);
     void fill_J_face(int eqn, RCP_Face_Field field, int j);
+
+    // Fill i,j face unknowns.
+    void fill_I_face(const double *u, int upc, Vec_Dbl &face, int i);
+    void fill_J_face(const double *u, int upc, Vec_Dbl &face, int j);
 };
 
 } // end namespace profugus
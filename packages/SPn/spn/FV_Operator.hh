@@ -0,0 +1,262 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/spn/FV_Operator.hh
+ * \author Thomas M. Evans
+ * \date   Fri Oct 16 09:12:44 2026
+ * \brief  FV_Operator class definition.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef SPn_spn_FV_Operator_hh
+#define SPn_spn_FV_Operator_hh
+
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_LAPACK.hpp"
+#include "AnasaziMultiVecTraits.hpp"
+
+#include "harness/DBC.hh"
+#include "utils/Vector_Lite.hh"
+#include "utils/Definitions.hh"
+#include "mesh/Mesh.hh"
+#include "mesh/LG_Indexer.hh"
+#include "xs/Mat_DB.hh"
+#include "FV_Bnd_Indexer.hh"
+#include "FV_Gather.hh"
+#include "Moment_Coefficients.hh"
+#include "OperatorAdapter.hh"
+
+namespace profugus
+{
+
+//===========================================================================//
+/*!
+ * \class FV_Operator
+ * \brief Apply the Cartesian finite-volume SPN operators without a matrix.
+ *
+ * The operator is applied one (equation, cell) block row at a time from the
+ * blocks stored by Moment_Coefficients, which are stored per material, so
+ * the memory does not grow with \f$N_g^2\f$ per cell as it does for
+ * Linear_System_FV matrices.  The rows are the same as the Linear_System_FV
+ * matrix rows, and the vectors have the same layout and map.
+ *
+ * The SPN operator couples a cell to its neighbors through
+ * \f[
+   \mathbf{C} = -\frac{2}{\Delta_c}\mathbf{D}_l
+   (\Delta_l\mathbf{D}_l + \Delta_r\mathbf{D}_r)^{-1}\mathbf{D}_r\:.
+ * \f]
+ * When both cells have the same material this is the scaled diffusion
+ * matrix \f$-2\mathbf{D}/(\Delta_c(\Delta_l+\Delta_r))\f$, so only the
+ * couplings across material interfaces and block (domain) boundaries are
+ * built and stored at construction.  The unknowns in neighboring blocks are
+ * gathered with FV_Gather on each apply.
+ *
+ * The fission operator is block-diagonal and is applied directly from the
+ * stored \f$\mathbf{F}_{nm}\f$ blocks; its boundary rows are zero.
+ *
+ * The Moment_Coefficients blocks of each material on the block are looked up
+ * once at construction, and each cell keeps the index of its material, so
+ * an apply does not search the Moment_Coefficients tables.
+ *
+ * The cells are divided among \c num_threads OpenMP threads.  The operators
+ * do not support transposes, so adjoint problems need the assembled
+ * matrices.
+ */
+/*!
+ * \example spn/test/tstLinear_System_FV.cc
+ *
+ * Test of FV_Operator.
+ */
+//===========================================================================//
+
+template <class T>
+class FV_Operator : public OperatorAdapter<T>
+{
+  public:
+    //@{
+    //! Typedefs.
+    typedef typename T::MV                          MV;
+    typedef typename T::MAP                         Map_t;
+    typedef Anasazi::MultiVecTraits<double, MV>     MVT;
+    typedef Moment_Coefficients::Serial_Matrix      Serial_Matrix;
+    typedef Teuchos::RCP<Moment_Coefficients>       RCP_Moment_Coefficients;
+    typedef Teuchos::RCP<Mat_DB>                    RCP_Mat_DB;
+    typedef Teuchos::RCP<Mesh>                      RCP_Mesh;
+    typedef Teuchos::RCP<LG_Indexer>                RCP_Indexer;
+    typedef Teuchos::RCP<FV_Bnd_Indexer>            RCP_Bnd_Indexer;
+    typedef std::vector<RCP_Bnd_Indexer>            Bnd_Indexers;
+    typedef profugus::Vector_Lite<def::Vec_Dbl, 3>  Widths;
+    //@}
+
+    //! Operators.
+    enum Operator_Type
+    {
+        SPN_OPERATOR = 0, //!< SPN (LHS) operator
+        FISSION           //!< fission (RHS) operator
+    };
+
+  private:
+    // >>> DATA
+
+    // Operator type.
+    Operator_Type d_type;
+
+    // Moment coefficients and materials.
+    RCP_Moment_Coefficients d_coefficients;
+    RCP_Mat_DB              d_mat;
+
+    // Mesh and indexer.
+    RCP_Mesh    d_mesh;
+    RCP_Indexer d_indexer;
+
+    // Gather of the unknowns in neighboring blocks.
+    Teuchos::RCP<FV_Gather> d_gather;
+
+  public:
+    // Constructor.
+    FV_Operator(Operator_Type type, Teuchos::RCP<const Map_t> map,
+                RCP_Moment_Coefficients coefficients, RCP_Mat_DB mat,
+                RCP_Mesh mesh, RCP_Indexer indexer, const Widths &widths,
+                const Bnd_Indexers &bnd_indexers, int num_threads);
+
+    // >>> ACCESSORS
+
+    //! Operator type.
+    Operator_Type type() const { return d_type; }
+
+    //! Number of stored coupling blocks (material interfaces and block
+    //! boundaries) for each equation.
+    int num_stored_blocks() const { return d_num_blocks; }
+
+  private:
+    // >>> IMPLEMENTATION
+
+    // Apply the operator.
+    void ApplyImpl(const MV &x, MV &y) const;
+
+    // Apply the operators to one vector.
+    void apply_spn(const double *x, double *y) const;
+    void apply_fission(const double *x, double *y) const;
+
+    // Add the coupling of a cell with a neighbor in a direction.
+    void add_face(int n, int i, int j, int k, int d, const Widths &widths,
+                  const Bnd_Indexers &bnd_indexers);
+
+    // Look up the Moment_Coefficients blocks of the local materials.
+    void build_material_blocks();
+
+    //! Diffusion matrix for equation n in a cell.
+    const Serial_Matrix& cell_D(int n, int cell) const
+    {
+        return *d_mat_D[d_cell_mat[cell] * d_Ne + n];
+    }
+
+    //! A-matrix block (n,m) in a cell.
+    const Serial_Matrix& cell_A(int n, int m, int cell) const
+    {
+        return *d_mat_A[(d_cell_mat[cell] * d_Ne + n) * d_Ne + m];
+    }
+
+    //! F fission matrix block (n,m) in a cell.
+    const Serial_Matrix& cell_F(int n, int m, int cell) const
+    {
+        return *d_mat_F[(d_cell_mat[cell] * d_Ne + n) * d_Ne + m];
+    }
+
+    // Make a stored coupling block.
+    void make_block(const Serial_Matrix &Dl, const Serial_Matrix &Dr,
+                    double delta_l, double delta_r, double delta_c,
+                    double *block);
+
+    //! Add \f$a\mathbf{M}x\f$ to y for a (Ng x Ng) column-major block.
+    static void multiply(int Ng, int stride, double a, const double *M,
+                         const double *x, double *y)
+    {
+        for (int gp = 0; gp < Ng; ++gp)
+        {
+            const double  ax  = a * x[gp];
+            const double *col = M + gp * stride;
+            for (int g = 0; g < Ng; ++g)
+            {
+                y[g] += col[g] * ax;
+            }
+        }
+    }
+
+    // Sources of neighbor unknowns.
+    enum Face_Source
+    {
+        NO_NEIGHBOR = 0, // reflecting boundary
+        CELL,            // local cell
+        BOUNDARY,        // local boundary unknown
+        GHOST            // face cell in a neighboring block
+    };
+
+    // Coupling of a cell with a neighbor; the coupling block is the cell
+    // diffusion matrix times scale, or a stored block if block >= 0.
+    struct Face
+    {
+        int    source;   // Face_Source
+        int    neighbor; // local cell, boundary unknown, or ghost face cell
+        int    block;    // stored block index or -1
+        double scale;    // diffusion-matrix scale
+    };
+
+    // Coupling of a boundary unknown with its volume cell.
+    struct Bnd_Face
+    {
+        int    cell;  // local cell
+        double scale; // diffusion-matrix scale
+    };
+
+    // Problem sizes.
+    int d_Ng, d_Ne, d_Nc;
+
+    // Local dimensions of the mesh and global cell offsets in (i,j).
+    int d_N[3], d_offset[2];
+
+    // Last global cell index in each dimension.
+    int d_last[3];
+
+    // Local block-size of volume and boundary unknowns.
+    int d_Nv_local, d_Nb_local;
+
+    // Faces of each cell (-x,+x,-y,+y,-z,+z).
+    std::vector<Face> d_faces;
+
+    // Boundary unknowns.
+    std::vector<Bnd_Face> d_bnd_faces;
+
+    // Local material index of each cell.
+    def::Vec_Int d_cell_mat;
+
+    // Moment_Coefficients blocks of each local material; D and A are only
+    // set for the SPN operator and F for the fission operator.
+    std::vector<const Serial_Matrix *> d_mat_D, d_mat_A, d_mat_F;
+
+    // Stored coupling blocks, d_Ne blocks of (Ng x Ng) for each coupling.
+    def::Vec_Dbl d_blocks;
+    int          d_num_blocks;
+
+    // B-matrix coefficients.
+    double d_B[4][4];
+
+    // Number of threads.
+    int d_num_threads;
+
+    // LAPACK object and work space.
+    Teuchos::LAPACK<int, double> d_lapack;
+    Serial_Matrix                d_S, d_W;
+    def::Vec_Dbl                 d_work;
+    def::Vec_Int                 d_ipiv;
+};
+
+} // end namespace profugus
+
+#endif // SPn_spn_FV_Operator_hh
+
+//---------------------------------------------------------------------------//
+//                 end of FV_Operator.hh
+//---------------------------------------------------------------------------//
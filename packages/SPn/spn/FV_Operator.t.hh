@@ -0,0 +1,605 @@
+//----------------------------------*-C++-*----------------------------------//
+/*!
+ * \file   SPn/spn/FV_Operator.t.hh
+ * \author Thomas M. Evans
+ * \date   Fri Oct 16 09:12:44 2026
+ * \brief  FV_Operator template member definitions.
+ * \note   Copyright (C) 2026 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef SPn_spn_FV_Operator_t_hh
+#define SPn_spn_FV_Operator_t_hh
+
+#include <algorithm>
+#include <map>
+
+#include "FV_Operator.hh"
+#include "VectorTraits.hh"
+
+namespace profugus
+{
+
+//---------------------------------------------------------------------------//
+// CONSTRUCTOR
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Constructor.
+ *
+ * \param type operator type
+ * \param map map of the Linear_System_FV vectors
+ * \param coefficients moment coefficients
+ * \param mat material database
+ * \param mesh local mesh
+ * \param indexer L-G indexer
+ * \param widths global cell widths in each dimension
+ * \param bnd_indexers boundary indexers of the faces (-x,+x,-y,+y,-z,+z),
+ * null if there are no boundary unknowns on a face
+ * \param num_threads number of threads used to apply the operator
+ */
+template <class T>
+FV_Operator<T>::FV_Operator(Operator_Type             type,
+                            Teuchos::RCP<const Map_t> map,
+                            RCP_Moment_Coefficients   coefficients,
+                            RCP_Mat_DB                mat,
+                            RCP_Mesh                  mesh,
+                            RCP_Indexer               indexer,
+                            const Widths             &widths,
+                            const Bnd_Indexers       &bnd_indexers,
+                            int                       num_threads)
+    : OperatorAdapter<T>(map)
+    , d_type(type)
+    , d_coefficients(coefficients)
+    , d_mat(mat)
+    , d_mesh(mesh)
+    , d_indexer(indexer)
+    , d_gather(Teuchos::rcp(new FV_Gather(mesh, coefficients, *indexer)))
+    , d_Ng(coefficients->num_groups())
+    , d_Ne(coefficients->num_equations())
+    , d_Nc(mesh->num_cells())
+    , d_Nv_local(d_Nc * d_Ne * d_Ng)
+    , d_Nb_local(0)
+    , d_num_blocks(0)
+    , d_num_threads(num_threads)
+    , d_S(d_Ng, d_Ng)
+    , d_W(d_Ng, d_Ng)
+    , d_work(d_Ng)
+    , d_ipiv(d_Ng)
+{
+    using def::I; using def::J; using def::K;
+
+    REQUIRE(!mat.is_null());
+    REQUIRE(!indexer.is_null());
+    REQUIRE(bnd_indexers.size() == 6);
+    REQUIRE(num_threads > 0);
+
+    // local mesh dimensions and offsets
+    d_N[I]      = mesh->num_cells_dim(I);
+    d_N[J]      = mesh->num_cells_dim(J);
+    d_N[K]      = mesh->num_cells_dim(K);
+    d_offset[I] = indexer->offset(I);
+    d_offset[J] = indexer->offset(J);
+
+    // last global cell indices (all of K is on each block)
+    d_last[I] = indexer->num_global(I) - 1;
+    d_last[J] = indexer->num_global(J) - 1;
+    d_last[K] = d_N[K] - 1;
+    CHECK(static_cast<int>(widths[I].size()) == d_last[I] + 1);
+    CHECK(static_cast<int>(widths[J].size()) == d_last[J] + 1);
+    CHECK(static_cast<int>(widths[K].size()) == d_last[K] + 1);
+
+    // number of local boundary unknowns (blocks)
+    int num_bnd = 0;
+    for (const auto &b : bnd_indexers)
+    {
+        if (!b.is_null())
+            num_bnd += b->num_local();
+    }
+    d_Nb_local = num_bnd * d_Ne * d_Ng;
+    CHECK(VectorTraits<T>::local_size(map) == d_Nv_local + d_Nb_local);
+
+    // blocks of the local materials
+    build_material_blocks();
+
+    // the fission operator has no spatial coupling
+    if (d_type == FISSION)
+        return;
+
+    // B-matrix coefficients (the B blocks are diagonal)
+    Serial_Matrix B(d_Ng, d_Ng);
+    for (int n = 0; n < d_Ne; ++n)
+    {
+        for (int m = 0; m < d_Ne; ++m)
+        {
+            d_coefficients->make_B(n, m, B);
+            d_B[n][m] = B(0, 0);
+        }
+    }
+
+    // make the faces of each cell
+    d_faces.resize(6 * d_Nc);
+    d_bnd_faces.resize(num_bnd);
+    for (int n = 0; n < d_Ne; ++n)
+    {
+        // gather the diffusion matrices of the face cells on neighboring
+        // blocks for this equation
+        d_gather->gather(n);
+
+        for (int k = 0; k < d_N[K]; ++k)
+        {
+            for (int j = 0; j < d_N[J]; ++j)
+            {
+                for (int i = 0; i < d_N[I]; ++i)
+                {
+                    for (int d = 0; d < 6; ++d)
+                    {
+                        add_face(n, i, j, k, d, widths, bnd_indexers);
+                    }
+                }
+            }
+        }
+    }
+
+    ENSURE(static_cast<int>(d_blocks.size()) ==
+           d_num_blocks * d_Ne * d_Ng * d_Ng);
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Apply the operator to each vector.
+ */
+template <class T>
+void FV_Operator<T>::ApplyImpl(const MV &x,
+                                     MV &y) const
+{
+    REQUIRE(MVT::GetNumberVecs(x) == MVT::GetNumberVecs(y));
+
+    for (int v = 0, Nv = MVT::GetNumberVecs(x); v < Nv; ++v)
+    {
+        Teuchos::ArrayRCP<const double> x_data =
+            VectorTraits<T>::get_data(Teuchos::rcpFromRef(x), v);
+        Teuchos::ArrayRCP<double> y_data =
+            VectorTraits<T>::get_data_nonconst(Teuchos::rcpFromRef(y), v);
+        CHECK(static_cast<int>(x_data.size()) == d_Nv_local + d_Nb_local);
+        CHECK(static_cast<int>(y_data.size()) == d_Nv_local + d_Nb_local);
+
+        if (d_type == SPN_OPERATOR)
+            apply_spn(x_data.get(), y_data.get());
+        else
+            apply_fission(x_data.get(), y_data.get());
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Apply the SPN operator to one vector.
+ *
+ * The volume rows of equation \e n in cell \e c are
+ * \f[
+   y_n(c) = \sum_m\mathbf{A}_{nm}x_m(c) +
+            \sum_f\mathbf{C}_f\bigl(x_n(f) - x_n(c)\bigr)\:,
+ * \f]
+ * where \e f are the neighbor cells and boundary unknowns, and the boundary
+ * rows are
+ * \f[
+   y_n(b) = \sum_m\mathbf{B}_{nm}x_m(b) +
+            \mathbf{C}_b\bigl(x_n(c) - x_n(b)\bigr)\:.
+ * \f]
+ */
+template <class T>
+void FV_Operator<T>::apply_spn(const double *x,
+                               double       *y) const
+{
+    using def::I; using def::J;
+
+    // unknowns per cell and size of a block
+    const int Ng  = d_Ng;
+    const int upc = d_Ne * d_Ng;
+    const int bs  = d_Ng * d_Ng;
+
+    // gather the unknowns of the face cells on neighboring blocks
+    d_gather->gather(x, upc);
+    const double *ghost[4] = {d_gather->low_side_u(I),
+                              d_gather->high_side_u(I),
+                              d_gather->low_side_u(J),
+                              d_gather->high_side_u(J)};
+
+#pragma omp parallel num_threads(d_num_threads)
+    {
+        // difference of neighbor and cell unknowns
+        def::Vec_Dbl w(Ng);
+
+        // >>> VOLUME EQUATIONS
+
+#pragma omp for
+        for (int cell = 0; cell < d_Nc; ++cell)
+        {
+            const double *x_c   = x + cell * upc;
+            double       *y_c   = y + cell * upc;
+            const Face   *faces = &d_faces[6 * cell];
+
+            for (int n = 0; n < d_Ne; ++n)
+            {
+                double *y_n = y_c + n * Ng;
+                std::fill(y_n, y_n + Ng, 0.0);
+
+                // within-cell coupling with the moment equations
+                for (int m = 0; m < d_Ne; ++m)
+                {
+                    const Serial_Matrix &A = cell_A(n, m, cell);
+                    multiply(Ng, A.stride(), 1.0, A.values(), x_c + m * Ng,
+                             y_n);
+                }
+
+                // spatial coupling with the neighbors
+                const Serial_Matrix &D = cell_D(n, cell);
+                for (int d = 0; d < 6; ++d)
+                {
+                    const Face &f = faces[d];
+
+                    // unknowns of the neighbor
+                    const double *x_f = nullptr;
+                    if (f.source == NO_NEIGHBOR)
+                        continue;
+                    else if (f.source == CELL)
+                        x_f = x + f.neighbor * upc;
+                    else if (f.source == BOUNDARY)
+                        x_f = x + d_Nv_local + f.neighbor * upc;
+                    else
+                        x_f = ghost[d] + f.neighbor * upc;
+                    CHECK(x_f);
+
+                    for (int g = 0; g < Ng; ++g)
+                    {
+                        w[g] = x_f[n * Ng + g] - x_c[n * Ng + g];
+                    }
+
+                    if (f.block < 0)
+                    {
+                        multiply(Ng, D.stride(), f.scale, D.values(), &w[0],
+                                 y_n);
+                    }
+                    else
+                    {
+                        multiply(Ng, Ng, 1.0,
+                                 &d_blocks[(f.block * d_Ne + n) * bs], &w[0],
+                                 y_n);
+                    }
+                }
+            }
+        }
+
+        // >>> BOUNDARY EQUATIONS
+
+#pragma omp for
+        for (int b = 0; b < static_cast<int>(d_bnd_faces.size()); ++b)
+        {
+            const Bnd_Face &f   = d_bnd_faces[b];
+            const double   *x_b = x + d_Nv_local + b * upc;
+            double         *y_b = y + d_Nv_local + b * upc;
+            const double   *x_c = x + f.cell * upc;
+
+            for (int n = 0; n < d_Ne; ++n)
+            {
+                double *y_n = y_b + n * Ng;
+
+                // moment coupling (the B blocks are diagonal)
+                for (int g = 0; g < Ng; ++g)
+                {
+                    y_n[g] = 0.0;
+                    for (int m = 0; m < d_Ne; ++m)
+                    {
+                        y_n[g] += d_B[n][m] * x_b[m * Ng + g];
+                    }
+                }
+
+                // coupling with the volume cell
+                for (int g = 0; g < Ng; ++g)
+                {
+                    w[g] = x_c[n * Ng + g] - x_b[n * Ng + g];
+                }
+                const Serial_Matrix &D = cell_D(n, f.cell);
+                multiply(Ng, D.stride(), f.scale, D.values(), &w[0], y_n);
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Apply the fission operator to one vector.
+ */
+template <class T>
+void FV_Operator<T>::apply_fission(const double *x,
+                                   double       *y) const
+{
+    const int Ng  = d_Ng;
+    const int upc = d_Ne * d_Ng;
+
+#pragma omp parallel for num_threads(d_num_threads)
+    for (int cell = 0; cell < d_Nc; ++cell)
+    {
+        const double *x_c = x + cell * upc;
+        double       *y_c = y + cell * upc;
+
+        for (int n = 0; n < d_Ne; ++n)
+        {
+            double *y_n = y_c + n * Ng;
+            std::fill(y_n, y_n + Ng, 0.0);
+
+            for (int m = 0; m < d_Ne; ++m)
+            {
+                const Serial_Matrix &F = cell_F(n, m, cell);
+                multiply(Ng, F.stride(), 1.0, F.values(), x_c + m * Ng, y_n);
+            }
+        }
+    }
+
+    // there is no fission in the boundary equations
+    std::fill(y + d_Nv_local, y + d_Nv_local + d_Nb_local, 0.0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Add the coupling of a cell with its neighbor in a direction.
+ *
+ * The face is defined on the first equation; the stored coupling blocks are
+ * made for every equation.  The coupling is the same as
+ * Linear_System_FV::add_spatial_element() and
+ * Linear_System_FV::build_bnd_element().
+ *
+ * \param n equation
+ * \param i,j,k local cell indices
+ * \param d direction in the range \c [0,5] corresponding to
+ * \c -x,+x,-y,+y,-z,+z
+ */
+template <class T>
+void FV_Operator<T>::add_face(int                 n,
+                              int                 i,
+                              int                 j,
+                              int                 k,
+                              int                 d,
+                              const Widths       &widths,
+                              const Bnd_Indexers &bnd_indexers)
+{
+    using def::I; using def::J; using def::K;
+
+    REQUIRE(d >= 0 && d < 6);
+
+    // direction and side
+    int  axis = d / 2;
+    bool high = d % 2;
+
+    // local and global cell indices
+    int l[3] = {i, j, k};
+    int g[3] = {i + d_offset[I], j + d_offset[J], k};
+
+    // the face of the cell
+    int   cell = d_indexer->l2l(i, j, k);
+    Face &face = d_faces[d + 6 * cell];
+
+    // (abscissa, ordinate) of the cell on a face normal to the direction
+    int a = axis == I ? j : i;
+    int o = axis == K ? j : k;
+
+    // cell width
+    double delta_c = widths[axis][g[axis]];
+
+    // >>> PROBLEM BOUNDARY
+
+    if (high ? g[axis] == d_last[axis] : g[axis] == 0)
+    {
+        if (n > 0)
+            return;
+
+        const RCP_Bnd_Indexer &bnd = bnd_indexers[d];
+        if (bnd.is_null())
+        {
+            face.source   = NO_NEIGHBOR;
+            face.neighbor = -1;
+            face.block    = -1;
+            face.scale    = 0.0;
+            return;
+        }
+
+        // boundary unknown
+        int b = bnd->local(a, o);
+        CHECK(b >= 0 && b < static_cast<int>(d_bnd_faces.size()));
+
+        face.source   = BOUNDARY;
+        face.neighbor = b;
+        face.block    = -1;
+        face.scale    = -2.0 / (delta_c * delta_c);
+
+        d_bnd_faces[b].cell  = cell;
+        d_bnd_faces[b].scale = -2.0 / delta_c;
+        return;
+    }
+
+    // >>> NEIGHBOR CELL
+
+    // left and right widths
+    double delta_n = widths[axis][g[axis] + (high ? 1 : -1)];
+    double delta_l = high ? delta_c : delta_n;
+    double delta_r = high ? delta_n : delta_c;
+
+    // cell diffusion matrix
+    const Serial_Matrix &D = cell_D(n, cell);
+
+    // neighbor on this block
+    if (high ? l[axis] < d_N[axis] - 1 : l[axis] > 0)
+    {
+        l[axis] += high ? 1 : -1;
+        int neighbor = d_indexer->l2l(l[I], l[J], l[K]);
+
+        // the coupling is the scaled diffusion matrix unless the cells have
+        // different materials
+        if (n == 0)
+        {
+            face.source   = CELL;
+            face.neighbor = neighbor;
+            face.block    = -1;
+            face.scale    = -2.0 / (delta_c * (delta_l + delta_r));
+
+            if (d_mat->matid(cell) != d_mat->matid(neighbor))
+            {
+                face.block = d_num_blocks++;
+                d_blocks.resize(d_num_blocks * d_Ne * d_Ng * d_Ng);
+            }
+        }
+
+        if (face.block >= 0)
+        {
+            const Serial_Matrix &D_n = cell_D(n, neighbor);
+            make_block(high ? D_n : D, high ? D : D_n, delta_l, delta_r,
+                       delta_c,
+                       &d_blocks[(face.block * d_Ne + n) * d_Ng * d_Ng]);
+        }
+    }
+
+    // neighbor on another block
+    else
+    {
+        CHECK(axis != K);
+
+        // the neighbor diffusion matrix is a *view* into the gathered field
+        FV_Gather::RCP_Face_Field field = high ? d_gather->high_side_D(axis)
+                                               : d_gather->low_side_D(axis);
+        CHECK(!field.is_null());
+        Serial_Matrix D_n = field->view(a, o);
+
+        if (n == 0)
+        {
+            face.source   = GHOST;
+            face.neighbor = a + o * field->abscissa();
+            face.block    = d_num_blocks++;
+            face.scale    = 0.0;
+            d_blocks.resize(d_num_blocks * d_Ne * d_Ng * d_Ng);
+        }
+
+        make_block(high ? D_n : D, high ? D : D_n, delta_l, delta_r, delta_c,
+                   &d_blocks[(face.block * d_Ne + n) * d_Ng * d_Ng]);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Look up the Moment_Coefficients blocks of the local materials.
+ *
+ * Each distinct material on the block gets a local index, and pointers to
+ * its stored blocks are kept in order of that index.  The blocks are owned by
+ * the Moment_Coefficients, which this operator holds.
+ */
+template <class T>
+void FV_Operator<T>::build_material_blocks()
+{
+    // local index of each material, and a cell of each material
+    std::map<int, int> local;
+    def::Vec_Int       mat_cell;
+
+    d_cell_mat.resize(d_Nc);
+    for (int cell = 0; cell < d_Nc; ++cell)
+    {
+        const int index = local.size();
+        auto      itr   = local.insert(std::make_pair(d_mat->matid(cell),
+                                                      index));
+        if (itr.second)
+            mat_cell.push_back(cell);
+        d_cell_mat[cell] = itr.first->second;
+    }
+
+    const int Nm = mat_cell.size();
+    CHECK(static_cast<int>(local.size()) == Nm);
+
+    if (d_type == SPN_OPERATOR)
+    {
+        d_mat_D.resize(Nm * d_Ne);
+        d_mat_A.resize(Nm * d_Ne * d_Ne);
+    }
+    else
+    {
+        d_mat_F.resize(Nm * d_Ne * d_Ne);
+    }
+
+    for (int l = 0; l < Nm; ++l)
+    {
+        const int cell = mat_cell[l];
+        for (int n = 0; n < d_Ne; ++n)
+        {
+            if (d_type == SPN_OPERATOR)
+                d_mat_D[l * d_Ne + n] = &d_coefficients->D(n, cell);
+
+            for (int m = 0; m < d_Ne; ++m)
+            {
+                if (d_type == SPN_OPERATOR)
+                {
+                    d_mat_A[(l * d_Ne + n) * d_Ne + m] =
+                        &d_coefficients->A(n, m, cell);
+                }
+                else
+                {
+                    d_mat_F[(l * d_Ne + n) * d_Ne + m] =
+                        &d_coefficients->F(n, m, cell);
+                }
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Make a stored coupling block.
+ *
+ * \param Dl left-diffusion matrix
+ * \param Dr right-diffusion matrix
+ * \param delta_l left-width
+ * \param delta_r right-width
+ * \param delta_c cell-width (will equal delta_l or delta_r)
+ * \param block on return, the (Ng x Ng) column-major coupling block
+ */
+template <class T>
+void FV_Operator<T>::make_block(const Serial_Matrix &Dl,
+                                const Serial_Matrix &Dr,
+                                double               delta_l,
+                                double               delta_r,
+                                double               delta_c,
+                                double              *block)
+{
+    REQUIRE(delta_c > 0.0);
+
+    // view of the block
+    Serial_Matrix C(Teuchos::View, block, d_Ng, d_Ng, d_Ng);
+
+    // make the sum term (delta_l * Dl + delta_r * Dr)
+    d_S.assign(Dl);
+    d_S *= delta_l;
+
+    d_W.assign(Dr);
+    d_W *= delta_r;
+
+    d_S += d_W;
+
+    // invert
+    int info = 0;
+    d_lapack.GETRF(d_Ng, d_Ng, d_S.values(), d_S.stride(), &d_ipiv[0],
+                   &info);
+    CHECK(info == 0);
+    d_lapack.GETRI(d_Ng, d_S.values(), d_S.stride(), &d_ipiv[0], &d_work[0],
+                   d_Ng, &info);
+    CHECK(info == 0);
+
+    // C = -2/delta_c * Dl * (S^-1 * Dr)
+    d_W.multiply(Teuchos::NO_TRANS, Teuchos::NO_TRANS, 1.0, d_S, Dr, 0.0);
+    C.multiply(Teuchos::NO_TRANS, Teuchos::NO_TRANS, 1.0, Dl, d_W, 0.0);
+    C *= -2.0 / delta_c;
+}
+
+} // end namespace profugus
+
+#endif // SPn_spn_FV_Operator_t_hh
+
+//---------------------------------------------------------------------------//
+//                 end of FV_Operator.t.hh
+//---------------------------------------------------------------------------//
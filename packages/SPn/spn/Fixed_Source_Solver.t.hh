@@ -64,7 +64,8 @@ void Fixed_Source_Solver<T>::setup(RCP_Dimensions  dim,
     // build the linear system (we only provide finite volume for now)
     std::string &eqn_type = b_db->get("eqn_type", std::string("fv"));
 
-    if (profugus::lower(eqn_type) == "fv")
+    if (profugus::lower(eqn_type) == "fv" ||
+        profugus::lower(eqn_type) == "fv_mf")
     {
         b_system = Teuchos::rcp(
             new Linear_System_FV<T>(
@@ -169,9 +169,13 @@ void Linear_System<EpetraTypes>::set_adjoint(bool adjoint)
         ENSURE(Teuchos::nonnull(b_adjoint_fission));
     }
 
-    // set the regular operators transpose flag
-    b_operator->SetUseTranspose(b_adjoint);
-    b_fission->SetUseTranspose(b_adjoint);
+    // set the regular operators transpose flag; operators that cannot be
+    // transposed (matrix-free) would silently apply the forward operator
+    int op_err  = b_operator->SetUseTranspose(b_adjoint);
+    int fis_err = b_fission->SetUseTranspose(b_adjoint);
+    INSIST(!b_adjoint || (op_err == 0 && fis_err == 0),
+           "Adjoint requires operators that support transposes; use an "
+           "assembled matrix (eqn_type fv).");
 }
 
 } // end namespace profugus
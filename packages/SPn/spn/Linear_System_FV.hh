@@ -32,6 +32,19 @@ namespace profugus
  * \class Linear_System_FV
  * \brief Build a linear SPN system based on a Cartesian Finite-Volume
  * discretization.
+ *
+ * The matrices are assembled in two passes.  First, the rows of every cell
+ * are built into a row buffer; the cells are divided among \c num_threads
+ * (default 1) OpenMP threads, each with its own work matrices, and the rows
+ * of a cell are only written by the thread that owns it.  Second, a static
+ * graph is made from the buffered rows and the matrix values are summed into
+ * it on one thread, since neither Epetra nor Tpetra guarantee that filling a
+ * matrix is thread-safe.  The matrices are independent of the number of
+ * threads.
+ *
+ * If the \c eqn_type is \c "fv_mf" the matrices are not built; the operator
+ * and fission matrix are FV_Operator objects that apply the same rows from
+ * the blocks stored in Moment_Coefficients, and get_Matrix() returns null.
  */
 /*!
  * \example spn/test/tstLinear_System_FV.cc
@@ -144,29 +157,81 @@ class Linear_System_FV : public Linear_System<T>
     void map_bnd_l2g(RCP_Bnd_Indexer indexer, int N_abscissa, int N_ordinate,
                      Vec_Int &l2g);
 
+    // Work matrices and LAPACK arrays used to build the blocks of a row;
+    // each assembly thread has its own.
+    struct Work_Space
+    {
+        Serial_Matrix D_c;  // diffusion matrix in local cell for moment n
+        Serial_Matrix C_c;  // local cell matrix coefficient
+        Serial_Matrix C;    // matrix coefficient from neighbor cell
+        Serial_Matrix W;    // work matrix
+        def::Vec_Dbl  work; // LAPACK work array
+        def::Vec_Int  ipiv; // LAPACK pivots
+        int           info; // LAPACK return code
+
+        explicit Work_Space(int Ng)
+            : D_c(Ng, Ng), C_c(Ng, Ng), C(Ng, Ng), W(Ng, Ng)
+            , work(Ng), ipiv(Ng), info(0)
+        {
+        }
+    };
+
+    // Matrix rows, indexed by local row, that are assembled before the
+    // matrix graph is made; row r holds up to capacity(r) (global column,
+    // value) entries starting at offsets[r].
+    struct Row_Buffer
+    {
+        Vec_Int offsets;
+        Vec_Int count;
+        Vec_Int columns;
+        Vec_Dbl values;
+
+        explicit Row_Buffer(const Vec_Int &capacities)
+            : offsets(capacities.size() + 1, 0)
+            , count(capacities.size(), 0)
+        {
+            for (int row = 0, N = capacities.size(); row < N; ++row)
+                offsets[row + 1] = offsets[row] + capacities[row];
+            columns.resize(offsets.back());
+            values.resize(offsets.back());
+        }
+
+        int capacity(int row) const { return offsets[row + 1] - offsets[row]; }
+    };
+
+    // Number of neighbor cells and boundary unknowns coupled to a cell.
+    int num_face_couplings(int g_i, int g_j, int k) const;
+
     // Insert spatially coupled elements.
     void spatial_coupled_element(int n, int i, int j, int k, int g_i, int g_j,
-                                 RCP_Face_Field Dx_low, RCP_Face_Field Dx_high,
-                                 RCP_Face_Field Dy_low, RCP_Face_Field Dy_high);
+                                 const RCP_Face_Field &Dx_low,
+                                 const RCP_Face_Field &Dx_high,
+                                 const RCP_Face_Field &Dy_low,
+                                 const RCP_Face_Field &Dy_high,
+                                 Work_Space &ws, Row_Buffer &rows);
 
     // Add spatial element to the matrix.
     void add_spatial_element(int eqn, int row_cell, int col_cell,
                              double delta_l, double delta_r, double delta_c,
-                             const Serial_Matrix &Dl, const Serial_Matrix &Dr);
+                             const Serial_Matrix &Dl, const Serial_Matrix &Dr,
+                             Work_Space &ws, Row_Buffer &rows);
 
     // Add boundary element to matrix.
-    void build_bnd_element(int eqn, int global_row, int global_col,
-                           double delta_c);
+    void build_bnd_element(int eqn, int row_cell, int global_col,
+                           double delta_c, Work_Space &ws, Row_Buffer &rows);
 
     // Add boundary equations to the matrix.
-    void add_boundary_equations(int face, int global_cell, int local_cell,
-                                double delta_c);
+    void add_boundary_equations(int face, int local_face, int global_cell,
+                                int local_cell, double delta_c,
+                                Work_Space &ws, Row_Buffer &rows);
 
-    // Insert a block matrix (GXG) into the matrix.
+    // Insert a block matrix (GXG) into the row buffer.
     void insert_block_matrix(int row_n, int row_cell, int row_off,
                              int col_m, int col_cell, int col_off,
-                             const Serial_Matrix &M,
-                             Teuchos::RCP<Matrix_t> matrix);
+                             const Serial_Matrix &M, Row_Buffer &rows) const;
+
+    // Make a matrix on a static graph from the buffered rows.
+    Teuchos::RCP<Matrix_t> fill_matrix(const Row_Buffer &rows) const;
 
     // Gather object.
     FV_Gather d_gather;
@@ -204,33 +269,20 @@ class Linear_System_FV : public Linear_System<T>
     // global/local faces if vacuum/source
     int d_bc_global[6], d_bc_local[6];
 
-    // Serial work matrices.
-    Serial_Matrix d_D_c; // diffusion matrix in local cell for moment n
-    Serial_Matrix d_C_c; // local cell matrix coefficient
-    Serial_Matrix d_D;   // diffusion matrix in a neighbor cell for moment n
-    Serial_Matrix d_C;   // matrix coefficient from neighbor cell
-    Serial_Matrix d_W;   // work matrix
+    // Number of threads used to assemble the matrices.
+    int d_num_threads;
+
+    // Apply the operators without building matrices.
+    bool d_matrix_free;
+
+    // Work space for each assembly thread.
+    std::vector<Work_Space> d_work_space;
 
     // Global cell widths by dimension.
     profugus::Vector_Lite<def::Vec_Dbl, 3> d_widths;
 
     // LAPACK object.
     Teuchos::LAPACK<int, double> d_lapack;
-
-    // LAPACK work arrays.
-    def::Vec_Dbl d_work;
-    def::Vec_Int d_ipiv;
-    int          d_info;
-
-    // Indices used to make matrix rows.
-    Teuchos::ArrayRCP<int> d_indices;
-                       // the max will always be (6 (coupled cells) + 4
-                       // (number of equations)) X number of groups; however
-                       // we only insert one G x G block at a time, so this is
-                       // set to G
-
-    // Values for a matrix row.
-    Teuchos::ArrayRCP<double> d_values;
 };
 
 //---------------------------------------------------------------------------//
@@ -11,11 +11,15 @@
 #ifndef SPn_spn_Linear_System_FV_t_hh
 #define SPn_spn_Linear_System_FV_t_hh
 
+#include "harness/Warnings.hh"
 #include "comm/global.hh"
+#include "comm/OMP.hh"
 #include "comm/P_Stream.hh"
 #include "utils/Constants.hh"
+#include "utils/String_Functions.hh"
 
 #include "Linear_System_FV.hh"
+#include "FV_Operator.hh"
 
 #include "MatrixTraits.hh"
 #include "VectorTraits.hh"
@@ -61,16 +65,12 @@ Linear_System_FV<T>::Linear_System_FV(RCP_ParameterList db,
     , d_last_K(d_G[def::K] - 1)
     , d_Nb_global(0)
     , d_Nb_local(0)
-    , d_D_c(d_Ng, d_Ng)
-    , d_C_c(d_Ng, d_Ng)
-    , d_D(d_Ng, d_Ng)
-    , d_C(d_Ng, d_Ng)
-    , d_W(d_Ng, d_Ng)
+    , d_num_threads(db->get("num_threads", 1))
+    , d_matrix_free(profugus::lower(db->get("eqn_type", std::string("fv")))
+                    == "fv_mf")
     , d_widths(Vec_Dbl(data->num_cells(def::I)),
                Vec_Dbl(data->num_cells(def::J)),
                Vec_Dbl(data->num_cells(def::K)))
-    , d_work(d_Ng)
-    , d_ipiv(d_Ng)
 {
     using def::I; using def::J; using def::K;
 
@@ -89,6 +89,18 @@ Linear_System_FV<T>::Linear_System_FV(RCP_ParameterList db,
     INSIST(indexer->num_sets() == 1,
            "Only support 1-set decomposition in SPN.");
 
+    // make the work space for each assembly thread
+    VALIDATE(d_num_threads > 0, "Number of threads must be positive, "
+             << d_num_threads << " requested.");
+    if (d_num_threads > 1 && !profugus::multithreading_available())
+    {
+        ADD_WARNING("Multithreading is not available in this build, "
+                    << "assembling the SPN matrices on 1 thread instead of "
+                    << d_num_threads);
+        d_num_threads = 1;
+    }
+    d_work_space.resize(d_num_threads, Work_Space(d_Ng));
+
     // make the global cell widths
     for (int d = 0; d < def::END_IJK; ++d)
     {
@@ -177,14 +189,6 @@ Linear_System_FV<T>::Linear_System_FV(RCP_ParameterList db,
     // make the map
     b_map = MatrixTraits<T>::build_map(N_local,N_global,l2g);
 
-    // allocate space for the number of potential non-zero indices per row;
-    // the matrix bandwidth (entries per row) is the (number of equations +
-    // the number of spatially coupled cells) X the number of groups,
-    // ie. (num-equations + 6) * Ng -> HOWEVER, we only ever insert at most 1
-    // GXG block at a time, so this can be sized by G
-    d_indices.resize(d_Ng);
-    d_values.resize(d_Ng);
-
     // make the RHS vector
     b_rhs = VectorTraits<T>::build_vector(b_map);
 }
@@ -202,13 +206,20 @@ void Linear_System_FV<T>::build_Matrix()
 
     REQUIRE(!d_mesh.is_null());
     REQUIRE(!d_indexer.is_null());
+    REQUIRE(static_cast<int>(d_work_space.size()) == d_num_threads);
 
-    // make the matrix
-    d_matrix   = MatrixTraits<T>::construct_matrix(b_map,d_Ng);
-    b_operator = d_matrix;
+    // apply the operator from the stored blocks
+    if (d_matrix_free)
+    {
+        d_matrix   = Teuchos::null;
+        b_operator = Teuchos::rcp(new FV_Operator<T>(
+            FV_Operator<T>::SPN_OPERATOR, b_map, b_mom_coeff, b_mat, d_mesh,
+            d_indexer, d_widths, d_bnd_index, d_num_threads));
 
-    // off-processor face fields of diffusion coefficients
-    RCP_Face_Field Dx_low, Dx_high, Dy_low, Dy_high;
+        profugus::pout << ">>> Built matrix-free SPN FV Element LHS Operator"
+                       << profugus::endl;
+        return;
+    }
 
     // reference to indexer
     const LG_Indexer &index = *d_indexer;
@@ -217,8 +228,38 @@ void Linear_System_FV<T>::build_Matrix()
     int i_off = index.offset(I);
     int j_off = index.offset(J);
 
-    // global i,j and cell
-    int g_i = 0, g_j = 0, global = 0;
+    // size the rows from the stencil: a volume row is coupled to the
+    // equations in its cell and to its neighboring cells and boundary
+    // faces; a boundary row is coupled to the equations on its face and to
+    // its cell
+    Vec_Int capacities(d_Nv_local + d_Nb_local, (d_Ne + 1) * d_Ng);
+    for (int k = 0; k < d_N[K]; ++k)
+    {
+        for (int j = 0; j < d_N[J]; ++j)
+        {
+            for (int i = 0; i < d_N[I]; ++i)
+            {
+                int local  = index.l2l(i, j, k);
+                int blocks =
+                    d_Ne + num_face_couplings(i + i_off, j + j_off, k);
+
+                for (int eqn = 0; eqn < d_Ne; ++eqn)
+                {
+                    for (int g = 0; g < d_Ng; ++g)
+                    {
+                        capacities[this->index(g, eqn, local)] =
+                            blocks * d_Ng;
+                    }
+                }
+            }
+        }
+    }
+
+    // rows of the matrix on this domain
+    Row_Buffer rows(capacities);
+
+    // off-processor face fields of diffusion coefficients
+    RCP_Face_Field Dx_low, Dx_high, Dy_low, Dy_high;
 
     // >>> VOLUME EQUATIONS
 
@@ -235,46 +276,52 @@ void Linear_System_FV<T>::build_Matrix()
         Dx_high = d_gather.high_side_D(I);
         Dy_high = d_gather.high_side_D(J);
 
+        // the cells are divided among the threads; each (equation, cell)
+        // block row is only written by the thread that owns the cell
+#pragma omp parallel for collapse(3) num_threads(d_num_threads)
         for (int k = 0; k < d_N[K]; ++k)
         {
             for (int j = 0; j < d_N[J]; ++j)
             {
                 for (int i = 0; i < d_N[I]; ++i)
                 {
+                    // work space for this thread
+                    Work_Space &ws = d_work_space[profugus::thread_id()];
+
                     // get the global indices, we do not have to convert k
                     // because all of k lives on each processor for the KBA
                     // decomposition
-                    g_i = i + i_off;
-                    g_j = j + j_off;
+                    int g_i = i + i_off;
+                    int g_j = j + j_off;
                     CHECK(index.convert_to_global(i, j) ==
                            LG_Indexer::IJ_Set(g_i, g_j));
                     CHECK(index.l2g(i, j, k) == index.g2g(g_i, g_j, k));
 
-                    // global cell index
-                    global = index.l2g(i, j, k);
+                    // global and local cell indices
+                    int global = index.l2g(i, j, k);
+                    int local  = index.l2l(i, j, k);
 
                     // build all of the G x G block matrices for this
-                    // (equation, cell) block row; we will then add them
-                    // element-by-element by inserting each row for each block
-                    // matrix; this will incur some overhead, but everything
-                    // will be summed and cleaned up at FillComplete()
+                    // (equation, cell) block row and add them to the rows of
+                    // the block row
 
                     // make the diffusion coefficient for this moment equation
                     // in this cell
-                    b_mom_coeff->make_D(eqn, index.l2l(i, j, k), d_D_c);
+                    b_mom_coeff->make_D(eqn, local, ws.D_c);
 
                     // make A_nn matrix -> this adds A_nn to the
                     // diagonal-block (its placed in C_c); we need to do this
                     // before adding off-diagonal coupling terms
-                    b_mom_coeff->make_A(eqn, eqn, index.l2l(i, j, k), d_C_c);
+                    b_mom_coeff->make_A(eqn, eqn, local, ws.C_c);
 
                     // FIRST: add spatially-coupled matrix elements
                     spatial_coupled_element(eqn, i, j, k, g_i, g_j,
-                                            Dx_low, Dx_high, Dy_low, Dy_high);
+                                            Dx_low, Dx_high, Dy_low, Dy_high,
+                                            ws, rows);
 
                     // SECOND: insert the diagonal block
-                    insert_block_matrix(eqn, global, 0, eqn, global, 0, d_C_c,
-                                        d_matrix);
+                    insert_block_matrix(eqn, local, 0, eqn, global, 0, ws.C_c,
+                                        rows);
 
                     // LAST: insert within-cell coupling with other moment
                     // equations
@@ -282,12 +329,10 @@ void Linear_System_FV<T>::build_Matrix()
                     {
                         if (m != eqn)
                         {
-                            // make Anm
-                            b_mom_coeff->make_A(eqn, m, index.l2l(i, j, k), d_W);
-
-                            // add it to the matrix
+                            // add the stored Anm block to the matrix
                             insert_block_matrix(
-                                eqn, global, 0, m, global, 0, d_W, d_matrix);
+                                eqn, local, 0, m, global, 0,
+                                b_mom_coeff->A(eqn, m, local), rows);
                         }
                     }
                 } // I
@@ -296,8 +341,13 @@ void Linear_System_FV<T>::build_Matrix()
     } // eqn
 
     // >>> BOUNDARY EQUATIONS
+
+    // the boundary equations only live on the faces of the mesh block, so
+    // they are added on the first thread
     if (d_Nb_local)
     {
+        Work_Space &ws = d_work_space[0];
+
         // local and global face indices in each direction (-x,+x,-y,+y,-z,+z)
         int lf[6] = {0, d_N[I] - 1, 0, d_N[J] - 1, 0, d_N[K] - 1};
         int gf[6] = {d_first, d_last_I, d_first, d_last_J, d_first, d_last_K};
@@ -315,9 +365,10 @@ void Linear_System_FV<T>::build_Matrix()
                     {
                         // add boundary equation elements
                         add_boundary_equations(d_bnd_index[f]->l2g(j, k),
+                                               d_bnd_index[f]->local(j, k),
                                                d_indexer->l2g(lf[f], j, k),
                                                d_indexer->l2l(lf[f], j, k),
-                                               d_widths[I][gf[f]]);
+                                               d_widths[I][gf[f]], ws, rows);
                     }
                 }
             }
@@ -336,9 +387,10 @@ void Linear_System_FV<T>::build_Matrix()
                     {
                         // add boundary equation elements
                         add_boundary_equations(d_bnd_index[f]->l2g(i, k),
+                                               d_bnd_index[f]->local(i, k),
                                                d_indexer->l2g(i, lf[f], k),
                                                d_indexer->l2l(i, lf[f], k),
-                                               d_widths[J][gf[f]]);
+                                               d_widths[J][gf[f]], ws, rows);
                     }
                 }
             }
@@ -357,17 +409,19 @@ void Linear_System_FV<T>::build_Matrix()
                     {
                         // add boundary equation elements
                         add_boundary_equations(d_bnd_index[f]->l2g(i, j),
+                                               d_bnd_index[f]->local(i, j),
                                                d_indexer->l2g(i, j, lf[f]),
                                                d_indexer->l2l(i, j, lf[f]),
-                                               d_widths[K][gf[f]]);
+                                               d_widths[K][gf[f]], ws, rows);
                     }
                 }
             }
         }
     }
 
-    // complete fill of matrix
-    MatrixTraits<T>::finalize_matrix(d_matrix);
+    // make the matrix on a static graph
+    d_matrix   = fill_matrix(rows);
+    b_operator = d_matrix;
 
     // Epetra returns the global number of nonzeros as a 32 bit signed int
     //  which is prone to overflow (this is only used for output and doesn't
@@ -391,18 +445,29 @@ void Linear_System_FV<T>::build_fission_matrix()
     REQUIRE(!d_mesh.is_null());
     REQUIRE(!b_mat.is_null());
 
-    // as for the A matrix, here we build the matrix/graph at the same time
-    // (since the coupling is much easier->no spatial coupling)
-    d_fission = MatrixTraits<T>::construct_matrix(b_map,d_Ng);
-    b_fission = d_fission;
+    // apply the fission matrix from the stored blocks
+    if (d_matrix_free)
+    {
+        d_fission = Teuchos::null;
+        b_fission = Teuchos::rcp(new FV_Operator<T>(
+            FV_Operator<T>::FISSION, b_map, b_mom_coeff, b_mat, d_mesh,
+            d_indexer, d_widths, d_bnd_index, d_num_threads));
+
+        profugus::pcout << ">>> Built matrix-free SPN FV Element RHS Operator"
+                        << profugus::endl;
+        return;
+    }
 
-    // material id and (local/global) cell index
-    int matid  = 0;
-    int local  = 0;
-    int global = 0;
+    // rows of the matrix on this domain; a volume row is only coupled to the
+    // equations in its cell and the boundary rows are empty
+    Vec_Int capacities(d_Nv_local, d_Ne * d_Ng);
+    capacities.resize(d_Nv_local + d_Nb_local, 0);
+    Row_Buffer rows(capacities);
 
     // outer loop over cells -> we can loop directly over cells because there
-    // is no neighbor coupling in the fission matrix
+    // is no neighbor coupling in the fission matrix; the cells are divided
+    // among the threads
+#pragma omp parallel for collapse(3) num_threads(d_num_threads)
     for (int k = 0; k < d_N[K]; ++k)
     {
         for (int j = 0; j < d_N[J]; ++j)
@@ -410,8 +475,8 @@ void Linear_System_FV<T>::build_fission_matrix()
             for (int i = 0; i < d_N[I]; ++i)
             {
                 // get the cell indices
-                global = d_indexer->l2g(i, j, k);
-                local  = d_indexer->l2l(i, j, k);
+                int global = d_indexer->l2g(i, j, k);
+                int local  = d_indexer->l2l(i, j, k);
 
                 // inner loop over equations (elements in the row)
                 for (int eqn = 0; eqn < d_Ne; ++eqn)
@@ -419,20 +484,19 @@ void Linear_System_FV<T>::build_fission_matrix()
                     // insert coupling with other moment equations
                     for (int m = 0; m < d_Ne; ++m)
                     {
-                        // make Fnm
-                        b_mom_coeff->make_F(eqn, m, local, d_W);
-
-                        // add it to the matrix
-                        insert_block_matrix(eqn, global, 0, m, global, 0,
-                                            d_W, d_fission);
+                        // add the stored Fnm block to the matrix
+                        insert_block_matrix(eqn, local, 0, m, global, 0,
+                                            b_mom_coeff->F(eqn, m, local),
+                                            rows);
                     }
                 }
             }
         }
     }
 
-    // finish matrix
-    MatrixTraits<T>::finalize_matrix(d_fission);
+    // make the matrix on a static graph
+    d_fission = fill_matrix(rows);
+    b_fission = d_fission;
 
     // Epetra returns the global number of nonzeros as a 32 bit signed int
     //  which is prone to overflow (this is only used for output and doesn't
@@ -773,27 +837,58 @@ void Linear_System_FV<T>::map_bnd_l2g(RCP_Bnd_Indexer  indexer,
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Number of neighbor cells and boundary unknowns coupled to a cell.
+ *
+ * This is the number of spatially-coupled block columns that
+ * spatial_coupled_element() adds to the cell's rows.
+ *
+ * \param g_i global i index of the cell
+ * \param g_j global j index of the cell
+ * \param k k index of the cell
+ */
+template <class T>
+int Linear_System_FV<T>::num_face_couplings(int g_i,
+                                            int g_j,
+                                            int k) const
+{
+    int n = 0;
+    if (g_i > d_first  || !d_bnd_index[0].is_null()) ++n;
+    if (g_i < d_last_I || !d_bnd_index[1].is_null()) ++n;
+    if (g_j > d_first  || !d_bnd_index[2].is_null()) ++n;
+    if (g_j < d_last_J || !d_bnd_index[3].is_null()) ++n;
+    if (k   > d_first  || !d_bnd_index[4].is_null()) ++n;
+    if (k   < d_last_K || !d_bnd_index[5].is_null()) ++n;
+
+    ENSURE(n <= 6);
+    return n;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \brief Insert spatially coupled elements.
  */
 template <class T>
-void Linear_System_FV<T>::spatial_coupled_element(int            n,
-                                                  int            i,
-                                                  int            j,
-                                                  int            k,
-                                                  int            g_i,
-                                                  int            g_j,
-                                                  RCP_Face_Field Dx_low,
-                                                  RCP_Face_Field Dx_high,
-                                                  RCP_Face_Field Dy_low,
-                                                  RCP_Face_Field Dy_high)
+void Linear_System_FV<T>::spatial_coupled_element(int                   n,
+                                                  int                   i,
+                                                  int                   j,
+                                                  int                   k,
+                                                  int                   g_i,
+                                                  int                   g_j,
+                                                  const RCP_Face_Field &Dx_low,
+                                                  const RCP_Face_Field &Dx_high,
+                                                  const RCP_Face_Field &Dy_low,
+                                                  const RCP_Face_Field &Dy_high,
+                                                  Work_Space           &ws,
+                                                  Row_Buffer           &rows)
 {
     using def::I; using def::J; using def::K;
 
-    // global cell
-    int global = d_indexer->l2g(i, j, k);
-    CHECK(global == d_indexer->g2g(g_i, g_j, k));
+    // local cell; the face fields are passed by reference so that their
+    // reference counts are not changed concurrently by the assembly threads
+    int local = d_indexer->l2l(i, j, k);
+    CHECK(d_indexer->l2g(i, j, k) == d_indexer->g2g(g_i, g_j, k));
 
     // spatially-coupled global cell index
     int neighbor = 0;
@@ -807,12 +902,14 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
         // diffusion coefficients locally
         if (i > 0)
         {
-            // make the neighbor diffusion coefficient on this processor
-            b_mom_coeff->make_D(n, d_indexer->l2l(i - 1, j, k), d_D);
+            // get the stored neighbor diffusion coefficient on this processor
+            const Serial_Matrix &D =
+                b_mom_coeff->D(n, d_indexer->l2l(i - 1, j, k));
 
             // add the spatial element to the matrix
-            add_spatial_element(n, global, neighbor, d_widths[I][g_i - 1],
-                                d_widths[I][g_i], d_widths[I][g_i], d_D_c, d_D);
+            add_spatial_element(n, local, neighbor, d_widths[I][g_i - 1],
+                                d_widths[I][g_i], d_widths[I][g_i], ws.D_c, D,
+                                ws, rows);
         }
         // get the neighbor diffusion coefficient from the face-field if this
         // is on the low-internal-boundary side; we can only get here in a
@@ -827,8 +924,9 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
             Serial_Matrix D = Dx_low->view(j, k);
 
             // add the spatial element to the matrix
-            add_spatial_element(n, global, neighbor, d_widths[I][g_i - 1],
-                                d_widths[I][g_i], d_widths[I][g_i], d_D_c, D);
+            add_spatial_element(n, local, neighbor, d_widths[I][g_i - 1],
+                                d_widths[I][g_i], d_widths[I][g_i], ws.D_c, D,
+                                ws, rows);
         }
     }
     else if (!d_bnd_index[0].is_null())
@@ -837,7 +935,7 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
         neighbor = d_bnd_index[0]->l2g(j, k);
 
         // add the contribution from the boundary edge unknown
-        build_bnd_element(n, global, neighbor, d_widths[I][d_first]);
+        build_bnd_element(n, local, neighbor, d_widths[I][d_first], ws, rows);
     }
 
     if (g_i < d_last_I)
@@ -849,13 +947,14 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
         // diffusion coefficients locally
         if (i < d_N[I] - 1)
         {
-            // make the neighbor diffusion coefficient on this processor
-            b_mom_coeff->make_D(n, d_indexer->l2l(i + 1, j, k), d_D);
+            // get the stored neighbor diffusion coefficient on this processor
+            const Serial_Matrix &D =
+                b_mom_coeff->D(n, d_indexer->l2l(i + 1, j, k));
 
             // add the spatial element to the matrix
-            add_spatial_element(n, global, neighbor, d_widths[I][g_i],
+            add_spatial_element(n, local, neighbor, d_widths[I][g_i],
                                 d_widths[I][g_i + 1], d_widths[I][g_i],
-                                d_D, d_D_c);
+                                D, ws.D_c, ws, rows);
         }
         // get the neighbor diffusion coefficient from the face-field if this
         // is on the high-internal-boundary side; we can only get here in a
@@ -870,9 +969,9 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
             Serial_Matrix D = Dx_high->view(j, k);
 
             // add the spatial element to the matrix
-            add_spatial_element(n, global, neighbor, d_widths[I][g_i],
+            add_spatial_element(n, local, neighbor, d_widths[I][g_i],
                                 d_widths[I][g_i + 1], d_widths[I][g_i],
-                                D, d_D_c);
+                                D, ws.D_c, ws, rows);
         }
     }
     else if (!d_bnd_index[1].is_null())
@@ -881,7 +980,7 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
         neighbor = d_bnd_index[1]->l2g(j, k);
 
         // add the contribution from the boundary edge unknown
-        build_bnd_element(n, global, neighbor, d_widths[I][d_last_I]);
+        build_bnd_element(n, local, neighbor, d_widths[I][d_last_I], ws, rows);
     }
 
     if (g_j > d_first)
@@ -893,12 +992,14 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
         // diffusion coefficients locally
         if (j > 0)
         {
-            // make the neighbor diffusion coefficient on this processor
-            b_mom_coeff->make_D(n, d_indexer->l2l(i, j - 1, k), d_D);
+            // get the stored neighbor diffusion coefficient on this processor
+            const Serial_Matrix &D =
+                b_mom_coeff->D(n, d_indexer->l2l(i, j - 1, k));
 
             // add the spatial element to the matrix
-            add_spatial_element(n, global, neighbor, d_widths[J][g_j - 1],
-                                d_widths[J][g_j], d_widths[J][g_j], d_D_c, d_D);
+            add_spatial_element(n, local, neighbor, d_widths[J][g_j - 1],
+                                d_widths[J][g_j], d_widths[J][g_j], ws.D_c, D,
+                                ws, rows);
         }
         // get the neighbor diffusion coefficient from the face-field if this
         // is on the low-internal-boundary side; we can only get here in a
@@ -913,8 +1014,9 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
             Serial_Matrix D = Dy_low->view(i, k);
 
             // add the spatial element to the matrix
-            add_spatial_element(n, global, neighbor, d_widths[J][g_j - 1],
-                                d_widths[J][g_j], d_widths[J][g_j], d_D_c, D);
+            add_spatial_element(n, local, neighbor, d_widths[J][g_j - 1],
+                                d_widths[J][g_j], d_widths[J][g_j], ws.D_c, D,
+                                ws, rows);
         }
     }
     else if (!d_bnd_index[2].is_null())
@@ -923,7 +1025,7 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
         neighbor = d_bnd_index[2]->l2g(i, k);
 
         // add the contribution from the boundary edge unknown
-        build_bnd_element(n, global, neighbor, d_widths[J][d_first]);
+        build_bnd_element(n, local, neighbor, d_widths[J][d_first], ws, rows);
     }
 
     if (g_j < d_last_J)
@@ -935,13 +1037,14 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
         // diffusion coefficients locally
         if (j < d_N[J] - 1)
         {
-            // make the neighbor diffusion coefficient on this processor
-            b_mom_coeff->make_D(n, d_indexer->l2l(i, j + 1, k), d_D);
+            // get the stored neighbor diffusion coefficient on this processor
+            const Serial_Matrix &D =
+                b_mom_coeff->D(n, d_indexer->l2l(i, j + 1, k));
 
             // add the spatial element to the matrix
-            add_spatial_element(n, global, neighbor, d_widths[J][g_j],
+            add_spatial_element(n, local, neighbor, d_widths[J][g_j],
                                 d_widths[J][g_j + 1], d_widths[J][g_j],
-                                d_D, d_D_c);
+                                D, ws.D_c, ws, rows);
         }
         // get the neighbor diffusion coefficient from the face-field if this
         // is on the high-internal-boundary side; we can only get here in a
@@ -956,9 +1059,9 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
             Serial_Matrix D = Dy_high->view(i, k);
 
             // add the spatial element to the matrix
-            add_spatial_element(n, global, neighbor, d_widths[J][g_j],
+            add_spatial_element(n, local, neighbor, d_widths[J][g_j],
                                 d_widths[J][g_j + 1], d_widths[J][g_j],
-                                D, d_D_c);
+                                D, ws.D_c, ws, rows);
         }
     }
     else if (!d_bnd_index[3].is_null())
@@ -967,7 +1070,7 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
         neighbor = d_bnd_index[3]->l2g(i, k);
 
         // add the contribution from the boundary edge unknown
-        build_bnd_element(n, global, neighbor, d_widths[J][d_last_J]);
+        build_bnd_element(n, local, neighbor, d_widths[J][d_last_J], ws, rows);
     }
 
     if (k > d_first)
@@ -975,11 +1078,13 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
         // neighbor cell
         neighbor = d_indexer->g2g(g_i, g_j, k - 1);
 
-        // make the neighbor diffusion coefficient on this processor (K is
-        // always local)
-        b_mom_coeff->make_D(n, d_indexer->l2l(i, j, k - 1), d_D);
-        add_spatial_element(n, global, neighbor, d_widths[K][k - 1],
-                            d_widths[K][k], d_widths[K][k], d_D_c, d_D);
+        // get the stored neighbor diffusion coefficient on this processor
+        // (K is always local)
+        const Serial_Matrix &D =
+            b_mom_coeff->D(n, d_indexer->l2l(i, j, k - 1));
+        add_spatial_element(n, local, neighbor, d_widths[K][k - 1],
+                            d_widths[K][k], d_widths[K][k], ws.D_c, D,
+                            ws, rows);
     }
     else if (!d_bnd_index[4].is_null())
     {
@@ -987,7 +1092,7 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
         neighbor = d_bnd_index[4]->l2g(i, j);
 
         // add the contribution from the boundary edge unknown
-        build_bnd_element(n, global, neighbor, d_widths[K][d_first]);
+        build_bnd_element(n, local, neighbor, d_widths[K][d_first], ws, rows);
     }
 
     if (k < d_last_K)
@@ -995,11 +1100,13 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
         // neighbor cell
         neighbor = d_indexer->g2g(g_i, g_j, k + 1);
 
-        // make the neighbor diffusion coefficient on this processor (K is
-        // always local)
-        b_mom_coeff->make_D(n, d_indexer->l2l(i, j, k + 1), d_D);
-        add_spatial_element(n, global, neighbor, d_widths[K][k],
-                            d_widths[K][k + 1], d_widths[K][k], d_D, d_D_c);
+        // get the stored neighbor diffusion coefficient on this processor
+        // (K is always local)
+        const Serial_Matrix &D =
+            b_mom_coeff->D(n, d_indexer->l2l(i, j, k + 1));
+        add_spatial_element(n, local, neighbor, d_widths[K][k],
+                            d_widths[K][k + 1], d_widths[K][k], D, ws.D_c,
+                            ws, rows);
     }
     else if (!d_bnd_index[5].is_null())
     {
@@ -1007,7 +1114,7 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
         neighbor = d_bnd_index[5]->l2g(i, j);
 
         // add the contribution from the boundary edge unknown
-        build_bnd_element(n, global, neighbor, d_widths[K][d_last_K]);
+        build_bnd_element(n, local, neighbor, d_widths[K][d_last_K], ws, rows);
     }
 }
 
@@ -1016,13 +1123,15 @@ void Linear_System_FV<T>::spatial_coupled_element(int            n,
  * \brief  Add spatial element to the matrix.
  *
  * \param eqn equation for this (GXG) block row
- * \param row_cell global cell for this (GXG) block row
+ * \param row_cell local cell for this (GXG) block row
  * \param col_cell global cell for this (GXG) block column
  * \param delta_l left-width
  * \param delta_r right-width
  * \param delta_c cell-width (will equal delta_l or delta_r)
  * \param Dl left-diffusion matrix
  * \param Dr right-diffusion matrix
+ * \param ws work space of the calling thread
+ * \param rows matrix rows
  */
 template <class T>
 void Linear_System_FV<T>::add_spatial_element(int                  eqn,
@@ -1032,55 +1141,59 @@ void Linear_System_FV<T>::add_spatial_element(int                  eqn,
                                               double               delta_r,
                                               double               delta_c,
                                               const Serial_Matrix &Dl,
-                                              const Serial_Matrix &Dr)
+                                              const Serial_Matrix &Dr,
+                                              Work_Space          &ws,
+                                              Row_Buffer          &rows)
 {
-    REQUIRE(Dl.numRows()    == d_Ng);
-    REQUIRE(Dl.numCols()    == d_Ng);
-    REQUIRE(Dr.numRows()    == d_Ng);
-    REQUIRE(Dr.numCols()    == d_Ng);
-    REQUIRE(d_C.numCols()   == d_Ng);
-    REQUIRE(d_C.numRows()   == d_Ng);
-    REQUIRE(d_C_c.numCols() == d_Ng);
-    REQUIRE(d_C_c.numRows() == d_Ng);
+    REQUIRE(Dl.numRows()     == d_Ng);
+    REQUIRE(Dl.numCols()     == d_Ng);
+    REQUIRE(Dr.numRows()     == d_Ng);
+    REQUIRE(Dr.numCols()     == d_Ng);
+    REQUIRE(ws.C.numCols()   == d_Ng);
+    REQUIRE(ws.C.numRows()   == d_Ng);
+    REQUIRE(ws.C_c.numCols() == d_Ng);
+    REQUIRE(ws.C_c.numRows() == d_Ng);
     REQUIRE(delta_c > 0.0);
 
     // make C for this neighbor coupling -> note that Dl and Dr are references
-    // to d_D and d_D_c depending on the spatial coupling direction
+    // to the neighbor D and ws.D_c depending on the spatial coupling
+    // direction
 
     // make the sum term (delta_l * Dl + delta_r * Dr)
-    d_C.assign(Dl);
-    d_C *= delta_l;
+    ws.C.assign(Dl);
+    ws.C *= delta_l;
 
-    d_W.assign(Dr);
-    d_W *= delta_r;
+    ws.W.assign(Dr);
+    ws.W *= delta_r;
 
-    d_C += d_W;
+    ws.C += ws.W;
 
     // invert
 
     // LU decomposition
-    d_lapack.GETRF(d_Ng, d_Ng, d_C.values(), d_C.stride(), &d_ipiv[0], &d_info);
-    CHECK(d_info == 0);
+    d_lapack.GETRF(d_Ng, d_Ng, ws.C.values(), ws.C.stride(), &ws.ipiv[0],
+                   &ws.info);
+    CHECK(ws.info == 0);
 
     // inverse
-    d_lapack.GETRI(d_Ng, d_C.values(), d_C.stride(), &d_ipiv[0], &d_work[0],
-                   d_Ng, &d_info);
-    CHECK(d_info == 0);
+    d_lapack.GETRI(d_Ng, ws.C.values(), ws.C.stride(), &ws.ipiv[0],
+                   &ws.work[0], d_Ng, &ws.info);
+    CHECK(ws.info == 0);
 
     // multiply W = C*Dr
-    d_W.multiply(Teuchos::NO_TRANS, Teuchos::NO_TRANS, 1.0, d_C, Dr, 0.0);
+    ws.W.multiply(Teuchos::NO_TRANS, Teuchos::NO_TRANS, 1.0, ws.C, Dr, 0.0);
 
     // multiply Dl * W = Dl * (C*Dr)
-    d_C.multiply(Teuchos::NO_TRANS, Teuchos::NO_TRANS, 1.0, Dl, d_W, 0.0);
+    ws.C.multiply(Teuchos::NO_TRANS, Teuchos::NO_TRANS, 1.0, Dl, ws.W, 0.0);
 
     // multiply by -2.0 / delta_c
-    d_C *= -2.0 / delta_c;
+    ws.C *= -2.0 / delta_c;
 
     // add C to the spatially-coupled column
-    insert_block_matrix(eqn, row_cell, 0,  eqn, col_cell, 0, d_C, d_matrix);
+    insert_block_matrix(eqn, row_cell, 0,  eqn, col_cell, 0, ws.C, rows);
 
     // add (C is negative) to the local (n,i,j,k) contribution to the matrix
-    d_C_c -= d_C;
+    ws.C_c -= ws.C;
 }
 
 //---------------------------------------------------------------------------//
@@ -1088,34 +1201,38 @@ void Linear_System_FV<T>::add_spatial_element(int                  eqn,
  * \brief Add boundary element to matrix.
  *
  * \param eqn
- * \param global_row
- * \param global_col
+ * \param row_cell local cell of the row
+ * \param global_col global boundary unknown of the column
  * \param delta_c
+ * \param ws work space of the calling thread
+ * \param rows matrix rows
  */
 template <class T>
-void Linear_System_FV<T>::build_bnd_element(int    eqn,
-                                            int    global_row,
-                                            int    global_col,
-                                            double delta_c)
+void Linear_System_FV<T>::build_bnd_element(int         eqn,
+                                            int         row_cell,
+                                            int         global_col,
+                                            double      delta_c,
+                                            Work_Space &ws,
+                                            Row_Buffer &rows)
 {
-    REQUIRE(d_C.numCols()   == d_Ng);
-    REQUIRE(d_C.numRows()   == d_Ng);
-    REQUIRE(d_C_c.numCols() == d_Ng);
-    REQUIRE(d_C_c.numRows() == d_Ng);
+    REQUIRE(ws.C.numCols()   == d_Ng);
+    REQUIRE(ws.C.numRows()   == d_Ng);
+    REQUIRE(ws.C_c.numCols() == d_Ng);
+    REQUIRE(ws.C_c.numRows() == d_Ng);
     REQUIRE(delta_c > 0.0);
 
     // make C for this boundary coupling
 
     // make the sum term
-    d_C.assign(d_D_c);
-    d_C *= -2.0 / (delta_c * delta_c);
+    ws.C.assign(ws.D_c);
+    ws.C *= -2.0 / (delta_c * delta_c);
 
     // add C to the boundary-coupled column
-    insert_block_matrix(eqn, global_row, 0, eqn, global_col, d_Nv_global, d_C,
-                        d_matrix);
+    insert_block_matrix(eqn, row_cell, 0, eqn, global_col, d_Nv_global, ws.C,
+                        rows);
 
     // add (C is negative) to the local (n,i,j,k) contribution to the matrix
-    d_C_c -= d_C;
+    ws.C_c -= ws.C;
 }
 
 //---------------------------------------------------------------------------//
@@ -1123,33 +1240,33 @@ void Linear_System_FV<T>::build_bnd_element(int    eqn,
  * \brief Add boundary equations to the matrix.
  */
 template <class T>
-void Linear_System_FV<T>::add_boundary_equations(int    face,
-                                                 int    global_cell,
-                                                 int    local_cell,
-                                                 double delta_c)
+void Linear_System_FV<T>::add_boundary_equations(int         face,
+                                                 int         local_face,
+                                                 int         global_cell,
+                                                 int         local_cell,
+                                                 double      delta_c,
+                                                 Work_Space &ws,
+                                                 Row_Buffer &rows)
 {
-    // global row index for the current boundary equations
-    int row = 0;
-
     // loop over equations
     for (int n = 0; n < d_Ne; ++n)
     {
         // make the diffusion coefficient for this moment equation in this
         // cell
-        b_mom_coeff->make_D(n, local_cell, d_C);
+        b_mom_coeff->make_D(n, local_cell, ws.C);
 
         // calculate C
-        d_C *= (-2.0 / delta_c);
+        ws.C *= (-2.0 / delta_c);
 
         // make D_nn matrix and set it as the boundary term
-        b_mom_coeff->make_B(n, n, d_C_c);
+        b_mom_coeff->make_B(n, n, ws.C_c);
 
         // add C (C is negative) to the nn boundary term
-        d_C_c -= d_C;
+        ws.C_c -= ws.C;
 
         // FIRST: add the volume cell term
-        insert_block_matrix(n, face, d_Nv_global, n, global_cell, 0, d_C,
-                            d_matrix);
+        insert_block_matrix(n, local_face, d_Nv_local, n, global_cell, 0,
+                            ws.C, rows);
 
         // SECOND: add all the moment-coupling terms to the
         // boundary
@@ -1158,32 +1275,37 @@ void Linear_System_FV<T>::add_boundary_equations(int    face,
             if (m != n)
             {
                 // make Bnm
-                b_mom_coeff->make_B(n, m, d_W);
+                b_mom_coeff->make_B(n, m, ws.W);
 
                 // add it to the matrix
-                insert_block_matrix(
-                    n, face, d_Nv_global, m, face, d_Nv_global, d_W, d_matrix);
+                insert_block_matrix(n, local_face, d_Nv_local, m, face,
+                                    d_Nv_global, ws.W, rows);
             }
         }
 
         // LAST: add the within-moment matrix element
-        insert_block_matrix(n, face, d_Nv_global, n, face, d_Nv_global, d_C_c,
-                            d_matrix);
+        insert_block_matrix(n, local_face, d_Nv_local, n, face, d_Nv_global,
+                            ws.C_c, rows);
     }
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * \brief Insert a block matrix (GXG) into the matrix.
+ * \brief Insert a block matrix (GXG) into the matrix rows.
+ *
+ * Only the non-zero entries of the block are added.  The rows are local and
+ * the columns are global.
  *
  * \param row_n equation for this (GXG) block row
- * \param row_cell global cell for this (GXG) block row
+ * \param row_cell local cell for this (GXG) block row
+ * \param row_off used if these are boundary conditions that are appended to
+ * the end of the matrix (should be d_Nv_local or 0)
  * \param col_m equation for this (GXG) block column
  * \param col_cell global cell for this (GXG) block column
- * \param row_off used if these are boundary conditions that are appended to
- * the end of the matrix (should be d_Nv_global or 0)
  * \param col_off used if these are boundary conditions that are appended to
  * the end of the matrix (should be d_Nv_global or 0)
+ * \param M block matrix
+ * \param rows matrix rows
  */
 template <class T>
 void Linear_System_FV<T>::insert_block_matrix(int                  row_n,
@@ -1193,34 +1315,31 @@ void Linear_System_FV<T>::insert_block_matrix(int                  row_n,
                                               int                  col_cell,
                                               int                  col_off,
                                               const Serial_Matrix &M,
-                                              Teuchos::RCP<Matrix_t> matrix)
+                                              Row_Buffer          &rows) const
 {
     REQUIRE(row_n < d_Ne);
     REQUIRE(col_m < d_Ne);
     REQUIRE(M.numCols() == d_Ng);
     REQUIRE(M.numRows() == d_Ng);
 
-    // global row and column indices
+    // local row and global column indices
     int row = 0, col = 0;
 
-    // counter
-    int ctr = 0;
-
     // loop over rows (in g)
     for(int g = 0; g < d_Ng; ++g)
     {
-        // determine the row in global index space
+        // determine the row in local index space
         row = row_off + index(g, row_n, row_cell);
-        CHECK(row >= 0 && row < d_Nv_global + d_Nb_global);
+        CHECK(row >= 0 && row < d_Nv_local + d_Nb_local);
 
-        // initialize the row counter
-        ctr = 0;
+        // row counter and storage
+        int    &ctr     = rows.count[row];
+        int    *columns = &rows.columns[rows.offsets[row]];
+        double *values  = &rows.values[rows.offsets[row]];
 
         // loop over columns (in gp)
         for (int gp = 0; gp < d_Ng; ++gp)
         {
-            CHECK(ctr < d_Ng);
-
             // determine the column in global index space
             col = col_off + index(gp, col_m, col_cell);
             CHECK(col >= 0 && col < d_Nv_global + d_Nb_global);
@@ -1228,15 +1347,70 @@ void Linear_System_FV<T>::insert_block_matrix(int                  row_n,
             // only add non-zero entries
             if (std::fabs(M(g, gp)) > 0.0)
             {
-                d_indices[ctr] = col;
-                d_values[ctr]  = M(g, gp);
+                CHECK(ctr < rows.capacity(row));
+                columns[ctr] = col;
+                values[ctr]  = M(g, gp);
                 ++ctr;
             }
         }
+    }
+}
 
-        // insert the row into the matrix
-        MatrixTraits<T>::add_to_matrix(matrix,row,ctr,d_indices,d_values);
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Make a matrix on a static graph from the buffered rows.
+ *
+ * The graph is made from the row patterns and the values are then summed
+ * into the matrix.  Both are done serially: summing into an Epetra/Tpetra
+ * matrix by global index is not thread-safe, and it is cheap next to
+ * assembling the rows, which is threaded.
+ */
+template <class T>
+Teuchos::RCP<typename Linear_System_FV<T>::Matrix_t>
+Linear_System_FV<T>::fill_matrix(const Row_Buffer &rows) const
+{
+    typedef typename MatrixTraits<T>::Graph_t Graph_t;
+
+    REQUIRE(static_cast<int>(rows.count.size()) == d_Nv_local + d_Nb_local);
+
+    // number of local rows
+    int N = rows.count.size();
+
+    // global id of each row
+    Vec_Int row_gid(N);
+    for (int row = 0; row < N; ++row)
+    {
+        row_gid[row] = MatrixTraits<T>::global_row_id(b_map, row);
     }
+
+    // make the static graph
+    Teuchos::RCP<Graph_t> graph =
+        MatrixTraits<T>::construct_graph(b_map, rows.count);
+    for (int row = 0; row < N; ++row)
+    {
+        MatrixTraits<T>::add_to_graph(
+            *graph, row_gid[row], rows.count[row],
+            &rows.columns[rows.offsets[row]]);
+    }
+    MatrixTraits<T>::finalize_graph(graph);
+
+    // make the matrix and fill its rows
+    Teuchos::RCP<Matrix_t> matrix = MatrixTraits<T>::construct_matrix(
+        Teuchos::RCP<const Graph_t>(graph));
+    Matrix_t &A = *matrix;
+
+    for (int row = 0; row < N; ++row)
+    {
+        MatrixTraits<T>::sum_into_matrix(
+            A, row_gid[row], rows.count[row],
+            &rows.columns[rows.offsets[row]],
+            &rows.values[rows.offsets[row]]);
+    }
+
+    // complete fill of matrix
+    MatrixTraits<T>::finalize_matrix(matrix);
+
+    return matrix;
 }
 
 } // end namespace profugus
@@ -13,6 +13,9 @@
 
 #include <SPn/config.h>
 
+#include <algorithm>
+#include <vector>
+
 #include "Teuchos_RCP.hpp"
 #include "Teuchos_ArrayRCP.hpp"
 #include "Teuchos_OrdinalTraits.hpp"
@@ -37,6 +40,14 @@ namespace profugus
 /*!
  * \class MatrixTraits
  * \brief Traits class for Epetra/Tpetra matrices
+ *
+ * Matrices are either built on a dynamic graph (construct_matrix() from a
+ * map followed by add_to_matrix()), or on a static graph that is made with
+ * construct_graph(), add_to_graph(), and finalize_graph() before the matrix
+ * is constructed from it.  The values of a static-graph matrix are set with
+ * sum_into_matrix().  Neither Epetra nor Tpetra guarantee that summing into
+ * a matrix by global index is thread-safe, so sum_into_matrix() must only be
+ * called from one thread at a time.
  */
 /*!
  * \example spn/test/tstMatrixTraits.cc
@@ -58,6 +69,7 @@ class MatrixTraits
     //@{
     //! Typedefs.
     typedef typename T::MATRIX Matrix_t;
+    typedef typename T::GRAPH  Graph_t;
     typedef typename T::MAP    Map_t;
     //@}
 
@@ -68,6 +80,30 @@ class MatrixTraits
         return Teuchos::null;
     }
 
+    static int global_row_id(Teuchos::RCP<const Map_t> map, int local_id)
+    {
+        UndefinedMatrixTraits<T>::NotDefined();
+        return -1;
+    }
+
+    static Teuchos::RCP<Graph_t> construct_graph(
+        Teuchos::RCP<const Map_t> map, const std::vector<int> &num_per_row )
+    {
+        UndefinedMatrixTraits<T>::NotDefined();
+        return Teuchos::null;
+    }
+
+    static void add_to_graph(Graph_t &graph, int row, int count,
+                             const int *inds)
+    {
+        UndefinedMatrixTraits<T>::NotDefined();
+    }
+
+    static void finalize_graph(Teuchos::RCP<Graph_t> graph)
+    {
+        UndefinedMatrixTraits<T>::NotDefined();
+    }
+
     static Teuchos::RCP<Matrix_t> construct_matrix(
         Teuchos::RCP<const Map_t> map, int num_per_row )
     {
@@ -75,6 +111,13 @@ class MatrixTraits
         return Teuchos::null;
     }
 
+    static Teuchos::RCP<Matrix_t> construct_matrix(
+        Teuchos::RCP<const Graph_t> graph )
+    {
+        UndefinedMatrixTraits<T>::NotDefined();
+        return Teuchos::null;
+    }
+
     static int local_rows( Teuchos::RCP<const Matrix_t> matrix )
     {
         UndefinedMatrixTraits<T>::NotDefined();
@@ -101,6 +144,12 @@ class MatrixTraits
         UndefinedMatrixTraits<T>::NotDefined();
     }
 
+    static void sum_into_matrix(Matrix_t &matrix, int row, int count,
+                                const int *inds, const double *vals)
+    {
+        UndefinedMatrixTraits<T>::NotDefined();
+    }
+
     static void get_local_row_view(Teuchos::RCP<const Matrix_t> matrix, int row,
                                    Teuchos::ArrayView<const int>    &inds,
                                    Teuchos::ArrayView<const double> &vals)
@@ -140,6 +189,7 @@ class MatrixTraits<EpetraTypes>
     //@{
     //! Typedefs.
     typedef typename EpetraTypes::MATRIX Matrix_t;
+    typedef typename EpetraTypes::GRAPH  Graph_t;
     typedef typename EpetraTypes::MAP    Map_t;
     //@}
 
@@ -172,6 +222,38 @@ class MatrixTraits<EpetraTypes>
         return map;
     }
 
+    static int global_row_id(Teuchos::RCP<const Map_t> map, int local_id)
+    {
+        return map->GID(local_id);
+    }
+
+    static Teuchos::RCP<Graph_t> construct_graph(
+        Teuchos::RCP<const Map_t> map, const std::vector<int> &num_per_row )
+    {
+        REQUIRE(static_cast<int>(num_per_row.size()) == map->NumMyElements());
+        Teuchos::RCP<Graph_t> graph(
+            new Graph_t(Copy, *map, &num_per_row[0], true));
+        return graph;
+    }
+
+    static void add_to_graph(Graph_t &graph, int row, int count,
+                             const int *inds)
+    {
+        if( count > 0 )
+        {
+            int err = graph.InsertGlobalIndices(
+                row, count, const_cast<int *>(inds));
+            CHECK( 0 <= err );
+        }
+    }
+
+    static void finalize_graph(Teuchos::RCP<Graph_t> graph)
+    {
+        graph->FillComplete();
+        graph->OptimizeStorage();
+        ENSURE(graph->StorageOptimized());
+    }
+
     static Teuchos::RCP<Matrix_t> construct_matrix(
         Teuchos::RCP<const Map_t> map, int num_per_row )
     {
@@ -180,6 +262,14 @@ class MatrixTraits<EpetraTypes>
         return matrix;
     }
 
+    static Teuchos::RCP<Matrix_t> construct_matrix(
+        Teuchos::RCP<const Graph_t> graph )
+    {
+        REQUIRE(graph->Filled());
+        Teuchos::RCP<Matrix_t> matrix( new Matrix_t(Copy,*graph));
+        return matrix;
+    }
+
     static int local_rows( Teuchos::RCP<const Matrix_t> matrix )
     {
         return matrix->NumMyRows();
@@ -207,6 +297,17 @@ class MatrixTraits<EpetraTypes>
         }
     }
 
+    static void sum_into_matrix(Matrix_t &matrix, int row, int count,
+                                const int *inds, const double *vals)
+    {
+        REQUIRE(matrix.StaticGraph());
+        if( count > 0 )
+        {
+            int err = matrix.SumIntoGlobalValues(row, count, vals, inds);
+            CHECK( 0 == err );
+        }
+    }
+
     static void get_local_row_view(Teuchos::RCP<const Matrix_t> matrix, int row,
                                    Teuchos::ArrayView<const int>    &inds,
                                    Teuchos::ArrayView<const double> &vals)
@@ -255,6 +356,7 @@ class MatrixTraits<TpetraTypes>
     //@{
     //! Typedefs.
     typedef typename TpetraTypes::MATRIX Matrix_t;
+    typedef typename TpetraTypes::GRAPH  Graph_t;
     typedef typename TpetraTypes::MAP    Map_t;
     //@}
 
@@ -290,6 +392,38 @@ class MatrixTraits<TpetraTypes>
         return map;
     }
 
+    static int global_row_id(Teuchos::RCP<const Map_t> map, int local_id)
+    {
+        return map->getGlobalElement(local_id);
+    }
+
+    static Teuchos::RCP<Graph_t> construct_graph(
+        Teuchos::RCP<const Map_t> map, const std::vector<int> &num_per_row )
+    {
+        REQUIRE(num_per_row.size() == map->getNodeNumElements());
+        Teuchos::ArrayRCP<size_t> counts(num_per_row.size());
+        std::copy(num_per_row.begin(), num_per_row.end(), counts.begin());
+        Teuchos::RCP<Graph_t> graph(
+            new Graph_t(map, counts.getConst(), Tpetra::StaticProfile));
+        return graph;
+    }
+
+    static void add_to_graph(Graph_t &graph, int row, int count,
+                             const int *inds)
+    {
+        if( count > 0 )
+        {
+            graph.insertGlobalIndices(
+                row, Teuchos::ArrayView<const int>(inds, count));
+        }
+    }
+
+    static void finalize_graph(Teuchos::RCP<Graph_t> graph)
+    {
+        graph->fillComplete();
+        ENSURE(graph->isStorageOptimized());
+    }
+
     static Teuchos::RCP<Matrix_t> construct_matrix(
         Teuchos::RCP<const Map_t> map, int num_per_row )
     {
@@ -298,6 +432,14 @@ class MatrixTraits<TpetraTypes>
         return matrix;
     }
 
+    static Teuchos::RCP<Matrix_t> construct_matrix(
+        Teuchos::RCP<const Graph_t> graph )
+    {
+        REQUIRE(graph->isFillComplete());
+        Teuchos::RCP<Matrix_t> matrix(new Matrix_t(graph));
+        return matrix;
+    }
+
     static int local_rows( Teuchos::RCP<const Matrix_t> matrix )
     {
         return matrix->getNodeNumRows();
@@ -321,6 +463,18 @@ class MatrixTraits<TpetraTypes>
         matrix->insertGlobalValues(row, inds(0,count), vals(0,count) );
     }
 
+    static void sum_into_matrix(Matrix_t &matrix, int row, int count,
+                                const int *inds, const double *vals)
+    {
+        REQUIRE(matrix.isStaticGraph());
+        if( count > 0 )
+        {
+            matrix.sumIntoGlobalValues(
+                row, Teuchos::ArrayView<const int>(inds, count),
+                Teuchos::ArrayView<const double>(vals, count));
+        }
+    }
+
     static void get_local_row_view(Teuchos::RCP<const Matrix_t> matrix, int row,
                                    Teuchos::ArrayView<const int>    &inds,
                                    Teuchos::ArrayView<const double> &vals)
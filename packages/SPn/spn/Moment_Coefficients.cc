@@ -17,16 +17,6 @@
 #include "utils/Definitions.hh"
 #include "Moment_Coefficients.hh"
 
-// Anonymous namespace function to convert a moment/matid pair to a single
-// size_type for hashing
-namespace
-{
-    def::size_type to_size_type(int mom, int mat)
-    {
-        return mom + 8 * mat;
-    }
-}
-
 namespace profugus
 {
 
@@ -185,13 +175,48 @@ Moment_Coefficients::Moment_Coefficients(RCP_ParameterList db,
         {
             RCP_Serial_Matrix S( new Serial_Matrix(d_Ng,d_Ng) );
             make_Sigma(imom, *m, *S);
-            d_Sigma->insert(Hash_Table::value_type(to_size_type(imom, *m), S));
+            d_Sigma->insert(Hash_Table::value_type(key(imom, *m), S));
         }
     }
 
     // complete the hash-table
     d_Sigma->complete();
     CHECK(d_Sigma->size() == num_mom * mats.size());
+
+    // build the D, A, and F blocks for each material; A and F are symmetric
+    // in (n,m) so only the n <= m blocks are stored
+    int Ne = num_equations();
+    d_D = Teuchos::rcp(new Hash_Table);
+    d_A = Teuchos::rcp(new Hash_Table);
+    d_F = Teuchos::rcp(new Hash_Table);
+
+    for (Vec_Int::const_iterator m = mats.begin(); m != mats.end(); ++m)
+    {
+        for (int n = 0; n < Ne; ++n)
+        {
+            RCP_Serial_Matrix D(new Serial_Matrix(d_Ng, d_Ng));
+            build_D(n, *m, *D);
+            d_D->insert(Hash_Table::value_type(key(n, *m), D));
+
+            for (int l = n; l < Ne; ++l)
+            {
+                RCP_Serial_Matrix A(new Serial_Matrix(d_Ng, d_Ng));
+                build_A(n, l, *m, *A);
+                d_A->insert(Hash_Table::value_type(key(n, l, *m), A));
+
+                RCP_Serial_Matrix F(new Serial_Matrix(d_Ng, d_Ng));
+                build_F(n, l, *m, *F);
+                d_F->insert(Hash_Table::value_type(key(n, l, *m), F));
+            }
+        }
+    }
+
+    d_D->complete();
+    d_A->complete();
+    d_F->complete();
+    ENSURE(d_D->size() == Ne * mats.size());
+    ENSURE(d_A->size() == Ne * (Ne + 1) / 2 * mats.size());
+    ENSURE(d_F->size() == d_A->size());
 }
 
 //---------------------------------------------------------------------------//
@@ -312,56 +337,10 @@ void Moment_Coefficients::make_D(int            n,
                                  int            cell,
                                  Serial_Matrix &D)
 {
-    REQUIRE(!d_mat.is_null());
-    REQUIRE(n >= 0 && n < d_dim->num_equations());
     REQUIRE(cell < d_mat->num_cells());
-    REQUIRE(D.numRows() == D.numCols());
-    REQUIRE(D.numRows() == d_Ng);
-    REQUIRE(d_mat->xs().num_groups() == d_Ng);
-
-    // first get sigma for this diffusion coefficient
-    int matid = d_mat->matid(cell);
-    CHECK( d_Sigma->exists(to_size_type(d_d[n],matid)) );
-    Teuchos::RCP<Serial_Matrix> S = d_Sigma->at(to_size_type(d_d[n],matid));
-    CHECK( !S.is_null() );
-    D.assign(*S);
+    REQUIRE(D.numRows() == d_Ng && D.numCols() == d_Ng);
 
-    if( !d_outscatter_correction )
-    {
-        // LU decomposition
-        d_lapack.GETRF(d_Ng, d_Ng, D.values(), D.stride(), &d_ipiv[0],
-                       &d_info);
-        CHECK(d_info == 0);
-
-        // inverse
-        d_lapack.GETRI(d_Ng, D.values(), D.stride(), &d_ipiv[0], &d_work[0],
-                       d_Ng, &d_info);
-        CHECK(d_info == 0);
-    }
-    else
-    {
-        Serial_Matrix sig(D);
-        D.putScalar(0.0);
-
-        // Apply outscatter correction
-        for( int ig=0; ig<d_Ng; ++ig )
-        {
-            for( int jg=0; jg<d_Ng; ++jg )
-            {
-                D(ig,ig) += sig(jg,ig);
-            }
-        }
-
-        // Invert diagonal entries
-        for( int ig=0; ig<d_Ng; ++ig )
-        {
-            D(ig,ig) = 1.0/D(ig,ig);
-        }
-    }
-
-    // multiply by the scalar coefficient to complete the diffusion matrix
-    // definition
-    D *= d_alpha[n];
+    D.assign(block(*d_D, key(n, d_mat->matid(cell))));
 }
 
 //---------------------------------------------------------------------------//
@@ -421,44 +400,10 @@ void Moment_Coefficients::make_A(int            n,
                                  int            cell,
                                  Serial_Matrix &A)
 {
-    REQUIRE(!d_mat.is_null());
-    REQUIRE(n >= 0 && n < d_dim->num_equations());
-    REQUIRE(m >= 0 && m < d_dim->num_equations());
     REQUIRE(cell < d_mat->num_cells());
-    REQUIRE(A.numRows() == A.numCols());
-    REQUIRE(A.numRows() == d_Ng);
-    REQUIRE(d_mat->xs().num_groups() == d_Ng);
-
-    // initialize A to the first term in each series entry (Sigma_0)
-    int matid = d_mat->matid(cell);
+    REQUIRE(A.numRows() == d_Ng && A.numCols() == d_Ng);
 
-    CHECK( d_Sigma->exists(to_size_type(0,matid)) );
-    Teuchos::RCP<Serial_Matrix> S = d_Sigma->at(to_size_type(0,matid));
-    CHECK( !S.is_null() );
-    A.assign(*S);
-
-    A *= d_c[n][m][0];
-
-    // loop over all possible linear combinations for each element in the
-    // matrix
-    for (int k = 1; k < 4; ++k)
-    {
-        // only go to the effort for non-zero entries
-        if (std::fabs(d_c[n][m][k]) > 0.0)
-        {
-            // make sigma for this iterate in a work matrix
-            CHECK( d_Sigma->exists(to_size_type(d_a[k],matid)) );
-            S = d_Sigma->at(to_size_type(d_a[k],matid));
-            CHECK( !S.is_null() );
-            d_W = *S;
-
-            // multiply by the scalar coefficient
-            d_W *= d_c[n][m][k];
-
-            // add it to the running total
-            A += d_W;
-        }
-    }
+    A.assign(block(*d_A, key(n, m, d_mat->matid(cell))));
 }
 
 //---------------------------------------------------------------------------//
@@ -576,11 +521,140 @@ void Moment_Coefficients::make_F(int            n,
                                  int            m,
                                  int            cell,
                                  Serial_Matrix &F)
+{
+    REQUIRE(cell < d_mat->num_cells());
+    REQUIRE(F.numRows() == d_Ng && F.numCols() == d_Ng);
+
+    F.assign(block(*d_F, key(n, m, d_mat->matid(cell))));
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Build the diffusion matrix for a material.
+ *
+ * \sa make_D()
+ */
+void Moment_Coefficients::build_D(int            n,
+                                  int            matid,
+                                  Serial_Matrix &D)
+{
+    REQUIRE(!d_mat.is_null());
+    REQUIRE(n >= 0 && n < d_dim->num_equations());
+    REQUIRE(d_mat->xs().has(matid));
+    REQUIRE(D.numRows() == D.numCols());
+    REQUIRE(D.numRows() == d_Ng);
+    REQUIRE(d_mat->xs().num_groups() == d_Ng);
+
+    // first get sigma for this diffusion coefficient
+    CHECK( d_Sigma->exists(key(d_d[n],matid)) );
+    Teuchos::RCP<Serial_Matrix> S = d_Sigma->at(key(d_d[n],matid));
+    CHECK( !S.is_null() );
+    D.assign(*S);
+
+    if( !d_outscatter_correction )
+    {
+        // LU decomposition
+        d_lapack.GETRF(d_Ng, d_Ng, D.values(), D.stride(), &d_ipiv[0],
+                       &d_info);
+        CHECK(d_info == 0);
+
+        // inverse
+        d_lapack.GETRI(d_Ng, D.values(), D.stride(), &d_ipiv[0], &d_work[0],
+                       d_Ng, &d_info);
+        CHECK(d_info == 0);
+    }
+    else
+    {
+        Serial_Matrix sig(D);
+        D.putScalar(0.0);
+
+        // Apply outscatter correction
+        for( int ig=0; ig<d_Ng; ++ig )
+        {
+            for( int jg=0; jg<d_Ng; ++jg )
+            {
+                D(ig,ig) += sig(jg,ig);
+            }
+        }
+
+        // Invert diagonal entries
+        for( int ig=0; ig<d_Ng; ++ig )
+        {
+            D(ig,ig) = 1.0/D(ig,ig);
+        }
+    }
+
+    // multiply by the scalar coefficient to complete the diffusion matrix
+    // definition
+    D *= d_alpha[n];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Build an A-matrix block for a material.
+ *
+ * \sa make_A()
+ */
+void Moment_Coefficients::build_A(int            n,
+                                  int            m,
+                                  int            matid,
+                                  Serial_Matrix &A)
 {
     REQUIRE(!d_mat.is_null());
     REQUIRE(n >= 0 && n < d_dim->num_equations());
     REQUIRE(m >= 0 && m < d_dim->num_equations());
-    REQUIRE(cell < d_mat->num_cells());
+    REQUIRE(d_mat->xs().has(matid));
+    REQUIRE(A.numRows() == A.numCols());
+    REQUIRE(A.numRows() == d_Ng);
+    REQUIRE(d_mat->xs().num_groups() == d_Ng);
+
+    // initialize A to the first term in each series entry (Sigma_0)
+    CHECK( d_Sigma->exists(key(0,matid)) );
+    Teuchos::RCP<Serial_Matrix> S = d_Sigma->at(key(0,matid));
+    CHECK( !S.is_null() );
+    A.assign(*S);
+
+    A *= d_c[n][m][0];
+
+    // loop over all possible linear combinations for each element in the
+    // matrix
+    for (int k = 1; k < 4; ++k)
+    {
+        // only go to the effort for non-zero entries
+        if (std::fabs(d_c[n][m][k]) > 0.0)
+        {
+            // make sigma for this iterate in a work matrix
+            CHECK( d_Sigma->exists(key(d_a[k],matid)) );
+            S = d_Sigma->at(key(d_a[k],matid));
+            CHECK( !S.is_null() );
+            d_W = *S;
+
+            // multiply by the scalar coefficient
+            d_W *= d_c[n][m][k];
+
+            // add it to the running total
+            A += d_W;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Build an F fission matrix block for a material.
+ *
+ * \sa make_F()
+ */
+void Moment_Coefficients::build_F(int            n,
+                                  int            m,
+                                  int            matid,
+                                  Serial_Matrix &F)
+{
+    REQUIRE(!d_mat.is_null());
+    REQUIRE(n >= 0 && n < d_dim->num_equations());
+    REQUIRE(m >= 0 && m < d_dim->num_equations());
+    REQUIRE(d_mat->xs().has(matid));
     REQUIRE(F.numRows() == F.numCols());
     REQUIRE(F.numRows() == d_Ng);
     REQUIRE(d_mat->xs().num_groups() == d_Ng);
@@ -591,9 +665,6 @@ void Moment_Coefficients::make_F(int            n,
     // f*chi for each group
     double fchi = 0.0;
 
-    // matid
-    int matid = d_mat->matid(cell);
-
     // cross sections
     const XS_t &xs = d_mat->xs();
 
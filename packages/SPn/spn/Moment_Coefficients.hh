@@ -19,6 +19,7 @@
 #include "Teuchos_LAPACK.hpp"
 #include "Teuchos_ParameterList.hpp"
 
+#include "harness/DBC.hh"
 #include "utils/Definitions.hh"
 #include "utils/Vector_Lite.hh"
 #include "utils/Static_Map.hh"
@@ -34,6 +35,14 @@ namespace profugus
 /*!
  * \class Moment_Coefficients
  * \brief Coefficients used to couple moments in the SPN equations.
+ *
+ * The \f$\mathbf{D}_n\f$, \f$\mathbf{A}_{nm}\f$, and \f$\mathbf{F}_{nm}\f$
+ * blocks depend only on the equations and the material in a cell, so they
+ * are built once for each material at construction and stored; D(), A(),
+ * and F() return the stored blocks for a cell, and the make_D(), make_A(),
+ * and make_F() functions copy them.  A and F are symmetric in (n,m), so only
+ * the \f$n\le m\f$ blocks are stored, giving \f$N_e + N_e(N_e+1)\f$
+ * blocks of size \f$N_g\times N_g\f$ for each material.
  */
 /*!
  * \example spn/test/tstMoment_Coefficients.cc
@@ -93,6 +102,26 @@ class Moment_Coefficients
     // Get F fission matrix block entries.
     void make_F(int n, int m, int cell, Serial_Matrix &F);
 
+    // >>> STORED BLOCKS
+
+    //! Diffusion matrix for equation n in a cell.
+    const Serial_Matrix& D(int n, int cell) const
+    {
+        return block(*d_D, key(n, d_mat->matid(cell)));
+    }
+
+    //! A-matrix block (n,m) in a cell.
+    const Serial_Matrix& A(int n, int m, int cell) const
+    {
+        return block(*d_A, key(n, m, d_mat->matid(cell)));
+    }
+
+    //! F fission matrix block (n,m) in a cell.
+    const Serial_Matrix& F(int n, int m, int cell) const
+    {
+        return block(*d_F, key(n, m, d_mat->matid(cell)));
+    }
+
     // >>> ACCESSORS
 
     //! Number of groups.
@@ -151,6 +180,9 @@ class Moment_Coefficients
     // Storage for all Sigma matrices
     RCP_Hash_Table d_Sigma;
 
+    // Storage for the D, A, and F blocks of each material.
+    RCP_Hash_Table d_D, d_A, d_F;
+
     // Minimum scattering moments in cross section data across all materials.
     int d_min_moments;
 
@@ -164,6 +196,30 @@ class Moment_Coefficients
     Vec_Dbl d_work;
     Vec_Int d_ipiv;
     int     d_info;
+
+    // >>> IMPLEMENTATION
+
+    // Build the blocks for a material.
+    void build_D(int n, int matid, Serial_Matrix &D);
+    void build_A(int n, int m, int matid, Serial_Matrix &A);
+    void build_F(int n, int m, int matid, Serial_Matrix &F);
+
+    //! Key of a (moment, matid) block.
+    static def::size_type key(int n, int matid) { return n + 8 * matid; }
+
+    //! Key of a symmetric (n, m, matid) block.
+    static def::size_type key(int n, int m, int matid)
+    {
+        return n <= m ? n + 4 * m + 16 * matid : m + 4 * n + 16 * matid;
+    }
+
+    //! Stored block for a key.
+    static const Serial_Matrix& block(const Hash_Table &table,
+                                      def::size_type key)
+    {
+        REQUIRE(table.exists(key));
+        return *table.at(key);
+    }
 };
 
 } // end namespace profugus
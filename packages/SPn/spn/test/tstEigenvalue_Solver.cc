@@ -61,7 +61,8 @@ class Inf_Med_Eigenvalue_SolverTest : public testing::Test
     }
 
     void build(int order,
-               int Ng)
+               int Ng,
+               bool adjoint = false)
     {
         num_groups = Ng;
         eqn_order  = order;
@@ -176,10 +177,11 @@ class Inf_Med_Eigenvalue_SolverTest : public testing::Test
         try
         {
             dim = Teuchos::rcp(new profugus::Dimensions(eqn_order));
-            solver->setup(dim, matf, mesh, indexer, data);
+            solver->setup(dim, matf, mesh, indexer, data, adjoint);
         }
 
         TEUCHOS_STANDARD_CATCH_STATEMENTS(verbose, std::cerr, success);
+        setup_success = success;
 
         // make a state object
         state = Teuchos::rcp(new profugus::State(mesh, num_groups));
@@ -199,6 +201,7 @@ class Inf_Med_Eigenvalue_SolverTest : public testing::Test
     RCP_State state;
 
     int num_groups, eqn_order;
+    bool setup_success;
 
     int node, nodes;
 };
@@ -341,6 +344,28 @@ TYPED_TEST(Inf_Med_Eigenvalue_SolverTest, 3Grp_SP3)
     }
 }
 
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(Inf_Med_Eigenvalue_SolverTest, matrix_free_errors)
+{
+    this->db->set("eqn_type", std::string("fv_mf"));
+
+    // the matrix-free operator cannot be transposed
+    this->build(1, 3, true);
+    EXPECT_FALSE(this->setup_success);
+
+    // algebraic preconditioners need the assembled matrix
+    Teuchos::ParameterList &edb = this->db->sublist("eigenvalue_db");
+    edb.set("Preconditioner", std::string("Ifpack"));
+    this->build(1, 3);
+    EXPECT_FALSE(this->setup_success);
+
+    // the same problem with an assembled matrix is fine
+    this->db->set("eqn_type", std::string("fv"));
+    this->build(1, 3);
+    EXPECT_TRUE(this->setup_success);
+}
+
 //---------------------------------------------------------------------------//
 //                 end of tstEigenvalue_Solver.cc
 //---------------------------------------------------------------------------//
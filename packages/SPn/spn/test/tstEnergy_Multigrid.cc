@@ -8,6 +8,7 @@
  */
 //---------------------------------------------------------------------------//
 
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <iomanip>
@@ -26,7 +27,10 @@
 #include "../Linear_System_FV.hh"
 #include "../Dimensions.hh"
 #include "../Energy_Multigrid.hh"
+#include "../Energy_Restriction.hh"
+#include "../Energy_Prolongation.hh"
 #include "../VectorTraits.hh"
+#include "../MatrixTraits.hh"
 
 #include "Test_XS.hh"
 
@@ -152,12 +156,77 @@ class MultigridTest : public testing::Test
         // Create preconditioner
         d_prec = rcp( new Energy_Multigrid(
             db, prec_db, dim, mat, mesh, indexer, data, d_system) );
+
+        // Store the problem for other preconditioners
+        d_db      = db;
+        d_prec_db = prec_db;
+        d_dim     = dim;
+        d_mat     = mat;
+        d_mesh    = mesh;
+        d_indexer = indexer;
+        d_data    = data;
+    }
+
+    // Check that applying an operator to a block of vectors gives the same
+    // result as applying it to each vector.
+    void check_block(const OP &prec)
+    {
+        typedef profugus::VectorTraits<T> VectorTraits;
+
+        // a block of 3 different vectors
+        int num_vecs = 3;
+        RCP<MV> x = VectorTraits::build_vector(d_system->get_Map(), num_vecs);
+        RCP<MV> y = VectorTraits::build_vector(d_system->get_Map(), num_vecs);
+
+        for (int v = 0; v < num_vecs; ++v)
+        {
+            Teuchos::ArrayRCP<double> x_data =
+                VectorTraits::get_data_nonconst(x, v);
+            for (int n = 0; n < x_data.size(); ++n)
+            {
+                x_data[n] = 1.0 + 0.1 * v + 0.01 * ((n + 5 * v) % 17);
+            }
+        }
+
+        // apply the operator to the block
+        OPT::Apply(prec, *x, *y);
+
+        // each column is the same as the operator applied to the single
+        // vector
+        RCP<MV> xv = VectorTraits::build_vector(d_system->get_Map());
+        RCP<MV> yv = VectorTraits::build_vector(d_system->get_Map());
+        for (int v = 0; v < num_vecs; ++v)
+        {
+            Teuchos::ArrayRCP<const double> x_data =
+                VectorTraits::get_data(x, v);
+            Teuchos::ArrayRCP<double> xv_data =
+                VectorTraits::get_data_nonconst(xv, 0);
+            std::copy(x_data.begin(), x_data.end(), xv_data.begin());
+
+            OPT::Apply(prec, *xv, *yv);
+
+            Teuchos::ArrayRCP<const double> y_data =
+                VectorTraits::get_data(y, v);
+            Teuchos::ArrayRCP<const double> yv_data =
+                VectorTraits::get_data(yv, 0);
+            for (int n = 0; n < y_data.size(); ++n)
+            {
+                EXPECT_SOFTEQ(yv_data[n], y_data[n], 1.0e-6);
+            }
+        }
     }
 
     int d_node, d_nodes;
     RCP<Energy_Multigrid> d_prec;
     RCP<Linear_System>    d_system;
 
+    RCP_ParameterList            d_db, d_prec_db;
+    RCP<profugus::Dimensions>    d_dim;
+    RCP<profugus::Mat_DB>        d_mat;
+    Partitioner::RCP_Mesh        d_mesh;
+    Partitioner::RCP_Indexer     d_indexer;
+    Partitioner::RCP_Global_Data d_data;
+
 };
 
 //---------------------------------------------------------------------------//
@@ -204,6 +273,113 @@ TYPED_TEST(MultigridTest, Heuristic)
     }
 }
 
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(MultigridTest, Galerkin)
+{
+    typedef typename TestFixture::Energy_Multigrid Energy_Multigrid;
+    typedef typename TestFixture::MV               MV;
+    typedef typename TestFixture::MVT              MVT;
+    typedef typename TestFixture::OPT              OPT;
+    typedef profugus::VectorTraits<TypeParam>      VectorTraits;
+    typedef profugus::MatrixTraits<TypeParam>      MatrixTraits;
+
+    // make the coarse operators from the fine matrix
+    this->d_prec_db->set("Coarse Operator", string("Galerkin"));
+    RCP<Energy_Multigrid> prec = rcp(new Energy_Multigrid(
+        this->d_db, this->d_prec_db, this->d_dim, this->d_mat, this->d_mesh,
+        this->d_indexer, this->d_data, this->d_system));
+
+    // 12 -> 6 -> 3 -> 2 -> 1 groups
+    EXPECT_EQ(5, prec->num_levels());
+    EXPECT_EQ(this->d_prec->num_levels(), prec->num_levels());
+
+    // the coarse operators are R*A*P on each level
+    int Nf = 12;
+    for (int level = 1; level < prec->num_levels(); ++level)
+    {
+        RCP<const typename TypeParam::MAP> fine_map = prec->get_map(level-1);
+        RCP<const typename TypeParam::MAP> crse_map = prec->get_map(level);
+
+        // collapse by the default coarse factor of 2
+        vector<int> collapse(Nf / 2, 2);
+        if (Nf % 2)
+            collapse.push_back(1);
+        Nf = collapse.size();
+
+        // the coarse groups of each unknown are contiguous in the global
+        // ordering on every domain
+        for (int n = 0, N = VectorTraits::local_size(crse_map); n < N; ++n)
+        {
+            EXPECT_EQ(n % Nf, MatrixTraits::global_row_id(crse_map, n) % Nf);
+        }
+
+        profugus::Energy_Restriction<TypeParam>  R(fine_map, crse_map,
+                                                   collapse);
+        profugus::Energy_Prolongation<TypeParam> P(crse_map, fine_map,
+                                                   collapse);
+
+        RCP<MV> x  = VectorTraits::build_vector(crse_map);
+        RCP<MV> y  = VectorTraits::build_vector(crse_map);
+        RCP<MV> z  = VectorTraits::build_vector(crse_map);
+        RCP<MV> px = VectorTraits::build_vector(fine_map);
+        RCP<MV> ax = VectorTraits::build_vector(fine_map);
+
+        Teuchos::ArrayRCP<double> x_data =
+            VectorTraits::get_data_nonconst(x, 0);
+        for (int n = 0; n < x_data.size(); ++n)
+        {
+            x_data[n] = 1.0 + 0.05 * ((3 * n) % 7);
+        }
+
+        OPT::Apply(*prec->get_operator(level), *x, *y);
+        OPT::Apply(P, *x, *px);
+        OPT::Apply(*prec->get_operator(level-1), *px, *ax);
+        OPT::Apply(R, *ax, *z);
+
+        Teuchos::ArrayRCP<const double> y_data = VectorTraits::get_data(y, 0);
+        Teuchos::ArrayRCP<const double> z_data = VectorTraits::get_data(z, 0);
+        for (int n = 0; n < y_data.size(); ++n)
+        {
+            EXPECT_SOFTEQ(z_data[n], y_data[n], 1.0e-10);
+        }
+    }
+
+    // the V-cycle runs on the Galerkin levels
+    RCP<MV> x = VectorTraits::build_vector(this->d_system->get_Map());
+    RCP<MV> y = VectorTraits::build_vector(this->d_system->get_Map());
+    VectorTraits::put_scalar(x, 1.0);
+    OPT::Apply(*prec, *x, *y);
+
+    vector<double> norm2(1);
+    MVT::MvNorm(*y, norm2);
+    EXPECT_GT(norm2[0], 0.0);
+}
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(MultigridTest, Block)
+{
+    typedef typename TestFixture::Energy_Multigrid Energy_Multigrid;
+
+    // one AztecOO iteration on each level
+    this->check_block(*(this->d_prec));
+
+    // Richardson smoothers iterated to a tolerance, so the columns of a
+    // block converge after different numbers of iterations
+    RCP_ParameterList prec_db = rcp(new ParameterList(*(this->d_prec_db)));
+    ParameterList &smoother_db = prec_db->sublist("Smoother");
+    smoother_db.set("solver_type", string("profugus"));
+    smoother_db.set("profugus_solver", string("Richardson"));
+    smoother_db.set("tolerance", 1.0e-4);
+    smoother_db.set("max_itr", 20);
+
+    RCP<Energy_Multigrid> prec = rcp(new Energy_Multigrid(
+        this->d_db, prec_db, this->d_dim, this->d_mat, this->d_mesh,
+        this->d_indexer, this->d_data, this->d_system));
+    this->check_block(*prec);
+}
+
 //---------------------------------------------------------------------------//
 //                 end of tstEnergy_Multigrid.cc
 //---------------------------------------------------------------------------//
@@ -27,6 +27,7 @@
 #include "../Isotropic_Source.hh"
 #include "../Dimensions.hh"
 #include "../Linear_System_FV.hh"
+#include "../FV_Operator.hh"
 #include "../MatrixTraits.hh"
 #include "../VectorTraits.hh"
 #include "Test_XS.hh"
@@ -1293,6 +1294,248 @@ TYPED_TEST(MatrixTest, SP3_2Grp_Vac_Matrix)
 
 //---------------------------------------------------------------------------//
 
+TYPED_TEST(MatrixTest, SP3_2Grp_Vac_Threaded_Matrix)
+{
+    typedef typename TestFixture::Linear_System     Linear_System;
+    typedef typename TestFixture::RCP_Linear_System RCP_Linear_System;
+    typedef typename TestFixture::Matrix_t          Matrix_t;
+    typedef profugus::MatrixTraits<TypeParam>       MatrixTraits;
+
+    // build the mesh and data
+    this->build(3, 2);
+    RCP_ParameterList db = this->db;
+    db->set("boundary", string("vacuum"));
+
+    // make the matrix on 1 thread
+    this->make_data();
+    RCP_Linear_System serial = this->system;
+    serial->build_Matrix();
+
+    // make the matrix on 3 threads (the cells are not evenly divided)
+    db->set("num_threads", 3);
+    RCP_Linear_System threaded = Teuchos::rcp(new Linear_System(
+        db, this->dim, this->mat, this->mesh, this->indexer, this->data));
+    threaded->build_Matrix();
+
+    Teuchos::RCP<const Matrix_t> A = Teuchos::rcp_dynamic_cast<const Matrix_t>(
+        serial->get_Operator());
+    Teuchos::RCP<const Matrix_t> B = Teuchos::rcp_dynamic_cast<const Matrix_t>(
+        threaded->get_Operator());
+
+    // the matrices are identical
+    int N = MatrixTraits::local_rows(A);
+    EXPECT_EQ(N, MatrixTraits::local_rows(B));
+    EXPECT_EQ(MatrixTraits::global_nonzeros(A),
+              MatrixTraits::global_nonzeros(B));
+
+    Teuchos::ArrayView<const int>    a_indices, b_indices;
+    Teuchos::ArrayView<const double> a_values,  b_values;
+    for (int row = 0; row < N; ++row)
+    {
+        MatrixTraits::get_local_row_view(A, row, a_indices, a_values);
+        MatrixTraits::get_local_row_view(B, row, b_indices, b_values);
+        ASSERT_EQ(a_indices.size(), b_indices.size());
+
+        for (int n = 0; n < a_indices.size(); ++n)
+        {
+            EXPECT_EQ(MatrixTraits::global_col_id(A, a_indices[n]),
+                      MatrixTraits::global_col_id(B, b_indices[n]));
+            EXPECT_EQ(a_values[n], b_values[n]);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(MatrixTest, SP3_2Grp_Vac_Matrix_Free)
+{
+    typedef typename TestFixture::Linear_System     Linear_System;
+    typedef typename TestFixture::RCP_Linear_System RCP_Linear_System;
+    typedef profugus::VectorTraits<TypeParam>       VectorTraits;
+    typedef profugus::FV_Operator<TypeParam>        FV_Operator;
+    typedef typename TypeParam::MV                  MV;
+    typedef typename TypeParam::OP                  OP;
+    typedef Anasazi::OperatorTraits<double,MV,OP>   OPT;
+
+    using def::I; using def::J; using def::K;
+
+    // make non-uniform mesh
+    Array_Dbl &cx = this->cx;
+    Array_Dbl &cy = this->cy;
+    Array_Dbl &cz = this->cz;
+
+    double x_edges[] = {0.0, 0.8, 1.7, 2.7, 3.8};
+    double y_edges[] = {0.0, 0.7, 1.5, 2.4, 3.4};
+    double z_edges[] = {0.0, 0.6, 1.3, 2.1, 3.0};
+    cx.assign(x_edges, x_edges + 5);
+    cy.assign(y_edges, y_edges + 5);
+    cz.assign(z_edges, z_edges + 5);
+
+    // build the mesh and data
+    this->build(3, 2);
+    RCP_ParameterList db = this->db;
+    RCP_Mesh mesh = this->mesh;
+    RCP_Indexer indexer = this->indexer;
+
+    // 2 materials in alternating planes of x
+    vector<int>    ids(2, 0);
+    vector<double> f(2, 0.0);
+    vector<int>    matids(mesh->num_cells(), 0);
+    ids[0] = 9;  f[0] = 0.9;
+    ids[1] = 11; f[1] = 1.1;
+
+    for (int k = 0; k < mesh->num_cells_dim(K); ++k)
+    {
+        for (int j = 0; j < mesh->num_cells_dim(J); ++j)
+        {
+            for (int i = 0; i < mesh->num_cells_dim(I); ++i)
+            {
+                int g = indexer->l2g(i, j, k) % 4;
+                matids[indexer->l2l(i, j, k)] = g % 2 ? 11 : 9;
+            }
+        }
+    }
+
+    // make vacuum boundary conditions
+    db->set("boundary", string("vacuum"));
+
+    // make the assembled operator
+    this->make_data(ids, f, matids);
+    RCP_Linear_System assembled = this->system;
+    assembled->build_Matrix();
+
+    // make the matrix-free operator on 2 threads
+    db->set("eqn_type", string("fv_mf"));
+    db->set("num_threads", 2);
+    RCP_Linear_System matrix_free = Teuchos::rcp(new Linear_System(
+        db, this->dim, this->mat, mesh, indexer, this->data));
+    matrix_free->build_Matrix();
+    EXPECT_TRUE(matrix_free->get_Matrix().is_null());
+
+    Teuchos::RCP<const FV_Operator> op =
+        Teuchos::rcp_dynamic_cast<const FV_Operator>(
+            matrix_free->get_Operator());
+    ASSERT_FALSE(op.is_null());
+    EXPECT_EQ(FV_Operator::SPN_OPERATOR, op->type());
+
+    // only the material interfaces (and block boundaries) are stored
+    if (nodes == 1)
+    {
+        EXPECT_EQ(96, op->num_stored_blocks());
+    }
+
+    // apply both operators to the same vector
+    Teuchos::RCP<MV> x = VectorTraits::build_vector(assembled->get_Map());
+    Teuchos::RCP<MV> y = VectorTraits::build_vector(assembled->get_Map());
+    Teuchos::RCP<MV> z = VectorTraits::build_vector(assembled->get_Map());
+    Teuchos::ArrayRCP<double> x_data = VectorTraits::get_data_nonconst(x,0);
+    for (int n = 0; n < x_data.size(); ++n)
+    {
+        x_data[n] = 1.0 + 0.1 * node + 0.01 * ((7 * n) % 13);
+    }
+
+    OPT::Apply(*assembled->get_Operator(), *x, *y);
+    OPT::Apply(*matrix_free->get_Operator(), *x, *z);
+
+    Teuchos::ArrayRCP<const double> y_data = VectorTraits::get_data(y,0);
+    Teuchos::ArrayRCP<const double> z_data = VectorTraits::get_data(z,0);
+    ASSERT_EQ(y_data.size(), z_data.size());
+    for (int n = 0; n < y_data.size(); ++n)
+    {
+        EXPECT_SOFTEQ(y_data[n], z_data[n], 1.0e-10);
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(MatrixTest, SP7_3Grp_Refl_Matrix_Free)
+{
+    typedef typename TestFixture::Linear_System     Linear_System;
+    typedef typename TestFixture::RCP_Linear_System RCP_Linear_System;
+    typedef profugus::VectorTraits<TypeParam>       VectorTraits;
+    typedef typename TypeParam::MV                  MV;
+    typedef typename TypeParam::OP                  OP;
+    typedef Anasazi::OperatorTraits<double,MV,OP>   OPT;
+
+    using def::I; using def::J; using def::K;
+
+    this->build(7, 3);
+    RCP_Mesh mesh = this->mesh;
+    RCP_Indexer indexer = this->indexer;
+
+    // 2 materials in alternating planes of y
+    vector<int>    ids(2, 0);
+    vector<double> f(2, 0.0);
+    vector<int>    matids(mesh->num_cells(), 0);
+    ids[0] = 9;  f[0] = 1.0;
+    ids[1] = 11; f[1] = 0.5;
+
+    for (int k = 0; k < mesh->num_cells_dim(K); ++k)
+    {
+        for (int j = 0; j < mesh->num_cells_dim(J); ++j)
+        {
+            for (int i = 0; i < mesh->num_cells_dim(I); ++i)
+            {
+                int g = (indexer->l2g(i, j, k) / 4) % 4;
+                matids[indexer->l2l(i, j, k)] = g % 2 ? 11 : 9;
+            }
+        }
+    }
+
+    // make the assembled operators
+    this->make_data(ids, f, matids);
+    RCP_Linear_System assembled = this->system;
+    assembled->build_Matrix();
+    assembled->build_fission_matrix();
+
+    // make the matrix-free operators
+    RCP_ParameterList db = this->db;
+    db->set("eqn_type", string("fv_mf"));
+    RCP_Linear_System matrix_free = Teuchos::rcp(new Linear_System(
+        db, this->dim, this->mat, mesh, indexer, this->data));
+    matrix_free->build_Matrix();
+    matrix_free->build_fission_matrix();
+    EXPECT_TRUE(matrix_free->get_Matrix().is_null());
+
+    Teuchos::RCP<MV> x = VectorTraits::build_vector(assembled->get_Map());
+    Teuchos::RCP<MV> y = VectorTraits::build_vector(assembled->get_Map());
+    Teuchos::RCP<MV> z = VectorTraits::build_vector(assembled->get_Map());
+    Teuchos::ArrayRCP<double> x_data = VectorTraits::get_data_nonconst(x,0);
+    EXPECT_EQ(mesh->num_cells() * 4 * 3, x_data.size());
+    for (int n = 0; n < x_data.size(); ++n)
+    {
+        x_data[n] = 1.0 - 0.1 * node + 0.02 * ((5 * n) % 11);
+    }
+
+    // SPN operator
+    {
+        OPT::Apply(*assembled->get_Operator(), *x, *y);
+        OPT::Apply(*matrix_free->get_Operator(), *x, *z);
+
+        Teuchos::ArrayRCP<const double> y_data = VectorTraits::get_data(y,0);
+        Teuchos::ArrayRCP<const double> z_data = VectorTraits::get_data(z,0);
+        for (int n = 0; n < y_data.size(); ++n)
+        {
+            EXPECT_SOFTEQ(y_data[n], z_data[n], 1.0e-10);
+        }
+    }
+
+    // fission operator
+    {
+        OPT::Apply(*assembled->get_fission_matrix(), *x, *y);
+        OPT::Apply(*matrix_free->get_fission_matrix(), *x, *z);
+
+        Teuchos::ArrayRCP<const double> y_data = VectorTraits::get_data(y,0);
+        Teuchos::ArrayRCP<const double> z_data = VectorTraits::get_data(z,0);
+        for (int n = 0; n < y_data.size(); ++n)
+        {
+            EXPECT_SOFTEQ(y_data[n], z_data[n], 1.0e-10);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+
 TYPED_TEST(MatrixTest, SP7_3Grp_Refl_RHS)
 {
     typedef typename TestFixture::RCP_Linear_System RCP_Linear_System;
@@ -861,6 +861,41 @@ TEST_F(Moment_CoefficientsTest, F_3gp)
 
 //---------------------------------------------------------------------------//
 
+TEST_F(Moment_CoefficientsTest, Stored_blocks)
+{
+    make_dim(7);
+
+    Moment_Coefficients mc(db, dim, mat3);
+    Serial_Matrix M(3, 3);
+
+    // the blocks are stored once per material and shared by its cells
+    for (int cell = 0; cell < mat3->num_cells(); ++cell)
+    {
+        for (int n = 0; n < 4; ++n)
+        {
+            EXPECT_EQ(&mc.D(n, 0), &mc.D(n, cell));
+
+            mc.make_D(n, cell, M);
+            check_matrices(mc.D(n, cell), M, 0.0);
+
+            for (int m = 0; m < 4; ++m)
+            {
+                EXPECT_EQ(&mc.A(n, m, 0), &mc.A(n, m, cell));
+                EXPECT_EQ(&mc.A(n, m, cell), &mc.A(m, n, cell));
+                EXPECT_EQ(&mc.F(n, m, cell), &mc.F(m, n, cell));
+
+                mc.make_A(n, m, cell, M);
+                check_matrices(mc.A(n, m, cell), M, 0.0);
+
+                mc.make_F(n, m, cell, M);
+                check_matrices(mc.F(n, m, cell), M, 0.0);
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+
 TEST(Static_Functions, Convert_U_to_Phi)
 {
     double u0 = 11.3;
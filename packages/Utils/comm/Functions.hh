@@ -287,6 +287,22 @@ void receive_async_comm(Request& request, T *buffer,
         const Communicator_t& comm, int size,
         int source, int tag = Comm_Traits<T*>::tag);
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Do a non-blocking element-wise sum of an array.
+ *
+ * The sum of \c x over all nodes is stored in \c y on \c to_node when the
+ * request completes.  Neither buffer may be used until then.  All nodes must
+ * post non-blocking reductions in the same order.
+ *
+ * \param request request that is set while the reduction is in flight
+ * \param x send array of length \c n
+ * \param y receive array of length \c n (only used on \c to_node)
+ * \param to_node node that result is stored in
+ */
+template<class T>
+void sum_async(Request &request, const T *x, T *y, int n, int to_node);
+
 //---------------------------------------------------------------------------//
 // BROADCAST
 //---------------------------------------------------------------------------//
@@ -226,6 +226,27 @@ void receive_async_comm(
               comm, &request.r());
 }
 
+//---------------------------------------------------------------------------//
+
+template<class T>
+void sum_async(Request &request,
+               const T *x,
+               T       *y,
+               int      n,
+               int      to_node)
+{
+    REQUIRE(!request.inuse());
+    REQUIRE(x);
+    REQUIRE(node() != to_node || y);
+
+    // set the request
+    request.set();
+
+    // post an MPI_Ireduce (result is on to_node) into y
+    MPI_Ireduce(const_cast<T *>(x), y, n, MPI_Traits<T>::element_type(),
+                MPI_SUM, to_node, communicator, &request.r());
+}
+
 //---------------------------------------------------------------------------//
 // BROADCAST
 //---------------------------------------------------------------------------//
@@ -94,6 +94,16 @@ template void receive_async_comm(Request &, float *, const MPI_Comm&, int, int,
 template void receive_async_comm(Request &, double *, const MPI_Comm&, int, int, int);
 template void receive_async_comm(Request &, long double *, const MPI_Comm&, int, int, int);
 
+template void sum_async(Request &, const short *, short *, int, int);
+template void sum_async(Request &, const unsigned short *, unsigned short *, int, int);
+template void sum_async(Request &, const int *, int *, int, int);
+template void sum_async(Request &, const unsigned int *, unsigned int *, int, int);
+template void sum_async(Request &, const long *, long *, int, int);
+template void sum_async(Request &, const unsigned long *, unsigned long *, int, int);
+template void sum_async(Request &, const float *, float *, int, int);
+template void sum_async(Request &, const double *, double *, int, int);
+template void sum_async(Request &, const long double *, long double *, int, int);
+
 } // end namespace profugus
 
 #endif // COMM_MPI
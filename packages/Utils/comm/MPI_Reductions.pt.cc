@@ -245,6 +245,8 @@ template void all_to_all(const double *, double *, int);
 template void all_to_all(const long double *, long double *, int);
 
 
+template void all_to_all(const char *, const int *, const int *,
+                               char *, const int *, const int *);
 template void all_to_all(const short *, const int *, const int *,
                                short *, const int *, const int *);
 template void all_to_all(const unsigned short *, const int *, const int *,
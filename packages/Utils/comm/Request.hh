@@ -151,6 +151,9 @@ class Request
     template<class T>
     friend void receive_async_comm(Request &r, T *buf,
             const Communicator_t& comm, int nels, int source, int tag);
+
+    template<class T>
+    friend void sum_async(Request &r, const T *x, T *y, int n, int to_node);
 };
 
 } // end namespace profugus
@@ -33,6 +33,7 @@ int RNG::d_packed_size = 0;
 RNG::RNG(const std::vector<char> &packed)
     : d_streamid(0)
     , d_stream(0)
+    , d_next(-1)
 {
     REQUIRE(packed.size() >= 2 * sizeof(int));
 
@@ -66,6 +67,36 @@ RNG::RNG(const std::vector<char> &packed)
     ENSURE(d_streamid);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Counter-based stream constructor.
+ *
+ * \param seed problem random number seed
+ * \param key additional key, ie. the cycle index
+ * \param id stream index, ie. the global history index
+ *
+ * Streams built from different (seed, key, id) triplets are statistically
+ * independent.
+ */
+RNG::RNG(std::uint32_t seed,
+         std::uint32_t key,
+         std::uint64_t id)
+    : d_streamid(0)
+    , d_stream(0)
+    , d_next(4)
+{
+    d_key[0] = seed;
+    d_key[1] = key;
+
+    // the low words count blocks in the stream, the high words are the id
+    d_ctr[0] = 0;
+    d_ctr[1] = 0;
+    d_ctr[2] = static_cast<std::uint32_t>(id);
+    d_ctr[3] = static_cast<std::uint32_t>(id >> 32);
+
+    ENSURE(counter_based());
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \brief Pack a RNG object into a vector<char>.
@@ -108,6 +139,19 @@ std::vector<char> RNG::pack() const
  */
 RNG& RNG::operator=(const RNG &rhs)
 {
+    // counter-based streams are copied by value
+    d_next = rhs.d_next;
+    if (d_next >= 0)
+    {
+        d_key[0] = rhs.d_key[0];
+        d_key[1] = rhs.d_key[1];
+        for (int i = 0; i < 4; ++i)
+        {
+            d_ctr[i]   = rhs.d_ctr[i];
+            d_block[i] = rhs.d_block[i];
+        }
+    }
+
     // check to see if the values are the same
     if (d_streamid == rhs.d_streamid && d_stream == rhs.d_stream)
         return *this;
@@ -152,6 +196,53 @@ int RNG::get_size() const
     return d_packed_size;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Generate the next block of counter-based random bits.
+ *
+ * This is the Philox-4x32-10 bijection applied to the current counter, after
+ * which the (128-bit) counter is advanced.
+ */
+void RNG::next_block() const
+{
+    REQUIRE(counter_based());
+
+    // Philox multipliers and Weyl key increments
+    const std::uint64_t m0 = 0xD2511F53, m1 = 0xCD9E8D57;
+    const std::uint32_t w0 = 0x9E3779B9, w1 = 0xBB67AE85;
+
+    std::uint32_t c[4] = {d_ctr[0], d_ctr[1], d_ctr[2], d_ctr[3]};
+    std::uint32_t k[2] = {d_key[0], d_key[1]};
+
+    for (int round = 0; round < 10; ++round)
+    {
+        std::uint64_t p0 = m0 * c[0];
+        std::uint64_t p1 = m1 * c[2];
+
+        std::uint32_t hi0 = static_cast<std::uint32_t>(p0 >> 32);
+        std::uint32_t lo0 = static_cast<std::uint32_t>(p0);
+        std::uint32_t hi1 = static_cast<std::uint32_t>(p1 >> 32);
+        std::uint32_t lo1 = static_cast<std::uint32_t>(p1);
+
+        c[0] = hi1 ^ c[1] ^ k[0];
+        c[1] = lo1;
+        c[2] = hi0 ^ c[3] ^ k[1];
+        c[3] = lo0;
+
+        k[0] += w0;
+        k[1] += w1;
+    }
+
+    for (int i = 0; i < 4; ++i)
+        d_block[i] = c[i];
+    d_next = 0;
+
+    // advance the block counter (carrying into the id words is not expected
+    // within a single history)
+    if (++d_ctr[0] == 0 && ++d_ctr[1] == 0)
+        ++d_ctr[2];
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \brief Do a diagnostic print.
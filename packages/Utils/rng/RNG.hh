@@ -12,6 +12,7 @@
 #define Utils_rng_RNG_hh
 
 #include <vector>
+#include <cstdint>
 
 #include <Utils/config.h>
 #include "harness/DBC.hh"
@@ -55,6 +56,18 @@ namespace profugus
  * with Profugus in the rng/sprng sub-directory under the provisions of the
  * SPRNG opensource license.
  *
+ * \par Counter-based streams
+ *
+ * An RNG can alternatively be constructed from a (seed, key, id) triplet, in
+ * which case it is a stateless Philox-4x32-10 counter-based generator
+ * (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3", SC11).  The
+ * \f$i\f$-th random number of the stream is a pure function of the
+ * triplet and \f$i\f$, so streams can be created independently on any
+ * process or thread without communication.  Counter-based streams hold all
+ * of their state in the object (no library memory is allocated); thus, \b
+ * unlike SPRNG streams, copies of a counter-based RNG advance independently.
+ * Counter-based streams cannot be packed or spawned.
+ *
  * \sa <a href="http://sprng.cs.fsu.edu/">SPRNG</a>, RNG_Control
  */
 /*!
@@ -95,18 +108,31 @@ class RNG
     // Size of the packed state
     static int d_packed_size;
 
+    // Counter-based stream key and counter (unused by SPRNG streams).
+    std::uint32_t         d_key[2];
+    mutable std::uint32_t d_ctr[4];
+
+    // Current block of counter-based random bits and the next unused entry
+    // in it (-1 for SPRNG streams).
+    mutable std::uint32_t d_block[4];
+    mutable int           d_next;
+
   public:
     // Constructors
-    inline RNG() : d_streamid(0), d_stream(0) {}
+    inline RNG();
     inline RNG(int *, int);
     inline RNG(const RNG &);
     RNG(const std::vector<char> &);
+    RNG(std::uint32_t seed, std::uint32_t key, std::uint64_t id);
 
     // Destructor, reclaim memory from SPRNG library.
     inline ~RNG();
 
     // Is RNG assigned?
-    bool assigned() const { return d_streamid != 0; }
+    bool assigned() const { return d_streamid != 0 || d_next >= 0; }
+
+    //! Is this a counter-based stream?
+    bool counter_based() const { return d_next >= 0; }
 
     // Assignment operator.
     RNG& operator=(const RNG &);
@@ -148,18 +174,50 @@ class RNG
     // Return a double-precision uniform value
     double uniform_impl(Type_Switch<double>) const
     {
-        return ::get_rn_dbl(d_streamid->id);
+        if (d_streamid)
+            return ::get_rn_dbl(d_streamid->id);
+
+        // 53 random bits from two 32-bit words
+        std::uint32_t a = next_word() >> 5, b = next_word() >> 6;
+        return (a * 67108864.0 + b) * (1.0 / 9007199254740992.0);
     }
 
     // Return a single-precision uniform value
     float uniform_impl(Type_Switch<float>) const
     {
-        return ::get_rn_flt(d_streamid->id);
+        if (d_streamid)
+            return ::get_rn_flt(d_streamid->id);
+
+        // 24 random bits from one 32-bit word
+        return (next_word() >> 8) * (1.0f / 16777216.0f);
+    }
+
+    // Return the next 32 random bits from a counter-based stream.
+    std::uint32_t next_word() const
+    {
+        REQUIRE(counter_based());
+        if (d_next == 4)
+            next_block();
+        return d_block[d_next++];
     }
+
+    // Generate the next block of counter-based random bits.
+    void next_block() const;
 };
 
 //---------------------------------------------------------------------------//
 // INLINE RNG MEMBERS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Default constructor.
+ */
+RNG::RNG()
+    : d_streamid(0)
+    , d_stream(0)
+    , d_next(-1)
+{
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \brief Constructor.
@@ -167,6 +225,7 @@ class RNG
 RNG::RNG(int *idval, int number)
     : d_streamid(new RNGValue(idval))
     , d_stream(number)
+    , d_next(-1)
 {
 }
 
@@ -177,9 +236,21 @@ RNG::RNG(int *idval, int number)
 RNG::RNG(const RNG &rhs)
     : d_streamid(rhs.d_streamid)
     , d_stream(rhs.d_stream)
+    , d_next(rhs.d_next)
 {
     if (d_streamid)
         ++d_streamid->refcount;
+
+    if (d_next >= 0)
+    {
+        d_key[0] = rhs.d_key[0];
+        d_key[1] = rhs.d_key[1];
+        for (int i = 0; i < 4; ++i)
+        {
+            d_ctr[i]   = rhs.d_ctr[i];
+            d_block[i] = rhs.d_block[i];
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//
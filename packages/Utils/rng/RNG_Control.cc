@@ -154,6 +154,26 @@ RNG_Control::RNG_t RNG_Control::spawn(const RNG_t &random) const
     return ran;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Create a counter-based random number object.
+ *
+ * \param key user key, ie. the cycle index
+ * \param id user id, ie. the global history index
+ * \return counter-based random number object
+ *
+ * The returned stream depends only on the seed, \a key, and \a id; it does
+ * not advance the SPRNG stream index.
+ */
+RNG_Control::RNG_t RNG_Control::counter_rng(std::uint32_t key,
+                                            std::uint64_t id) const
+{
+    RNG random(static_cast<std::uint32_t>(d_seed), key, id);
+
+    ENSURE(random.counter_based());
+    return random;
+}
+
 //---------------------------------------------------------------------------//
 // PRIVATE FUNCTIONS
 //---------------------------------------------------------------------------//
@@ -11,6 +11,8 @@
 #ifndef Utils_rng_RNG_Control_hh
 #define Utils_rng_RNG_Control_hh
 
+#include <cstdint>
+
 #include "harness/DBC.hh"
 #include "RNG.hh"
 
@@ -42,6 +44,11 @@ namespace profugus
  * function or by reseting the random number stream index through the
  * set_num(int) function.
  *
+ * Counter-based random number objects are created with counter_rng().  These
+ * do not use SPRNG or the stream index; they are a pure function of the seed,
+ * a user key, and a user id, so this function is const and may be called
+ * concurrently.
+ *
  * \sa <a href="http://sprng.cs.fsu.edu/">SPRNG (Scalable
  * Parallel Random Number Generator Library)</a>, SPRNG
  */
@@ -91,6 +98,9 @@ class RNG_Control
     // Spawn a new random number object.
     RNG_t spawn(const RNG_t &) const;
 
+    // Create a counter-based random number object.
+    RNG_t counter_rng(std::uint32_t key, std::uint64_t id) const;
+
     //! Query for the current random number stream index.
     int get_num() const { return d_stream; }
 
@@ -278,6 +278,65 @@ TEST(RNG, Pack)
     }
 }
 
+//---------------------------------------------------------------------------//
+
+TEST(RNG, counter)
+{
+    // Philox-4x32-10 known-answer values for a zero key and counter
+    {
+        RNG ran(0, 0, 0);
+        EXPECT_TRUE(ran.assigned());
+        EXPECT_TRUE(ran.counter_based());
+
+        EXPECT_FLOAT_EQ(0x6627e8 / 16777216.0f, ran.uniform<float>());
+        EXPECT_FLOAT_EQ(0xe169c5 / 16777216.0f, ran.uniform<float>());
+        EXPECT_FLOAT_EQ(0xbc57ac / 16777216.0f, ran.uniform<float>());
+        EXPECT_FLOAT_EQ(0x9b00db / 16777216.0f, ran.uniform<float>());
+    }
+
+    // streams are reproducible and copies advance independently
+    RNG a(seed, 3, 12345);
+    RNG b(seed, 3, 12345);
+    RNG c(seed, 4, 12345);
+    RNG d(seed, 3, 12346);
+
+    for (int i = 0; i < 10; ++i)
+        a.ran();
+    RNG e(a);
+
+    double ref[100];
+    for (int i = 0; i < 10; ++i)
+        b.ran();
+    for (int i = 0; i < 100; ++i)
+    {
+        ref[i]  = b.ran();
+        double r = a.ran();
+        EXPECT_EQ(ref[i], r);
+        EXPECT_GE(r, 0.0);
+        EXPECT_LT(r, 1.0);
+
+        EXPECT_NE(r, c.ran());
+        EXPECT_NE(r, d.ran());
+    }
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(ref[i], e.ran());
+    }
+
+    // assignment copies the state
+    RNG f;
+    EXPECT_FALSE(f.assigned());
+    f = b;
+    EXPECT_EQ(b.ran(), f.ran());
+
+    // check the mean of a long sequence
+    RNG g(seed, 0, 1);
+    double sum = 0.0;
+    for (int i = 0; i < 100000; ++i)
+        sum += g.ran();
+    EXPECT_SOFTEQ(0.5, sum / 100000, 0.01);
+}
+
 //---------------------------------------------------------------------------//
 //                 end of tstRNG.cc
 //---------------------------------------------------------------------------//
@@ -75,6 +75,34 @@ TEST(RNG_Control, controller)
     EXPECT_EQ(control.get_size(), pack.size());
 }
 
+//---------------------------------------------------------------------------//
+
+TEST(RNG_Control, counter)
+{
+    typedef profugus::RNG_Control::RNG_t RNG;
+
+    profugus::RNG_Control control(seed);
+
+    // counter-based streams do not change the stream index
+    RNG r0 = control.counter_rng(1, 10);
+    RNG r1 = control.counter_rng(1, 11);
+    RNG rr0 = control.counter_rng(1, 10);
+    EXPECT_EQ(0, control.get_num());
+    EXPECT_TRUE(r0.counter_based());
+
+    // streams are a pure function of the seed, key, and id
+    RNG rs(seed, 1, 10);
+    for (int i = 0; i < 100; i++)
+    {
+        double rn0  = r0.ran();
+        double rrn0 = rr0.ran();
+
+        EXPECT_EQ(rrn0, rn0);
+        EXPECT_EQ(rn0, rs.ran());
+        EXPECT_NE(rn0, r1.ran());
+    }
+}
+
 //---------------------------------------------------------------------------//
 //                 end of tstRNG_Control.cc
 //---------------------------------------------------------------------------//
@@ -231,6 +231,102 @@ void Serial_HDF5_Writer::write(const std_string &name,
     H5LTmake_dataset_char(current_loc(), name.c_str(), 1, dims, value);
 }
 
+//---------------------------------------------------------------------------//
+// EXTENDIBLE WRITE INTERFACE
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Create a chunked dataset of rows that can be extended.
+ *
+ * The dataset has dimensions \c [0, row_size] with an unlimited first
+ * dimension; each chunk holds one row.  Rows are added with append_row().
+ *
+ * \param name name of the dataset
+ * \param row_size number of doubles in each row
+ */
+void Serial_HDF5_Writer::create_extendible_dataset(const std_string &name,
+                                                   std::size_t       row_size)
+{
+    REQUIRE(!is_readonly());
+    REQUIRE(row_size > 0);
+
+    if (b_node != b_master)
+        return;
+
+    // dimensions
+    hsize_t dims[2]    = {0, row_size};
+    hsize_t maxdims[2] = {H5S_UNLIMITED, row_size};
+    hsize_t chunk[2]   = {1, row_size};
+
+    // create the dataspace and the chunked layout
+    hid_t filespace = H5Screate_simple(2, dims, maxdims);
+    hid_t plist     = H5Pcreate(H5P_DATASET_CREATE);
+    H5Pset_chunk(plist, 2, chunk);
+
+    // create the dataset
+    hid_t dset_id = H5Dcreate(current_loc(), name.c_str(), H5T_NATIVE_DOUBLE,
+                              filespace, H5P_DEFAULT, plist, H5P_DEFAULT);
+    VALIDATE(dset_id >= 0, "Failed to create extendible dataset " << name
+             << " at " << current_loc());
+
+    H5Dclose(dset_id);
+    H5Pclose(plist);
+    H5Sclose(filespace);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Append a row to an extendible dataset.
+ *
+ * \param name name of a dataset made by create_extendible_dataset()
+ * \param row data to write
+ * \param row_size number of elements, which must equal the row size of the
+ * dataset
+ */
+void Serial_HDF5_Writer::append_row(const std_string &name,
+                                    const double     *row,
+                                    std::size_t       row_size)
+{
+    REQUIRE(!is_readonly());
+
+    if (b_node != b_master)
+        return;
+
+    // open the dataset and get its current dimensions
+    hid_t   dset_id   = H5Dopen(current_loc(), name.c_str(), H5P_DEFAULT);
+    hid_t   filespace = H5Dget_space(dset_id);
+    hsize_t dims[2]   = {0, 0};
+    H5Sget_simple_extent_dims(filespace, dims, NULL);
+    H5Sclose(filespace);
+    VALIDATE(dims[1] == row_size, "Row of size " << row_size
+             << " does not match dataset " << name << " of row size "
+             << dims[1]);
+
+    // extend by one row
+    hsize_t extent[2] = {dims[0] + 1, dims[1]};
+    herr_t  status    = H5Dset_extent(dset_id, extent);
+    VALIDATE(status >= 0, "Failed to extend dataset " << name);
+
+    // select the new row
+    hsize_t offset[2] = {dims[0], 0};
+    hsize_t count[2]  = {1, row_size};
+    filespace = H5Dget_space(dset_id);
+    status    = H5Sselect_hyperslab(filespace, H5S_SELECT_SET, offset, NULL,
+                                    count, NULL);
+    VALIDATE(status >= 0, "Failed to select hyperslab at " << current_loc());
+
+    // write the data
+    hid_t memspace = H5Screate_simple(2, count, NULL);
+    status = H5Dwrite(dset_id, H5T_NATIVE_DOUBLE, memspace, filespace,
+                      H5P_DEFAULT, row);
+    VALIDATE(status >= 0, "Failed to write row of " << name << " at "
+             << current_loc());
+
+    // close
+    H5Dclose(dset_id);
+    H5Sclose(filespace);
+    H5Sclose(memspace);
+}
+
 } // end namespace profugus
 
 //---------------------------------------------------------------------------//
@@ -90,6 +90,16 @@ class Serial_HDF5_Writer : public HDF5_IO_Node
     template<class T>
     void write_incremental_data(const std_string &name, const Decomp &d,
                                 const T *data);
+
+    // >>> EXTENDIBLE WRITE INTERFACE
+
+    // Create a chunked dataset of rows that can be extended.
+    void create_extendible_dataset(const std_string &name,
+                                   std::size_t       row_size);
+
+    // Append a row to an extendible dataset.
+    void append_row(const std_string &name, const double *row,
+                    std::size_t row_size);
 };
 
 //---------------------------------------------------------------------------//
@@ -373,6 +373,53 @@ TEST_F(HDF5_IO_Test, Groups)
     io.close();
 }
 
+//---------------------------------------------------------------------------//
+
+TEST_F(HDF5_IO_Test, Extendible)
+{
+    double rows[3][4] = {{1.0, 2.0, 3.0, 4.0},
+                         {5.0, 6.0, 7.0, 8.0},
+                         {9.0, 10.0, 11.0, 12.0}};
+
+    // make the dataset and write two rows
+    io.open("hdf5_ext.h5");
+    io.create_extendible_dataset("rows", 4);
+    io.append_row("rows", rows[0], 4);
+    io.append_row("rows", rows[1], 4);
+    io.close();
+
+    // reopen and add another row
+    io.open("hdf5_ext.h5", IO_t::APPEND);
+    EXPECT_TRUE(node != 0 || io.query("rows"));
+    io.append_row("rows", rows[2], 4);
+    io.close();
+
+    // read
+    if (node == 0)
+    {
+        open("hdf5_ext.h5");
+
+        int         rank  = 0;
+        size_t      bytes = 0;
+        H5T_class_t dt_class;
+        hsize_t     dims[2] = {0, 0};
+        H5LTget_dataset_ndims(file, "rows", &rank);
+        H5LTget_dataset_info(file, "rows", dims, &dt_class, &bytes);
+        EXPECT_EQ(2, rank);
+        EXPECT_EQ(3, dims[0]);
+        EXPECT_EQ(4, dims[1]);
+
+        Vec_Dbl data(12, 0.0);
+        H5LTread_dataset_double(file, "rows", &data[0]);
+        for (int n = 0; n < 12; ++n)
+        {
+            EXPECT_EQ(rows[n / 4][n % 4], data[n]);
+        }
+
+        close();
+    }
+}
+
 //---------------------------------------------------------------------------//
 //                 end of tstSerial_HDF5_Writer.cc
 //---------------------------------------------------------------------------//